@@ -0,0 +1,165 @@
+#include "ibex.h"
+#include <sstream>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Measures the throughput of the basic interval operations
+ * (+,-,*,/,sqr) and of a few elementary functions of the
+ * underlying interval library.
+ *
+ * The operands mix the situations covered by TestArith: positive,
+ * negative and zero-crossing intervals, degenerated intervals,
+ * unbounded intervals and (rarely) the empty set.
+ *
+ * The interval library is chosen when Ibex is built, so, to compare
+ * two libraries, build Ibex with each of them (-DINTERVAL_LIB=gaol,
+ * filib, sse2, ...) and run this program with the same arguments.
+ *
+ * Default arguments, g++ -O2, x86_64 (glibc 2.36), median of 3 runs,
+ * in Mops/s (gaol 4.2.0 and filib++ 3.0.2.2 built from 3rd/):
+ *
+ *              direct      gaol     filib      sse2
+ *     add        83.5     535.8      65.2    1466.5
+ *     sub        87.5     513.3      54.8    1379.1
+ *     mul        43.7     242.9      35.0     188.4
+ *     div        55.9     153.0      42.0     120.4
+ *     sqr       100.1     269.9      63.5     489.3
+ *     exp        27.7      13.7      11.9      16.5
+ *     log        46.9      13.2      16.5      23.4
+ *     sin        36.2      21.8      17.9      24.7
+ *     mixed      14.3      68.6       9.3      71.7
+ *
+ * The elementary functions of the sse2 backend are calculated with
+ * filib++ (see ibex_IntervalLibWrapper.inl). The direct backend is the
+ * fastest on them but is not rigorous.
+ */
+
+void
+usage (const char *errmsg)
+{
+	stringstream s;
+	s << errmsg << std::endl
+	  << "Usage: benchmark_arith ARGS" << std::endl
+	  << "Optional parameters are:" << std::endl
+	  << "  --size <n>     number of operands (default: 1000)" << std::endl
+	  << "  --rounds <n>   number of passes over the operands (default: 10000)" << std::endl;
+	ibex_error (s.str().c_str());
+}
+
+/* a simple deterministic generator (same operands with all libraries) */
+unsigned long seed = 1;
+
+double
+uniform (double a, double b)
+{
+	seed = (seed * 6364136223846793005UL + 1442695040888963407UL);
+	return a + (b-a) * ((seed >> 11) * (1.0/9007199254740992.0));
+}
+
+Interval
+operand (int i)
+{
+	double a = uniform (0.1, 10);
+	double b = a + uniform (0, 10);
+	switch (i % 16)
+	{
+	case 0: case 1: case 2: case 3: case 4:
+		return Interval (a, b);                   // positive
+	case 5: case 6: case 7:
+		return Interval (-b, -a);                 // negative
+	case 8: case 9: case 10:
+		return Interval (-a, b);                  // contains zero
+	case 11: case 12:
+		return Interval (a);                      // degenerated
+	case 13:
+		return Interval (a, POS_INFINITY);        // unbounded
+	case 14:
+		return Interval (NEG_INFINITY, b);        // unbounded
+	default:
+		return i % 64 == 15 ? Interval::empty_set () : Interval (0, b);
+	}
+}
+
+/* divisors: never contain zero (the generic case) */
+Interval
+divisor (const Interval& x)
+{
+	if (x.is_empty () || !x.contains (0)) return x;
+	else return Interval (x.ub () > 1 ? 1 : 0.5, x.ub () > 1 ? x.ub () : 1);
+}
+
+void
+report (const char *name, double time, long nb_ops, const Interval& check)
+{
+	cout << name << " time=" << time << "s  "
+	     << (time > 0 ? nb_ops / time / 1e6 : 0) << " Mops/s"
+	     << "  (check=" << check << ")" << endl;
+}
+
+int
+main (int argc, const char *argv[])
+{
+	int n = 1000;
+	int rounds = 10000;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp (argv[i], "--size") == 0)
+		{
+			if (i+1 >= argc) usage ("Missing argument for --size");
+			n = atoi (argv[++i]);
+		}
+		else if (strcmp (argv[i], "--rounds") == 0)
+		{
+			if (i+1 >= argc) usage ("Missing argument for --rounds");
+			rounds = atoi (argv[++i]);
+		}
+		else
+		{
+			stringstream s;
+			s << "Unknown argument \"" << argv[i] << "\"";
+			usage (s.str().c_str());
+		}
+	}
+
+	if (n <= 0 || rounds <= 0)
+		usage ("Arguments must be positive");
+
+	cout << "interval library: " << _IBEX_INTERVAL_LIB_ << endl;
+
+	vector<Interval> x, y, z(n);
+	for (int i = 0; i < n; i++) x.push_back (operand (i));
+	for (int i = 0; i < n; i++) y.push_back (operand (i * 7 + 3));
+
+	vector<Interval> d;
+	for (int i = 0; i < n; i++) d.push_back (divisor (y[i]));
+
+	long nb_ops = ((long) n) * rounds;
+	Interval check;
+	Timer timer;
+
+#define BENCH(name, expr) \
+	timer.restart (); \
+	for (int r = 0; r < rounds; r++) \
+		for (int i = 0; i < n; i++) \
+			z[i] = expr; \
+	timer.stop (); \
+	check = z[0]; \
+	for (int i = 1; i < n; i++) check |= z[i]; \
+	report (name, timer.get_time (), nb_ops, check);
+
+	BENCH ("add    ", x[i] + y[i]);
+	BENCH ("sub    ", x[i] - y[i]);
+	BENCH ("mul    ", x[i] * y[i]);
+	BENCH ("div    ", x[i] / d[i]);
+	BENCH ("sqr    ", sqr (x[i]));
+	BENCH ("exp    ", exp (x[i]));
+	BENCH ("log    ", log (x[i]));
+	BENCH ("sin    ", sin (x[i]));
+	// a mixed workload, typical of a forward evaluation
+	BENCH ("mixed  ", sqr (x[i]) * y[i] - x[i] / d[i] + y[i]);
+
+	return 0;
+}
@@ -0,0 +1,104 @@
+#include "ibex.h"
+#include <sstream>
+#include <sys/resource.h>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Measures the time and memory spent in building the systems
+ * required by the default optimizer (original, normalized,
+ * extended systems) before the search starts.
+ */
+
+void
+usage (const char *errmsg)
+{
+	stringstream s;
+	s << errmsg << std::endl
+	  << "Usage: benchmark_setup ARGS" << std::endl
+	  << "Mandatory parameter is:" << std::endl
+	  << "  --bench-file <file>   file containing the problem" << std::endl
+	  << "Optional parameter is:" << std::endl
+	  << "  --jacobian            also calculate the Jacobian matrix once" << std::endl;
+	ibex_error (s.str().c_str());
+}
+
+/* maximum resident set size in kilobytes */
+long
+max_rss ()
+{
+	struct rusage usage;
+	getrusage (RUSAGE_SELF, &usage);
+	return usage.ru_maxrss;
+}
+
+void
+report (const char *name, const System& sys, double time, long rss)
+{
+	int nodes = sys.goal ? sys.goal->nb_nodes() : 0;
+	nodes += sys.f_ctrs.nb_nodes();
+	cout << name << " time=" << time << "s nodes=" << nodes
+	     << " rss+=" << (max_rss()-rss) << "kB" << endl;
+}
+
+int
+main (int argc, const char *argv[])
+{
+	const char *filename = NULL;
+	bool jacobian = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp (argv[i], "--bench-file") == 0)
+		{
+			if (i+1 >= argc) usage ("Missing argument for --bench-file");
+			filename = argv[++i];
+		}
+		else if (strcmp (argv[i], "--jacobian") == 0)
+			jacobian = true;
+		else
+		{
+			stringstream s;
+			s << "Unknown argument \"" << argv[i] << "\"";
+			usage (s.str().c_str());
+		}
+	}
+
+	if (filename == NULL)
+		usage ("Missing mandatory argument --bench-file");
+
+	Timer timer;
+	long rss = max_rss();
+
+	timer.start();
+	System sys (filename);
+	timer.stop();
+	report ("system  ", sys, timer.get_time(), rss);
+
+	rss = max_rss();
+	timer.restart();
+	NormalizedSystem norm_sys (sys);
+	timer.stop();
+	report ("normalized", norm_sys, timer.get_time(), rss);
+
+	rss = max_rss();
+	timer.restart();
+	ExtendedSystem ext_sys (sys);
+	timer.stop();
+	report ("extended", ext_sys, timer.get_time(), rss);
+
+	if (jacobian && sys.nb_ctr > 0)
+	{
+		IntervalMatrix J (sys.nb_ctr, sys.nb_var);
+		rss = max_rss();
+		timer.restart();
+		sys.f_ctrs.jacobian (sys.box, J);
+		timer.stop();
+		report ("jacobian", sys, timer.get_time(), rss);
+	}
+
+	cout << "total max rss=" << max_rss() << "kB" << endl;
+
+	return 0;
+}
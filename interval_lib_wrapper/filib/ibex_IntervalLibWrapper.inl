@@ -459,8 +459,9 @@ inline Interval exp(const Interval& x) {
 inline Interval log(const Interval& x) {
 	if (x.ub()<=0) // filib returns (-oo,-DBL_MAX) if x.ub()==0, instead of EMPTY_SET
 		return Interval::empty_set();
-	else if (x.ub()<=next_float(0))
-		return Interval(NEG_INFINITY,filib::filib_consts<FI_BASE>::q_minr);
+	else if (x.ub()<filib::filib_consts<FI_BASE>::q_minr)
+		// filib does not calculate the logarithm of a subnormal number
+		return Interval(NEG_INFINITY,log(Interval(filib::filib_consts<FI_BASE>::q_minr)).ub());
 	else
 		return filib::log(x.itv);
 }
@@ -494,11 +495,24 @@ inline Interval atan(const Interval& x) {
 }
 
 inline Interval cosh(const Interval& x) {
-	return filib::cosh(x.itv);
+	Interval res=filib::cosh(x.itv);
+	// filib overflows as soon as exp(|x|) does (the lower bound is then
+	// set to DBL_MAX) whereas cosh(|x|) is still representable.
+	if (!res.is_empty() && res.lb()>=DBL_MAX)
+		return Interval(exp(x.mig()-log(Interval(2))).lb(),POS_INFINITY);
+	else
+		return res;
 }
 
 inline Interval sinh(const Interval& x) {
-	return filib::sinh(x.itv);
+	Interval res=filib::sinh(x.itv);
+	if (res.is_empty()) return res;
+	// same overflow as for cosh (sinh(t)>=exp(t-log(2))-1/2 for t>=0)
+	if (res.lb()>=DBL_MAX)
+		res=Interval((exp(x.lb()-log(Interval(2)))-0.5).lb(),POS_INFINITY);
+	if (res.ub()<=-DBL_MAX)
+		res=Interval(res.lb(),-(exp(-x.ub()-log(Interval(2)))-0.5).lb());
+	return res;
 }
 
 inline Interval tanh(const Interval& x) {
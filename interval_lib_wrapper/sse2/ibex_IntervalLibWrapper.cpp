@@ -0,0 +1,97 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_IntervalLibWrapper.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_Interval.h"
+
+namespace ibex {
+
+namespace {
+
+// The rounding mode is always set upward (see SSE2_INTERVAL).
+// Calling this function in the initialization of one static constant
+// (like EMPTY_SET) should be enough as these constants are all
+// initialized before the first Ibex function call occurs.
+// Threads created by Ibex inherit the floating-point environment
+// of the calling thread.
+// filib++ (used for the elementary functions) is initialized first.
+void init_sse2() {
+	filib::fp_traits<double>::setup();
+	fpu_round_up();
+}
+
+// The two doubles enclosing pi
+const double pi_dn=3.141592653589793115997963468544185161590576171875;
+const double pi_up=3.141592653589793560087173318606801331043243408203125;
+
+}
+
+// *** Deprecated ***
+const Interval Interval::EMPTY_SET((init_sse2(), SSE2_INTERVAL()));
+const Interval Interval::ALL_REALS(NEG_INFINITY, POS_INFINITY);
+const Interval Interval::NEG_REALS(NEG_INFINITY, 0.0);
+const Interval Interval::POS_REALS(0.0, POS_INFINITY);
+const Interval Interval::ZERO(0.0);
+const Interval Interval::ONE(1.0);
+const Interval Interval::PI(pi_dn,pi_up);
+const Interval Interval::TWO_PI(2.0*pi_dn,2.0*pi_up);
+const Interval Interval::HALF_PI(0.5*pi_dn,0.5*pi_up);
+
+const Interval& Interval::empty_set() {
+	static Interval _empty_set((SSE2_INTERVAL()));
+	return _empty_set;
+}
+
+const Interval& Interval::all_reals() {
+	static Interval _all_reals(NEG_INFINITY, POS_INFINITY);
+	return _all_reals;
+}
+
+const Interval& Interval::neg_reals() {
+	static Interval _neg_reals(NEG_INFINITY, 0.0);
+	return _neg_reals;
+}
+
+const Interval& Interval::pos_reals() {
+	static Interval _pos_reals(0.0, POS_INFINITY);
+	return _pos_reals;
+}
+
+const Interval& Interval::zero() {
+	static Interval _zero(0.0);
+	return _zero;
+}
+
+const Interval& Interval::one() {
+	static Interval _one(1.0);
+	return _one;
+}
+
+const Interval& Interval::pi() {
+	static Interval _pi(pi_dn,pi_up);
+	return _pi;
+}
+
+const Interval& Interval::two_pi() {
+	static Interval _two_pi(2.0*pi_dn,2.0*pi_up);
+	return _two_pi;
+}
+
+const Interval& Interval::half_pi() {
+	static Interval _half_pi(0.5*pi_dn,0.5*pi_up);
+	return _half_pi;
+}
+
+std::ostream& operator<<(std::ostream& os, const Interval& x) {
+	if (x.is_empty())
+		return os << "[ empty ]";
+	else
+		return os << "[" << x.lb() << "," << x.ub() << "]";
+}
+
+} // end namespace
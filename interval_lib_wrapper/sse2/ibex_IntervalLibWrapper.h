@@ -0,0 +1,188 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_IntervalLibWrapper.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef _IBEX_INTERVALLIBWRAPPER_H_
+#define _IBEX_INTERVALLIBWRAPPER_H_
+
+#include <math.h>
+#include <emmintrin.h>
+
+#if !defined(__SSE2__) && !defined(_M_X64) && !(defined(_M_IX86_FP) && _M_IX86_FP>=2)
+#error "The sse2 interval library requires a processor with SSE2 (compile with -msse2 -mfpmath=sse)"
+#endif
+
+#define IBEX_INTERVAL_LIB_NEG_INFINITY (-HUGE_VAL)
+#define IBEX_INTERVAL_LIB_POS_INFINITY (HUGE_VAL)
+
+/**
+ * \brief Interval stored in one SSE2 register.
+ *
+ * An interval [a,b] is represented by the pair (-a,b) so that, once the
+ * rounding mode is set upward, both bounds are rounded outward by the same
+ * packed instruction: the lower bound is obtained by rounding upward the
+ * opposite of the result (negation is exact). The empty set is (NaN,NaN).
+ *
+ * All the operations assume that the rounding mode is upward. It is
+ * set when the library is loaded (see ibex_IntervalLibWrapper.cpp) and
+ * inherited by the threads created by Ibex. Any code that changes the
+ * rounding mode must restore it with fpu_round_up() (as with Gaol).
+ */
+class SSE2_INTERVAL {
+public:
+	/** Empty set. */
+	SSE2_INTERVAL() : v(_mm_set1_pd(NAN)) { }
+
+	/** [a,b] (empty if a>b, a=+oo or b=-oo). */
+	SSE2_INTERVAL(double a, double b) :
+		v((a>b || a==IBEX_INTERVAL_LIB_POS_INFINITY || b==IBEX_INTERVAL_LIB_NEG_INFINITY) ?
+				_mm_set1_pd(NAN) : _mm_set_pd(b,-a)) { }
+
+	/** [a,a]. */
+	SSE2_INTERVAL(double a) : SSE2_INTERVAL(a,a) { }
+
+	/** Interval from the internal representation (-a,b). */
+	explicit SSE2_INTERVAL(__m128d v) : v(v) { }
+
+	/** Lower bound. */
+	double inf() const {
+		return -_mm_cvtsd_f64(v);
+	}
+
+	/** Upper bound. */
+	double sup() const {
+		return _mm_cvtsd_f64(_mm_unpackhi_pd(v,v));
+	}
+
+	/** True iff this is the empty set. */
+	bool is_empty() const {
+		return _mm_movemask_pd(_mm_cmpunord_pd(v,v))!=0;
+	}
+
+	/** [a,b]+[c,d]. */
+	static __m128d add(__m128d x, __m128d y) {
+		return _mm_add_pd(x,y);
+	}
+
+	/** [a,b]-[c,d]=[a-d,b-c]. */
+	static __m128d sub(__m128d x, __m128d y) {
+		return _mm_add_pd(x,swap(y));
+	}
+
+	/** -[a,b]=[-b,-a]. */
+	static __m128d minus(__m128d x) {
+		return swap(x);
+	}
+
+	/**
+	 * [a,b]*[c,d].
+	 *
+	 * The four products are calculated in both lanes (with opposite
+	 * signs in the first lane) and the maximum is taken, which avoids
+	 * the usual case analysis on the signs. The products 0*oo (NaN)
+	 * are replaced by 0.
+	 */
+	static __m128d mul(__m128d x, __m128d y) {
+		__m128d _a=_mm_unpacklo_pd(x,x);                  // (-a,-a)
+		__m128d b =_mm_unpackhi_pd(x,x);                  // (b,b)
+		__m128d c =_mm_xor_pd(_mm_unpacklo_pd(y,y),lo()); // (c,-c)
+		__m128d d =_mm_xor_pd(_mm_unpackhi_pd(y,y),hi()); // (d,-d)
+		__m128d r=_mm_max_pd(
+				_mm_max_pd(nan2zero(_mm_mul_pd(_a,c)), nan2zero(_mm_mul_pd(_a,d))),
+				_mm_max_pd(nan2zero(_mm_mul_pd(b,neg(c))), nan2zero(_mm_mul_pd(b,neg(d)))));
+		return _mm_or_pd(r,_mm_or_pd(empty_mask(x),empty_mask(y)));
+	}
+
+	/**
+	 * [a,b]/[c,d] with 0 not in [c,d].
+	 *
+	 * Same as #mul(__m128d,__m128d). The quotients oo/oo (NaN) are replaced
+	 * by 0, which is in the closure of the result in this case.
+	 */
+	static __m128d div(__m128d x, __m128d y) {
+		__m128d _a=_mm_unpacklo_pd(x,x);
+		__m128d b =_mm_unpackhi_pd(x,x);
+		__m128d c =_mm_xor_pd(_mm_unpacklo_pd(y,y),lo());
+		__m128d d =_mm_xor_pd(_mm_unpackhi_pd(y,y),hi());
+		__m128d r=_mm_max_pd(
+				_mm_max_pd(nan2zero(_mm_div_pd(_a,c)), nan2zero(_mm_div_pd(_a,d))),
+				_mm_max_pd(nan2zero(_mm_div_pd(b,neg(c))), nan2zero(_mm_div_pd(b,neg(d)))));
+		return _mm_or_pd(r,_mm_or_pd(empty_mask(x),empty_mask(y)));
+	}
+
+	/** [a,b]^2. */
+	static __m128d sqr(__m128d x) {
+		__m128d s=swap(x);                                     // (b,-a)
+		__m128d r=_mm_max_pd(_mm_mul_pd(x,_mm_xor_pd(x,lo())),  // (-a*a, b*b)
+		                     _mm_mul_pd(s,_mm_xor_pd(s,lo()))); // (-b*b, a*a)
+		// if a<=0<=b, the lower bound is 0
+		__m128d z=_mm_cmpge_pd(x,_mm_setzero_pd());
+		z=_mm_and_pd(_mm_and_pd(z,swap(z)),_mm_castsi128_pd(_mm_set_epi32(0,0,-1,-1)));
+		return _mm_andnot_pd(z,r);
+	}
+
+	/** Intersection. */
+	static __m128d inter(__m128d x, __m128d y) {
+		return _mm_or_pd(_mm_min_pd(x,y),_mm_or_pd(empty_mask(x),empty_mask(y)));
+	}
+
+	/** Hull. */
+	static __m128d hull(__m128d x, __m128d y) {
+		__m128d e=empty_mask(y); // an empty y is replaced by x
+		return _mm_max_pd(x,_mm_or_pd(_mm_and_pd(e,x),_mm_andnot_pd(e,y)));
+	}
+
+	/** (-a,b) */
+	__m128d v;
+
+private:
+	static __m128d swap(__m128d x) {
+		return _mm_shuffle_pd(x,x,1);
+	}
+
+	/* sign bit in the first lane */
+	static __m128d lo() {
+		return _mm_set_pd(0.0,-0.0);
+	}
+
+	/* sign bit in the second lane */
+	static __m128d hi() {
+		return _mm_set_pd(-0.0,0.0);
+	}
+
+	static __m128d neg(__m128d x) {
+		return _mm_xor_pd(x,_mm_set1_pd(-0.0));
+	}
+
+	/* NaN lanes set to 0 */
+	static __m128d nan2zero(__m128d x) {
+		return _mm_and_pd(x,_mm_cmpord_pd(x,x));
+	}
+
+	/* all bits set iff x is empty */
+	static __m128d empty_mask(__m128d x) {
+		__m128d e=_mm_cmpunord_pd(x,x);
+		return _mm_or_pd(e,swap(e));
+	}
+};
+
+namespace ibex {
+  typedef SSE2_INTERVAL interval_type_wrapper;
+
+  static inline double
+  _interval_distance_wrapper (const interval_type_wrapper &x1,
+                              const interval_type_wrapper &x2)
+  {
+    // |a-c| and |b-d| rounded upward in one go
+    __m128d d=_mm_sub_pd(x1.v,x2.v);
+    d=_mm_andnot_pd(_mm_set1_pd(-0.0),d);
+    return _mm_cvtsd_f64(_mm_max_sd(d,_mm_unpackhi_pd(d,d)));
+  }
+}
+
+#endif /* _IBEX_INTERVALLIBWRAPPER_H_ */
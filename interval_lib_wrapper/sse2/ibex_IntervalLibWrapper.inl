@@ -0,0 +1,721 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_IntervalLibWrapper.inl
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef _IBEX_INTERVALLIBWRAPPER_INL_
+#define _IBEX_INTERVALLIBWRAPPER_INL_
+
+#include "ibex_Exception.h"
+#include <cassert>
+#include <float.h>
+#include <cfenv>
+#include <cmath>
+#include <climits>
+
+#include "interval/interval.hpp"
+
+namespace ibex {
+
+/*
+ * Note: with this library, the rounding mode is always upward
+ * (see SSE2_INTERVAL). The following functions are only used
+ * by the code that temporarily requires another mode.
+ */
+inline void fpu_round_down() {
+	std::fesetround(FE_DOWNWARD);
+}
+
+inline void fpu_round_up() {
+	std::fesetround(FE_UPWARD);
+}
+
+inline void fpu_round_near() {
+	std::fesetround(FE_TONEAREST);
+}
+
+inline void fpu_round_zero() {
+	std::fesetround(FE_TOWARDZERO);
+}
+
+inline double previous_float(double x) {
+	return ::nextafter(x, NEG_INFINITY);
+}
+
+inline double next_float(double x) {
+	return ::nextafter(x, POS_INFINITY);
+}
+
+/*
+ * Elementary functions are calculated with filib++, whose functions
+ * come with proven error bounds. filib++ (with the "native_switched"
+ * rounding) expects the rounding mode to be to-nearest and leaves it so:
+ * the mode is switched before the call and restored upward after.
+ */
+typedef filib::interval<double,filib::native_switched,filib::i_mode_extended_flag> SSE2_FILIB_INTERVAL;
+
+inline SSE2_FILIB_INTERVAL _sse2_to_filib(const Interval& x) {
+	fpu_round_near();
+	return SSE2_FILIB_INTERVAL(x.lb(),x.ub());
+}
+
+inline Interval _sse2_from_filib(const SSE2_FILIB_INTERVAL& y) {
+	fpu_round_up();
+	if (y.isEmpty()) return Interval::empty_set();
+	else return Interval(y.inf(),y.sup());
+}
+
+/*
+ * x^n rounded downward/upward, for x>=0 (binary exponentiation;
+ * all the intermediate results are nonnegative so that rounding
+ * each product in the same direction gives a bound).
+ */
+inline double _sse2_pow_down(double x, int n) {
+	double r=1;
+	while (n>0) {
+		if (n & 1) r=-((-r)*x);
+		n >>= 1;
+		if (n>0) x=-((-x)*x);
+	}
+	return r;
+}
+
+inline double _sse2_pow_up(double x, int n) {
+	double r=1;
+	while (n>0) {
+		if (n & 1) r*=x;
+		n >>= 1;
+		if (n>0) x*=x;
+	}
+	return r;
+}
+
+/*
+ * nth root of x rounded downward/upward, for x>=0: the
+ * approximation given by the math library is corrected
+ * until the nth power is proven to be below/above x.
+ */
+inline double _sse2_root_down(double x, int n) {
+	double r=::pow(x,1.0/n);
+	while (r>0 && _sse2_pow_up(r,n)>x) r=previous_float(r);
+	return r;
+}
+
+inline double _sse2_root_up(double x, int n) {
+	double r=::pow(x,1.0/n);
+	while (_sse2_pow_down(r,n)<x) r=next_float(r);
+	return r;
+}
+
+inline Interval::Interval(const SSE2_INTERVAL& x) : itv(x) {
+
+}
+
+inline Interval& Interval::operator=(const SSE2_INTERVAL& x) {
+	this->itv = x;
+	return *this;
+}
+
+inline Interval& Interval::operator+=(double d) {
+	if (d==NEG_INFINITY || d==POS_INFINITY) set_empty();
+	else itv.v=SSE2_INTERVAL::add(itv.v,_mm_set_pd(d,-d));
+	return *this;
+}
+
+inline Interval& Interval::operator-=(double d) {
+	if (d==NEG_INFINITY || d==POS_INFINITY) set_empty();
+	else itv.v=SSE2_INTERVAL::add(itv.v,_mm_set_pd(-d,d));
+	return *this;
+}
+
+inline Interval& Interval::operator*=(double d) {
+	return ((*this)*=Interval(d));
+}
+
+inline Interval& Interval::operator/=(double d) {
+	return ((*this)/=Interval(d));
+}
+
+inline Interval& Interval::operator+=(const Interval& x) {
+	itv.v=SSE2_INTERVAL::add(itv.v,x.itv.v);
+	return *this;
+}
+
+inline Interval& Interval::operator-=(const Interval& x) {
+	itv.v=SSE2_INTERVAL::sub(itv.v,x.itv.v);
+	return *this;
+}
+
+inline Interval& Interval::operator*=(const Interval& y) {
+	itv.v=SSE2_INTERVAL::mul(itv.v,y.itv.v);
+	return *this;
+}
+
+inline Interval& Interval::operator/=(const Interval& y) {
+
+	if (is_empty()) return *this;
+	if (y.is_empty()) { set_empty(); return *this; }
+
+	const double c=y.lb();
+	const double d=y.ub();
+
+	// the most frequent case
+	if (c>0 || d<0) {
+		itv.v=SSE2_INTERVAL::div(itv.v,y.itv.v);
+		return *this;
+	}
+
+	if (c==0 && d==0) {
+		set_empty();
+		return *this;
+	}
+
+	const double a=lb();
+	const double b=ub();
+
+	if (a==0 && b==0) {
+		// TODO: 0/0 can also be 1...
+		return *this;
+	}
+
+	// from now on, c<=0<=d. Note: -((-x)/y) is x/y rounded downward.
+
+	if (b<=0 && d==0) { *this=Interval(-((-b)/c), POS_INFINITY); return *this; }
+
+	if (b<=0 && c==0) { *this=Interval(NEG_INFINITY, b/d); return *this; }
+
+	if (a>=0 && d==0) { *this=Interval(NEG_INFINITY, a/c); return *this; }
+
+	if (a>=0 && c==0) { *this=Interval(-((-a)/d), POS_INFINITY); return *this; }
+
+	*this=Interval(NEG_INFINITY, POS_INFINITY); // a<0<b or c<0<d
+	return *this;
+}
+
+inline Interval Interval:: operator-() const {
+	return SSE2_INTERVAL(SSE2_INTERVAL::minus(itv.v));
+}
+
+inline Interval& Interval::div2_inter(const Interval& x, const Interval& y) {
+	Interval out2;
+	div2_inter(x,y,out2);
+	*this |= out2;
+	return *this;
+}
+
+inline void Interval::set_empty() {
+	itv=SSE2_INTERVAL();
+}
+
+inline Interval& Interval::operator&=(const Interval& x) {
+	itv.v=SSE2_INTERVAL::inter(itv.v,x.itv.v);
+	if (lb()>ub()) set_empty();
+	return *this;
+}
+
+inline Interval& Interval::operator|=(const Interval& x) {
+	itv.v=SSE2_INTERVAL::hull(itv.v,x.itv.v);
+	return *this;
+}
+
+inline double Interval::lb() const {
+	return itv.inf();
+}
+
+inline double Interval::ub() const {
+	return itv.sup();
+}
+
+inline double Interval::mid() const {
+	if (lb()==NEG_INFINITY)
+		if (ub()==POS_INFINITY) return 0;
+		else return -DBL_MAX;
+	else if (ub()==POS_INFINITY) return DBL_MAX;
+	else if (lb()==0) {
+		if (ub()==DBL_MIN) return 0;
+		else return ub()/2;
+	}
+	else if (ub()==0) {
+		if (lb()==-DBL_MIN) return 0;
+		else return lb()/2;
+	}
+	else {
+		double m=(lb()-(lb()-ub())/2); // better way to compute the middle, reduce the number of overfloat
+		if (m<lb()) m=lb(); // watch dog
+		else if (m>ub()) m=ub();
+		return m;
+	}
+}
+
+inline bool Interval::is_empty() const {
+	return itv.is_empty();
+}
+
+inline bool Interval::is_degenerated() const {
+	return is_empty() || lb()==ub();
+}
+
+inline bool Interval::is_unbounded() const {
+	if (is_empty()) return false;
+	return lb()==NEG_INFINITY || ub()==POS_INFINITY;
+}
+
+inline double Interval::diam() const {
+	// -a+b rounded upward (+oo if unbounded)
+	return is_empty()? 0 : _mm_cvtsd_f64(_mm_add_sd(itv.v,_mm_unpackhi_pd(itv.v,itv.v)));
+}
+
+inline double Interval::mig() const {
+	if (lb()>0)      return lb();
+	else if (ub()<0) return -ub();
+	else             return 0;
+}
+
+inline double Interval::mag() const {
+	return (fabs(lb())> fabs(ub())) ? fabs(lb()) : fabs(ub());
+}
+
+inline Interval operator&(const Interval& x1, const Interval& x2) {
+	Interval res(x1);
+	res &= x2;
+	return res;
+}
+
+inline Interval operator|(const Interval& x1, const Interval& x2) {
+	Interval res(x1);
+	res |= x2;
+	return res;
+}
+
+inline Interval operator+(const Interval& x, double d) {
+	Interval r(x);
+	r += d;
+	return r;
+}
+
+inline Interval operator-(const Interval& x, double d) {
+	Interval r(x);
+	r -= d;
+	return r;
+}
+
+inline Interval operator*(const Interval& x, double d) {
+	Interval r(x);
+	r *= d;
+	return r;
+}
+
+inline Interval operator/(const Interval& x, double d) {
+	Interval r(x);
+	r /= d;
+	return r;
+}
+
+inline Interval operator+(double d,const Interval& x) {
+	return x+d;
+}
+
+inline Interval operator-(double d, const Interval& x) {
+	Interval r(d);
+	r -= x;
+	return r;
+}
+
+inline Interval operator*(double d, const Interval& x) {
+	return x*d;
+}
+
+inline Interval operator/(double d, const Interval& x) {
+	return Interval(d)/x;
+}
+
+inline Interval operator+(const Interval& x1, const Interval& x2) {
+	return SSE2_INTERVAL(SSE2_INTERVAL::add(x1.itv.v,x2.itv.v));
+}
+
+inline Interval operator-(const Interval& x1, const Interval& x2) {
+	return SSE2_INTERVAL(SSE2_INTERVAL::sub(x1.itv.v,x2.itv.v));
+}
+
+inline Interval operator*(const Interval& x, const Interval& y) {
+	return SSE2_INTERVAL(SSE2_INTERVAL::mul(x.itv.v,y.itv.v));
+}
+
+inline Interval operator/(const Interval& x, const Interval& y) {
+	return (Interval(x)/=y);
+}
+
+inline Interval sqr(const Interval& x) {
+	return SSE2_INTERVAL(SSE2_INTERVAL::sqr(x.itv.v));
+}
+
+inline Interval sqrt(const Interval& x) {
+	if (x.is_empty() || x.ub()<0) return Interval::empty_set();
+	double u=::sqrt(x.ub()); // rounded upward
+	if (x.lb()<=0) return Interval(0,u);
+	double l=::sqrt(x.lb());
+	if (l*l>x.lb()) l=previous_float(l); // l^2 rounded upward: l is not proven to be a lower bound
+	return Interval(l,u);
+}
+
+inline Interval pow(const Interval& x, int n) {
+	if (x.is_empty()) return Interval::empty_set();
+	else if (n==0)    return Interval::one();
+	else if (n<0)     return 1.0/pow(x,-n);
+	else if (n==1)    return x;
+	else if (n==2)    return sqr(x);
+	else if (n%2!=0) {
+		if (x.ub()<0)
+			return -pow(-x,n);
+		else if (x.lb()<0)
+			return Interval(-_sse2_pow_up(-x.lb(),n),_sse2_pow_up(x.ub(),n));
+		else
+			return Interval(_sse2_pow_down(x.lb(),n),_sse2_pow_up(x.ub(),n));
+	}
+	else {
+		double l=x.lb()<=0 && x.ub()>=0 ? 0 : _sse2_pow_down(x.mig(),n);
+		return Interval(l,_sse2_pow_up(x.mag(),n));
+	}
+}
+
+inline Interval pow(const Interval& x, double d) {
+	if(d==NEG_INFINITY || d==POS_INFINITY)
+		return Interval::empty_set();
+	else if (d==0)
+		return Interval::one();
+	else if (d<0)
+		return 1.0/pow(x,-d);
+	else
+		return pow(x,Interval(d));
+}
+
+inline Interval pow(const Interval &x, const Interval &y) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return exp(y * log(x));
+}
+
+inline Interval root(const Interval& x, int den) {
+	if (x.is_empty()) return Interval::empty_set();
+	if (den<0) return Interval(1.0)/root(x,-den);
+	if (den==1) return x;
+	if (den % 2 == 0) {
+		if (x.ub()<0) return Interval::empty_set();
+		return Interval(x.lb()<=0 ? 0 : _sse2_root_down(x.lb(),den), _sse2_root_up(x.ub(),den));
+	} else {
+		double l=x.lb()<0 ? -_sse2_root_up(-x.lb(),den) : _sse2_root_down(x.lb(),den);
+		double u=x.ub()<0 ? -_sse2_root_down(-x.ub(),den) : _sse2_root_up(x.ub(),den);
+		return Interval(l,u);
+	}
+}
+
+inline Interval exp(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return _sse2_from_filib(filib::exp(_sse2_to_filib(x)));
+}
+
+inline Interval log(const Interval& x) {
+	if (x.is_empty() || x.ub()<=0)
+		return Interval::empty_set();
+	else if (x.ub()<filib::filib_consts<double>::q_minr)
+		// filib does not calculate the logarithm of a subnormal number
+		return Interval(NEG_INFINITY,log(Interval(filib::filib_consts<double>::q_minr)).ub());
+	else
+		return _sse2_from_filib(filib::log(_sse2_to_filib(x)));
+}
+
+inline Interval cos(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return _sse2_from_filib(filib::cos(_sse2_to_filib(x)));
+}
+
+inline Interval sin(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return _sse2_from_filib(filib::sin(_sse2_to_filib(x)));
+}
+
+inline Interval tan(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	Interval res=_sse2_from_filib(filib::tan(_sse2_to_filib(x)));
+	// filib returns the empty set if x contains a singularity
+	if (res.is_empty()) return Interval::all_reals();
+	else return res;
+}
+
+inline Interval cosh(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	Interval res=_sse2_from_filib(filib::cosh(_sse2_to_filib(x)));
+	// filib overflows as soon as exp(|x|) does (the lower bound is then
+	// set to DBL_MAX) whereas cosh(|x|) is still representable.
+	if (res.lb()>=DBL_MAX)
+		return Interval(exp(x.mig()-log(Interval(2))).lb(),POS_INFINITY);
+	else
+		return res;
+}
+
+inline Interval acos(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return _sse2_from_filib(filib::acos(_sse2_to_filib(x)));
+}
+
+inline Interval asin(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return _sse2_from_filib(filib::asin(_sse2_to_filib(x)));
+}
+
+inline Interval atan(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return _sse2_from_filib(filib::atan(_sse2_to_filib(x)));
+}
+
+inline Interval sinh(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	Interval res=_sse2_from_filib(filib::sinh(_sse2_to_filib(x)));
+	// same overflow as for cosh (sinh(t)>=exp(t-log(2))-1/2 for t>=0)
+	if (res.lb()>=DBL_MAX)
+		res=Interval((exp(x.lb()-log(Interval(2)))-0.5).lb(),POS_INFINITY);
+	if (res.ub()<=-DBL_MAX)
+		res=Interval(res.lb(),-(exp(-x.ub()-log(Interval(2)))-0.5).lb());
+	return res;
+}
+
+inline Interval tanh(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return _sse2_from_filib(filib::tanh(_sse2_to_filib(x)));
+}
+
+inline Interval acosh(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return _sse2_from_filib(filib::acosh(_sse2_to_filib(x)));
+}
+
+inline Interval asinh(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return _sse2_from_filib(filib::asinh(_sse2_to_filib(x)));
+}
+
+inline Interval atanh(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return _sse2_from_filib(filib::atanh(_sse2_to_filib(x)));
+}
+
+inline Interval abs(const Interval &x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else {
+		double a1=x.lb(), a2=x.ub();
+		if (a1>=0) return x;
+		if (a2<=0) return -x;
+		if (fabs(a1)>fabs(a2))  return Interval(0,fabs(a1));
+		else                    return Interval(0,fabs(a2));
+	}
+}
+
+inline Interval max(const Interval& x, const Interval& y) {
+	if (x.is_empty() || y.is_empty()) return Interval::empty_set();
+	else return Interval(x.lb()>y.lb()? x.lb() : y.lb(), x.ub()>y.ub()? x.ub() : y.ub());
+}
+
+inline Interval min(const Interval& x, const Interval& y) {
+	if (x.is_empty() || y.is_empty()) return Interval::empty_set();
+	else return Interval(x.lb()<y.lb()? x.lb() : y.lb(), x.ub()<y.ub()? x.ub() : y.ub());
+}
+
+inline Interval integer(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	double l= (x.lb()==NEG_INFINITY? NEG_INFINITY : std::ceil(x.lb()));
+	double r= (x.ub()==POS_INFINITY? POS_INFINITY : std::floor(x.ub()));
+	if (l>r) return Interval::empty_set();
+	else return Interval(l,r);
+}
+
+inline Interval floor(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return Interval(std::floor(x.lb()),std::floor(x.ub()));
+}
+
+inline Interval ceil(const Interval& x) {
+	if (x.is_empty()) return Interval::empty_set();
+	else return Interval(std::ceil(x.lb()),std::ceil(x.ub()));
+}
+
+inline bool bwd_mul(const Interval& y, Interval& x1, Interval& x2) {
+	if (y.contains(0)) {
+		if (!x2.contains(0))                           // if y and x2 contains 0, x1 can be any double number.
+			if (x1.div2_inter(y,x2).is_empty()) { x2.set_empty(); return false; }  // otherwise y=x1*x2 => x1=y/x2
+		if (x1.contains(0)) return true;
+		if (x2.div2_inter(y,x1).is_empty()) { x1.set_empty(); return false; }
+		else return true;
+	} else {
+		if (x1.div2_inter(y,x2).is_empty()) { x2.set_empty(); return false; }
+		if (x2.div2_inter(y,x1).is_empty()) { x1.set_empty(); return false; }
+		else return true;
+	}
+}
+
+inline bool bwd_sqr(const Interval& y, Interval& x) {
+
+	Interval proj=sqrt(y);
+	Interval pos_proj= proj & x;
+	Interval neg_proj = (-proj) & x;
+
+	x = pos_proj | neg_proj;
+
+	return !x.is_empty();
+}
+
+inline bool bwd_pow(const Interval& y, int expon, Interval& x) {
+
+	if (expon % 2 ==0) {
+		Interval proj=root(y,expon);
+		Interval pos_proj= proj & x;
+		Interval neg_proj = (-proj) & x;
+
+		x = pos_proj | neg_proj;
+
+		return !x.is_empty();
+
+	} else {
+
+		x &= root(y, expon);
+		return !x.is_empty();
+
+	}
+}
+
+inline bool bwd_pow(const Interval& , Interval& , Interval& ) {
+	not_implemented("warning: bwd_power(y,x1,x2) (with x1 and x2 intervals) not implemented yet with SSE2");
+	return true;
+}
+
+/**
+ * ftype:
+ *   COS = 0
+ *   SIN = 1
+ *   TAN = 2
+ */
+inline bool bwd_trigo(const Interval& y, Interval& x, int ftype) {
+
+	const int COS=0;
+	const int SIN=1;
+	const int TAN=2;
+
+	Interval period_0, nb_period;
+
+	switch (ftype) {
+	case COS :
+		period_0 = acos(y); break;
+	case SIN :
+		period_0 = asin(y); break;
+	case TAN :
+		period_0 = atan(y); break;
+	default :
+		assert(false); break;
+	}
+
+	if (period_0.is_empty()) { x.set_empty(); return false; }
+
+	if (x.lb()==NEG_INFINITY || x.ub()==POS_INFINITY) return true; // infinity of periods
+
+	switch (ftype) {
+	case COS :
+		nb_period = x / Interval::pi(); break;
+	case SIN :
+		nb_period = (x+Interval::half_pi()) / Interval::pi(); break;
+	case TAN :
+		nb_period = (x+Interval::half_pi()) / Interval::pi(); break;
+	default :
+		assert(false); break;
+	}
+
+	if (nb_period.mag() > INT_MAX) return true;
+
+	int p1 = ((int) nb_period.lb())-1;
+	int p2 = ((int) nb_period.ub());
+	Interval tmp1, tmp2;
+
+	bool found = false;
+	int i = p1-1;
+
+	switch(ftype) {
+	case COS :
+		// should find in at most 2 turns.. but consider rounding !
+		while (++i<=p2 && !found) found = !(tmp1 = (x & (i%2==0? period_0 + i*Interval::pi() : (i+1)*Interval::pi() - period_0))).is_empty();
+		break;
+	case SIN :
+		while (++i<=p2 && !found) found = !(tmp1 = (x & (i%2==0? period_0 + i*Interval::pi() : i*Interval::pi() - period_0))).is_empty();
+		break;
+	case TAN :
+		while (++i<=p2 && !found) found = !(tmp1 = (x & (period_0 + i*Interval::pi()))).is_empty();
+		break;
+	}
+
+	if (!found) { x.set_empty(); return false; }
+	found = false;
+	i=p2+1;
+
+	switch(ftype) {
+	case COS :
+		while (--i>=p1 && !found) found = !(tmp2 = (x & (i%2==0? period_0 + i*Interval::pi() : (i+1)*Interval::pi() - period_0))).is_empty();
+		break;
+	case SIN :
+		while (--i>=p1 && !found) found = !(tmp2 = (x & (i%2==0? period_0 + i*Interval::pi() : i*Interval::pi() - period_0))).is_empty();
+		break;
+	case TAN :
+		while (--i>=p1 && !found) found = !(tmp2 = (x & (period_0 + i*Interval::pi()))).is_empty();
+		break;
+	}
+
+	if (!found) {  x.set_empty(); return false; }
+
+	x = tmp1 | tmp2;
+
+	return true;
+}
+
+inline bool bwd_cos(const Interval& y,  Interval& x) {
+	return bwd_trigo(y,x,0);
+}
+
+inline bool bwd_sin(const Interval& y,  Interval& x) {
+	return bwd_trigo(y,x,1);
+}
+
+inline bool bwd_tan(const Interval& y,  Interval& x) {
+	return bwd_trigo(y,x,2);
+}
+
+inline bool bwd_cosh(const Interval& y,  Interval& x) {
+
+	Interval proj=acosh(y);
+	if (proj.is_empty()) return false;
+	Interval pos_proj= proj & x;
+	Interval neg_proj = (-proj) & x;
+
+	x = pos_proj | neg_proj;
+
+	return !x.is_empty();
+}
+
+inline bool bwd_sinh(const Interval& y,  Interval& x) {
+	x &= asinh(y);
+	return !x.is_empty();
+}
+
+inline bool bwd_tanh(const Interval& y,  Interval& x) {
+	x &= atanh(y);
+	return !x.is_empty();
+}
+
+inline bool bwd_abs(const Interval& y,  Interval& x) {
+	Interval x1 = x & y;
+	Interval x2 = x & (-y);
+	x &= x1 | x2;
+	return !x.is_empty();
+}
+
+} // end namespace ibex
+
+#endif /* _IBEX_INTERVALLIBWRAPPER_INL_ */
@@ -0,0 +1,353 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_AffineForm.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_AffineForm.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Return a point m of x and add to err an upper bound of |t-m| for all t in x.
+ */
+double split(const Interval& x, Interval& err) {
+	double m=x.mid();
+	err += std::max((Interval(x.ub())-m).ub(), (Interval(m)-x.lb()).ub());
+	return m;
+}
+
+/*
+ * Sum of the magnitudes of the terms and the error.
+ */
+Interval radius(const AffineForm& x) {
+	Interval r(x.err());
+	for (int k=0; k<x.nb_terms(); k++)
+		r += ::fabs(x.coeff(k));
+	return r;
+}
+
+/*
+ * True if a nonlinear function can be linearized over x.
+ */
+bool linearizable(const AffineForm& x, const Interval& fx) {
+	return x.is_affine() && !x.itv().is_unbounded() && !x.itv().is_degenerated()
+			&& !fx.is_empty() && !fx.is_unbounded();
+}
+
+/*
+ * Slope of the chord of f between a and b.
+ */
+double slope(double a, double b, const Interval& fa, const Interval& fb) {
+	return ((fb-fa)/(Interval(b)-a)).mid();
+}
+
+/*
+ * Linearization of a convex or concave function f over x with the slope
+ * alpha, given f(a), f(b) (the bounds of x) and f(t) where t encloses
+ * the point where f'(t)=alpha (the extrema of f(t)-alpha*t are
+ * reached at a, b or t).
+ */
+AffineForm chebyshev(const AffineForm& x, double alpha, const Interval& fa, const Interval& fb,
+		const Interval& t, const Interval& ft, const Interval& fx) {
+
+	if (std::isnan(alpha) || std::isinf(alpha)) return AffineForm(fx);
+
+	double a=x.itv().lb();
+	double b=x.itv().ub();
+
+	Interval g=(fa-Interval(alpha)*a) | (fb-Interval(alpha)*b);
+
+	if (!t.is_empty()) g |= ft-Interval(alpha)*t;
+
+	if (g.is_empty() || g.is_unbounded()) return AffineForm(fx);
+
+	return linearize(x, alpha, g, fx);
+}
+
+}
+
+AffineForm::AffineForm(const Interval& x) : _center(0), _err(0), _itv(x), affine(true) {
+	if (x.is_empty() || x.is_unbounded()) {
+		_err=POS_INFINITY;
+		affine=false;
+	} else {
+		Interval err(0);
+		_center=split(x,err);
+		_err=err.ub();
+	}
+}
+
+AffineForm::AffineForm(const Interval& x, int i) : _center(0), _err(0), _itv(x), affine(true) {
+	if (x.is_empty() || x.is_unbounded()) {
+		_err=POS_INFINITY;
+		affine=false;
+	} else {
+		Interval rad(0);
+		_center=split(x,rad);
+		if (rad.ub()>0)
+			terms.push_back(pair<int,double>(i,rad.ub()));
+	}
+}
+
+Interval AffineForm::range() const {
+	if (!affine) return Interval::all_reals();
+	return _center+Interval(-1,1)*radius(*this);
+}
+
+void AffineForm::condense(int max_terms) {
+	if (max_terms<0) max_terms=0;
+
+	if (nb_terms()<=max_terms) return;
+
+	// the threshold under which the terms are removed
+	vector<double> mag(nb_terms());
+	for (int k=0; k<nb_terms(); k++)
+		mag[k]=::fabs(terms[k].second);
+	int nb_removed=nb_terms()-max_terms;
+	nth_element(mag.begin(), mag.begin()+nb_removed-1, mag.end());
+	double threshold=mag[nb_removed-1];
+
+	Interval err(_err);
+	vector<pair<int,double> > kept;
+	for (int k=0; k<nb_terms(); k++) {
+		if (nb_removed>0 && ::fabs(terms[k].second)<=threshold) {
+			err += ::fabs(terms[k].second);
+			nb_removed--;
+		} else
+			kept.push_back(terms[k]);
+	}
+	terms.swap(kept);
+	_err=err.ub();
+}
+
+AffineForm operator-(const AffineForm& x) {
+	AffineForm z(x);
+	z._center=-x._center;
+	for (vector<pair<int,double> >::iterator it=z.terms.begin(); it!=z.terms.end(); ++it)
+		it->second=-it->second;
+	z._itv=-x._itv;
+	return z;
+}
+
+AffineForm operator+(const AffineForm& x, const AffineForm& y) {
+	if (!x.affine || !y.affine) return AffineForm(x._itv+y._itv);
+
+	AffineForm z;
+	Interval err=Interval(x._err)+y._err;
+	z._center=split(Interval(x._center)+y._center,err);
+
+	vector<pair<int,double> >::const_iterator i=x.terms.begin();
+	vector<pair<int,double> >::const_iterator j=y.terms.begin();
+
+	while (i!=x.terms.end() || j!=y.terms.end()) {
+		if (j==y.terms.end() || (i!=x.terms.end() && i->first<j->first)) {
+			z.terms.push_back(*i++);
+		} else if (i==x.terms.end() || j->first<i->first) {
+			z.terms.push_back(*j++);
+		} else {
+			double c=split(Interval(i->second)+j->second,err);
+			if (c!=0) z.terms.push_back(pair<int,double>(i->first,c));
+			++i; ++j;
+		}
+	}
+
+	z._err=err.ub();
+	if (std::isinf(z._err)) return AffineForm((x._itv+y._itv));
+	z._itv=(x._itv+y._itv) & z.range();
+	return z;
+}
+
+AffineForm operator-(const AffineForm& x, const AffineForm& y) {
+	return x+(-y);
+}
+
+AffineForm operator*(const AffineForm& x, const AffineForm& y) {
+	if (!x.affine || !y.affine) return AffineForm(x._itv*y._itv);
+
+	AffineForm z;
+	Interval err=abs(Interval(x._center))*y._err + abs(Interval(y._center))*x._err + radius(x)*radius(y);
+
+	z._center=split(Interval(x._center)*y._center,err);
+
+	vector<pair<int,double> >::const_iterator i=x.terms.begin();
+	vector<pair<int,double> >::const_iterator j=y.terms.begin();
+
+	while (i!=x.terms.end() || j!=y.terms.end()) {
+		Interval c;
+		int s;
+		if (j==y.terms.end() || (i!=x.terms.end() && i->first<j->first)) {
+			c=Interval(y._center)*i->second;
+			s=(i++)->first;
+		} else if (i==x.terms.end() || j->first<i->first) {
+			c=Interval(x._center)*j->second;
+			s=(j++)->first;
+		} else {
+			c=Interval(y._center)*i->second + Interval(x._center)*j->second;
+			s=i->first;
+			++i; ++j;
+		}
+		double m=split(c,err);
+		if (m!=0) z.terms.push_back(pair<int,double>(s,m));
+	}
+
+	z._err=err.ub();
+	if (std::isinf(z._err)) return AffineForm((x._itv*y._itv));
+	z._itv=(x._itv*y._itv) & z.range();
+	return z;
+}
+
+AffineForm sqr(const AffineForm& x) {
+	if (!x.affine) return AffineForm(sqr(x._itv));
+
+	// (x0+A+err*u)^2 = x0^2 + 2*x0*A + 2*x0*err*u + (A+err*u)^2
+	// where (A+err*u)^2 is in [0,r^2].
+	AffineForm z;
+	Interval r2=sqr(radius(x))/2;
+	Interval err=2*abs(Interval(x._center))*x._err + r2;
+
+	z._center=split(sqr(Interval(x._center))+r2,err);
+
+	for (vector<pair<int,double> >::const_iterator i=x.terms.begin(); i!=x.terms.end(); ++i) {
+		double c=split(2*Interval(x._center)*i->second,err);
+		if (c!=0) z.terms.push_back(pair<int,double>(i->first,c));
+	}
+
+	z._err=err.ub();
+	if (std::isinf(z._err)) return AffineForm(sqr(x._itv));
+	z._itv=sqr(x._itv) & z.range();
+	return z;
+}
+
+AffineForm linearize(const AffineForm& x, double alpha, const Interval& g, const Interval& fx) {
+	if (!x.affine) return AffineForm(fx);
+
+	AffineForm z;
+	Interval err=::fabs(alpha)*Interval(x._err);
+
+	z._center=split(Interval(alpha)*x._center+g,err);
+
+	for (vector<pair<int,double> >::const_iterator i=x.terms.begin(); i!=x.terms.end(); ++i) {
+		double c=split(Interval(alpha)*i->second,err);
+		if (c!=0) z.terms.push_back(pair<int,double>(i->first,c));
+	}
+
+	z._err=err.ub();
+	if (std::isinf(z._err)) return AffineForm(fx);
+	z._itv=fx & z.range();
+	return z;
+}
+
+AffineForm pow(const AffineForm& x, int p) {
+	if (p==0) return AffineForm(Interval::one());
+	if (p==1) return x;
+	if (p==2) return sqr(x);
+	if (p<0) return inv(pow(x,-p));
+
+	Interval fx=pow(x.itv(),p);
+	if (!linearizable(x,fx)) return AffineForm(fx);
+
+	double a=x.itv().lb();
+	double b=x.itv().ub();
+
+	// x^p is convex if p is even, otherwise convex on R+ and concave on R-
+	if (p%2==1 && a<0 && b>0) return AffineForm(fx);
+
+	Interval fa=pow(Interval(a),p);
+	Interval fb=pow(Interval(b),p);
+	double alpha=slope(a,b,fa,fb);
+
+	// p*t^(p-1)=alpha
+	Interval t=root(abs(Interval(alpha))/p,p-1);
+	if ((p%2==0 && alpha<0) || (p%2==1 && b<=0)) t=-t;
+	t &= x.itv();
+
+	return chebyshev(x,alpha,fa,fb,t,pow(t,p),fx);
+}
+
+AffineForm sqrt(const AffineForm& x) {
+	Interval fx=sqrt(x.itv());
+	if (!linearizable(x,fx) || x.itv().lb()<0) return AffineForm(fx);
+
+	double a=x.itv().lb();
+	double b=x.itv().ub();
+	Interval fa=sqrt(Interval(a));
+	Interval fb=sqrt(Interval(b));
+	double alpha=slope(a,b,fa,fb);
+
+	// 1/(2*sqrt(t))=alpha
+	Interval t=(1.0/(4*sqr(Interval(alpha)))) & x.itv();
+
+	return chebyshev(x,alpha,fa,fb,t,sqrt(t),fx);
+}
+
+AffineForm exp(const AffineForm& x) {
+	Interval fx=exp(x.itv());
+	if (!linearizable(x,fx)) return AffineForm(fx);
+
+	double a=x.itv().lb();
+	double b=x.itv().ub();
+	Interval fa=exp(Interval(a));
+	Interval fb=exp(Interval(b));
+	double alpha=slope(a,b,fa,fb);
+
+	// exp(t)=alpha
+	Interval t=log(Interval(alpha)) & x.itv();
+
+	return chebyshev(x,alpha,fa,fb,t,exp(t),fx);
+}
+
+AffineForm log(const AffineForm& x) {
+	Interval fx=log(x.itv());
+	if (!linearizable(x,fx) || x.itv().lb()<=0) return AffineForm(fx);
+
+	double a=x.itv().lb();
+	double b=x.itv().ub();
+	Interval fa=log(Interval(a));
+	Interval fb=log(Interval(b));
+	double alpha=slope(a,b,fa,fb);
+
+	// 1/t=alpha
+	Interval t=(1.0/Interval(alpha)) & x.itv();
+
+	return chebyshev(x,alpha,fa,fb,t,log(t),fx);
+}
+
+AffineForm inv(const AffineForm& x) {
+	Interval fx=1.0/x.itv();
+	if (!linearizable(x,fx) || x.itv().contains(0)) return AffineForm(fx);
+
+	double a=x.itv().lb();
+	double b=x.itv().ub();
+	Interval fa=1.0/Interval(a);
+	Interval fb=1.0/Interval(b);
+	double alpha=slope(a,b,fa,fb);
+
+	// -1/t^2=alpha
+	Interval t=sqrt(-1.0/Interval(alpha));
+	if (b<0) t=-t;
+	t &= x.itv();
+
+	return chebyshev(x,alpha,fa,fb,t,1.0/t,fx);
+}
+
+std::ostream& operator<<(std::ostream& os, const AffineForm& x) {
+	if (!x.is_affine()) return os << x.itv();
+
+	os << x.center();
+	for (int k=0; k<x.nb_terms(); k++)
+		os << " + " << x.coeff(k) << "*e" << x.symbol(k);
+	return os << " + " << x.err() << "*[-1,1]";
+}
+
+} // namespace ibex
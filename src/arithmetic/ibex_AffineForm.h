@@ -0,0 +1,221 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_AffineForm.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_AFFINE_FORM_H__
+#define __IBEX_AFFINE_FORM_H__
+
+#include "ibex_Interval.h"
+
+#include <vector>
+#include <utility>
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Affine form.
+ *
+ * An affine form represents a quantity x as
+ *
+ *     x0 + x_1*e_1 + ... + x_n*e_n + err*[-1,1]
+ *
+ * where each noise symbol e_i is in [-1,1] and corresponds to the ith variable
+ * of the problem (the variable is x_i=mid_i+rad_i*e_i). Contrary to interval
+ * arithmetic, the dependency between quantities sharing variables is kept
+ * at first order, e.g., x-x is 0.
+ *
+ * The nonlinear errors (and the rounding errors) are accumulated in the single
+ * term err, so that no new noise symbol is ever created ("AF1" arithmetic):
+ * the number of terms is bounded by the number of variables and can be further
+ * reduced with #condense(int).
+ *
+ * An interval enclosure is maintained along with the form (the intersection
+ * of the range of the form with the result of interval arithmetic). If
+ * a quantity is unbounded, only the interval enclosure is kept.
+ *
+ * All the operations are rigorous (rounding errors are taken into account).
+ */
+class AffineForm {
+public:
+	/**
+	 * \brief Create the form [x] (no noise symbol).
+	 */
+	explicit AffineForm(const Interval& x=Interval::zero());
+
+	/**
+	 * \brief Create the form of the variable x_i in [x].
+	 *
+	 * The noise symbol e_i is such that x_i=mid([x])+rad([x])*e_i.
+	 */
+	AffineForm(const Interval& x, int i);
+
+	/**
+	 * \brief The interval enclosure.
+	 */
+	const Interval& itv() const;
+
+	/**
+	 * \brief False if only the interval enclosure is available.
+	 */
+	bool is_affine() const;
+
+	/**
+	 * \brief The center x0.
+	 */
+	double center() const;
+
+	/**
+	 * \brief The number of terms x_i*e_i.
+	 */
+	int nb_terms() const;
+
+	/**
+	 * \brief The noise symbol of the kth term.
+	 */
+	int symbol(int k) const;
+
+	/**
+	 * \brief The coefficient of the kth term.
+	 */
+	double coeff(int k) const;
+
+	/**
+	 * \brief The error term (>=0).
+	 */
+	double err() const;
+
+	/**
+	 * \brief Intersect the interval enclosure with [x].
+	 */
+	AffineForm& operator&=(const Interval& x);
+
+	/**
+	 * \brief Bound the number of terms.
+	 *
+	 * The smallest terms are moved into the error term.
+	 */
+	void condense(int max_terms);
+
+	/**
+	 * \brief Range of the affine part (without intersection with the interval enclosure).
+	 */
+	Interval range() const;
+
+	friend AffineForm operator-(const AffineForm& x);
+	friend AffineForm operator+(const AffineForm& x, const AffineForm& y);
+	friend AffineForm operator-(const AffineForm& x, const AffineForm& y);
+	friend AffineForm operator*(const AffineForm& x, const AffineForm& y);
+	friend AffineForm sqr(const AffineForm& x);
+	friend AffineForm linearize(const AffineForm& x, double alpha, const Interval& g, const Interval& fx);
+
+private:
+	double _center;
+
+	/* Terms (noise symbol, coefficient), by increasing symbol number. */
+	std::vector<std::pair<int,double> > terms;
+
+	double _err;
+
+	Interval _itv;
+
+	bool affine;
+};
+
+/** \ingroup arithmetic */
+/*@{*/
+
+/** \brief -x. */
+AffineForm operator-(const AffineForm& x);
+
+/** \brief x+y. */
+AffineForm operator+(const AffineForm& x, const AffineForm& y);
+
+/** \brief x-y. */
+AffineForm operator-(const AffineForm& x, const AffineForm& y);
+
+/** \brief x*y. */
+AffineForm operator*(const AffineForm& x, const AffineForm& y);
+
+/** \brief x/y. */
+AffineForm operator/(const AffineForm& x, const AffineForm& y);
+
+/** \brief x^2. */
+AffineForm sqr(const AffineForm& x);
+
+/** \brief x^p. */
+AffineForm pow(const AffineForm& x, int p);
+
+/** \brief sqrt(x). */
+AffineForm sqrt(const AffineForm& x);
+
+/** \brief exp(x). */
+AffineForm exp(const AffineForm& x);
+
+/** \brief log(x). */
+AffineForm log(const AffineForm& x);
+
+/** \brief 1/x. */
+AffineForm inv(const AffineForm& x);
+
+/**
+ * \brief Linear approximation alpha*x+g of a function f.
+ *
+ * \param g  - an enclosure of f(t)-alpha*t for all t in x.
+ * \param fx - an interval enclosure of f(x).
+ */
+AffineForm linearize(const AffineForm& x, double alpha, const Interval& g, const Interval& fx);
+
+/** \brief Display the form. */
+std::ostream& operator<<(std::ostream& os, const AffineForm& x);
+
+/*@}*/
+
+/*================================== inline implementations ========================================*/
+
+inline const Interval& AffineForm::itv() const {
+	return _itv;
+}
+
+inline bool AffineForm::is_affine() const {
+	return affine;
+}
+
+inline double AffineForm::center() const {
+	return _center;
+}
+
+inline int AffineForm::nb_terms() const {
+	return (int) terms.size();
+}
+
+inline int AffineForm::symbol(int k) const {
+	return terms[k].first;
+}
+
+inline double AffineForm::coeff(int k) const {
+	return terms[k].second;
+}
+
+inline double AffineForm::err() const {
+	return _err;
+}
+
+inline AffineForm& AffineForm::operator&=(const Interval& x) {
+	_itv &= x;
+	return *this;
+}
+
+inline AffineForm operator/(const AffineForm& x, const AffineForm& y) {
+	return x*inv(y);
+}
+
+} // namespace ibex
+
+#endif // __IBEX_AFFINE_FORM_H__
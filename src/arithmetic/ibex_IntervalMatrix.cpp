@@ -7,14 +7,122 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Jan 6, 2012
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "ibex_IntervalMatrix.h"
 #include "ibex_Agenda.h"
 #include "ibex_TemplateMatrix.h"
 
+#include <vector>
+#include <limits>
+#include <cmath>
+
 namespace ibex {
 
+namespace {
+
+/*
+ * Size of the blocks in the real matrix products.
+ */
+const int BLOCK_SIZE=64;
+
+/*
+ * C += A*B where A is m x n, B is n x p and all the
+ * matrices are stored row by row in contiguous arrays.
+ */
+void gemm(int m, int n, int p, const double* A, const double* B, double* C) {
+	for (int i0=0; i0<m; i0+=BLOCK_SIZE) {
+		int i1=std::min(i0+BLOCK_SIZE,m);
+		for (int k0=0; k0<n; k0+=BLOCK_SIZE) {
+			int k1=std::min(k0+BLOCK_SIZE,n);
+			for (int j0=0; j0<p; j0+=BLOCK_SIZE) {
+				int j1=std::min(j0+BLOCK_SIZE,p);
+				for (int i=i0; i<i1; i++) {
+					double* Ci=C+i*p;
+					for (int k=k0; k<k1; k++) {
+						double a=A[i*n+k];
+						if (a==0) continue;
+						const double* Bk=B+k*p;
+						for (int j=j0; j<j1; j++)
+							Ci[j]+=a*Bk[j];
+					}
+				}
+			}
+		}
+	}
+}
+
+/*
+ * Upper bound of k*eps/(1-k*eps), the relative error of a
+ * sum of k products (whatever the rounding mode is).
+ */
+Interval gamma(int k) {
+	Interval keps=Interval(k)*std::numeric_limits<double>::epsilon();
+	return Interval((keps/(1-keps)).ub());
+}
+
+/*
+ * Split [x] into a midpoint and a radius (upper bound).
+ */
+void mid_rad(const IntervalMatrix& x, std::vector<double>& mid, std::vector<double>& rad) {
+	int p=x.nb_cols();
+	for (int i=0; i<x.nb_rows(); i++)
+		for (int j=0; j<p; j++) {
+			const Interval& xij=x[i][j];
+			double m=xij.mid();
+			mid[i*p+j]=m;
+			rad[i*p+j]=std::max((Interval(xij.ub())-m).ub(), (Interval(m)-xij.lb()).ub());
+		}
+}
+
+/*
+ * Midpoint-radius product <a,r>*<b,s> where r=NULL for a real matrix.
+ *
+ * Let c=fl(a*b). We have |c-a*b| <= gamma_n*|a|*|b| + n*eta, where eta
+ * is the smallest denormalized number. So the exact product belongs to
+ *
+ *  <c, |a|*w + r*t + n*eta> with w>=gamma_n*|b|+s and t>=|b|+s.
+ *
+ * The radius q=fl(|a|*w + r*t) is a sum of 2n nonnegative products, so that
+ * |a|*w + r*t <= (q + 2n*eta)/(1-gamma_{2n}).
+ *
+ * Return false in case of overflow.
+ */
+bool mid_rad_mul(int m, int n, int p, const std::vector<double>& a, const std::vector<double>* r,
+		const std::vector<double>& b, const std::vector<double>& s, IntervalMatrix& res) {
+
+	std::vector<double> abs_a(m*n);
+	for (int i=0; i<m*n; i++) abs_a[i]=::fabs(a[i]);
+
+	Interval gn=gamma(n);
+	std::vector<double> w(n*p), t(n*p);
+	for (int i=0; i<n*p; i++) {
+		w[i]=(gn*::fabs(b[i])+s[i]).ub();
+		t[i]=(Interval(::fabs(b[i]))+s[i]).ub();
+	}
+
+	std::vector<double> c(m*p,0.0), q(m*p,0.0);
+	gemm(m,n,p,&a[0],&b[0],&c[0]);
+	gemm(m,n,p,&abs_a[0],&w[0],&q[0]);
+	if (r) gemm(m,n,p,&(*r)[0],&t[0],&q[0]);
+
+	double eta=std::numeric_limits<double>::denorm_min();
+	Interval g2n=gamma(2*n);
+	Interval err2n=Interval(2*n)*eta;
+	Interval errn=Interval(n)*eta;
+
+	for (int i=0; i<m; i++)
+		for (int j=0; j<p; j++) {
+			if (!std::isfinite(c[i*p+j]) || !std::isfinite(q[i*p+j])) return false;
+			double rad=((q[i*p+j]+err2n)/(1-g2n)+errn).ub();
+			res[i][j]=Interval(c[i*p+j])+Interval(-rad,rad);
+		}
+	return true;
+}
+
+} // end anonymous namespace
+
 IntervalMatrix::IntervalMatrix() : _nb_rows(0), _nb_cols(0), M(NULL) {
 
 }
@@ -399,5 +507,50 @@ double infinite_norm(const IntervalMatrix& m) {
 	return _infinite_normM(m);
 }
 
+IntervalMatrix mid_rad_mul(const Matrix& m1, const IntervalMatrix& m2) {
+	assert(m1.nb_cols()==m2.nb_rows());
+
+	if (m2.is_empty() || m2.is_unbounded()) return m1*m2;
+
+	int m=m1.nb_rows();
+	int n=m1.nb_cols();
+	int p=m2.nb_cols();
+
+	std::vector<double> a(m*n);
+	for (int i=0; i<m; i++)
+		for (int k=0; k<n; k++)
+			a[i*n+k]=m1[i][k];
+
+	std::vector<double> b(n*p), s(n*p);
+	mid_rad(m2,b,s);
+
+	IntervalMatrix res(m,p);
+	if (mid_rad_mul(m,n,p,a,NULL,b,s,res))
+		return res;
+	else
+		return m1*m2;
+}
+
+IntervalMatrix mid_rad_mul(const IntervalMatrix& m1, const IntervalMatrix& m2) {
+	assert(m1.nb_cols()==m2.nb_rows());
+
+	if (m1.is_empty() || m2.is_empty() || m1.is_unbounded() || m2.is_unbounded()) return m1*m2;
+
+	int m=m1.nb_rows();
+	int n=m1.nb_cols();
+	int p=m2.nb_cols();
+
+	std::vector<double> a(m*n), r(m*n);
+	mid_rad(m1,a,r);
+
+	std::vector<double> b(n*p), s(n*p);
+	mid_rad(m2,b,s);
+
+	IntervalMatrix res(m,p);
+	if (mid_rad_mul(m,n,p,a,&r,b,s,res))
+		return res;
+	else
+		return m1*m2;
+}
 
 } // namespace ibex
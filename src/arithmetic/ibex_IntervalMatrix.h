@@ -7,6 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Jan 6, 2012
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __IBEX_INTERVAL_MATRIX_H__
@@ -587,6 +588,37 @@ IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2);
  */
 IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2);
 
+/**
+ * \brief $m_1*[m]_2$ in midpoint-radius arithmetic.
+ *
+ * See #mid_rad_mul(const IntervalMatrix&, const IntervalMatrix&).
+ */
+IntervalMatrix mid_rad_mul(const Matrix& m1, const IntervalMatrix& m2);
+
+/**
+ * \brief $[m]_1*[m]_2$ in midpoint-radius arithmetic.
+ *
+ * With $[m]_1=\langle a,r\rangle$ and $[m]_2=\langle b,s\rangle$
+ * (midpoint and radius matrices), the product is enclosed by (Rump, 1999)
+ *
+ *    $\langle a*b, |a|*s + r*(|b|+s)\rangle$.
+ *
+ * The midpoint and the radius are calculated with three real matrix
+ * products (cache-blocked), the rounding errors being bounded a posteriori
+ * (the result is rigorous whatever the rounding mode is).
+ * This is much faster than the naive product (which performs n^3 interval
+ * operations) for large matrices.
+ *
+ * Overestimation: the radius of the result is at most 1.5 times the
+ * radius of the exact product (it is exact if [m]_1 is a real matrix
+ * or [m]_2 is centered), plus the rounding terms, which are bounded by
+ * n*eps*|a|*|b| (n being the number of columns of [m]_1).
+ *
+ * If one of the matrices is empty or has an unbounded entry, the naive
+ * product is returned.
+ */
+IntervalMatrix mid_rad_mul(const IntervalMatrix& m1, const IntervalMatrix& m2);
+
 /**
  * \brief Outer product (multiplication of a column vector by a row vector).
  */
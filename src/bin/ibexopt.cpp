@@ -8,7 +8,7 @@
 // Author      : Gilles Chabert
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
-// Last Update : Jul 09, 2017
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex.h"
@@ -48,6 +48,8 @@ int main(int argc, char** argv) {
 			"\t\t* 2:\tmore advanced simplifications without developing (can be slow). E.g. x*x + x^2 --> 2x^2\n"
 			"\t\t* 3:\tsimplifications with full polynomial developing (can blow up!). E.g. x*(x-1) + x --> x^2\n"
 			"Default value is : 1.", {"simpl"});
+	args::ValueFlag<double> loup_budget(parser, "float", "Fraction of time under which upper-bounding is never throttled "
+			"(beyond, techniques are run according to their success rate). Default value is 1 (no limit).", {"loup-budget"});
 	args::ValueFlag<double> initial_loup(parser, "float", "Intial \"loup\" (a priori known upper bound).", {"initial-loup"});
 	args::ValueFlag<string> input_file(parser, "filename", "COV input file. The file contains "
 			"optimization data in the COV (binary) format.", {'i',"input"});
@@ -55,6 +57,8 @@ int main(int argc, char** argv) {
 			"optimization data in the COV (binary) format. See --format", {'o',"output"});
 	args::Flag rigor(parser, "rigor", "Activate rigor mode (certify feasibility of equalities).", {"rigor"});
 	args::Flag kkt(parser, "kkt", "Activate contractor based on Kuhn-Tucker conditions.", {"kkt"});
+	args::Flag affine(parser, "affine", "Activate forward-backward contractors with affine arithmetic.", {"affine"});
+	args::Flag mohc(parser, "mohc", "Activate monotonicity-based contractors (for multiple occurrences of variables).", {"mohc"});
 	args::Flag output_no_obj(parser, "output-no-obj", "Generate a COV with domains of variables only (not objective values).", {"output-no-obj"});
 	args::Flag trace(parser, "trace", "Activate trace. Updates of loup/uplo are printed while minimizing.", {"trace"});
 	args::Flag format(parser, "format", "Give a description of the COV format used by IbexOpt", {"format"});
@@ -173,6 +177,24 @@ int main(int argc, char** argv) {
 				cout << "  KKT contractor:\tON" << endl;
 		}
 
+		if (affine) {
+			config.set_affine(affine.Get());
+			if (!quiet)
+				cout << "  affine contractor:\tON" << endl;
+		}
+
+		if (mohc) {
+			config.set_mohc(mohc.Get());
+			if (!quiet)
+				cout << "  mohc contractor:\tON" << endl;
+		}
+
+		if (loup_budget) {
+			config.set_loup_budget(loup_budget.Get());
+			if (!quiet)
+				cout << "  loup budget:\t\t" << loup_budget.Get() << "\t(fraction of time for upper-bounding)" << endl;
+		}
+
 		if (simpl_level)
 			cout << "  symbolic simpl level:\t" << simpl_level.Get() << "\t" << endl;
 
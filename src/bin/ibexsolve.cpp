@@ -8,7 +8,7 @@
 // Author      : Gilles Chabert
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
-// Last Update : Oct 01, 2017
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex.h"
@@ -46,7 +46,9 @@ int main(int argc, char** argv) {
 	args::ValueFlag<string> output_file(parser, "filename", "COV output file. The file will contain the "
 			"description of the manifold with boxes in the COV (binary) format. See --format", {'o',"output"});
 	args::Flag format(parser, "format", "Give a description of the COV format used by IbexSolve", {"format"});
+	args::Flag mohc(parser, "mohc", "Activate monotonicity-based contractors (for multiple occurrences of variables).", {"mohc"});
 	args::Flag bfs(parser, "bfs", "Perform breadth-first search (instead of depth-first search, by default)", {"bfs"});
+	args::Flag compact(parser, "compact", "Store the pending boxes in a compact form (less memory, slightly slower). Useful for large problems.", {"compact"});
 	args::Flag trace(parser, "trace", "Activate trace. \"Solutions\" (output boxes) are displayed as and when they are found.", {"trace"});
 	args::Flag stop_at_first(parser, "stop-a-first", "Stop at first solution/boundary/unknown box found.", {"stop-at-first"});
 	args::ValueFlag<string> boundary_test_arg(parser, "true|full-rank|half-ball|false", "Boundary test strength. Possible values are:\n"
@@ -117,6 +119,9 @@ int main(int argc, char** argv) {
 			if (bfs)
 				cout << "  bfs:\t\t\tON" << endl;
 
+			if (compact)
+				cout << "  compact buffer:\tON" << endl;
+
 			if (stop_at_first)
 				cout << "  stop at first box found" << endl;
 		}
@@ -167,7 +172,12 @@ int main(int argc, char** argv) {
 				eps_x_min ? eps_x_min.Get() : DefaultSolver::default_eps_x_min,
 				eps_x_max ? eps_x_max.Get() : DefaultSolver::default_eps_x_max,
 				!bfs,
-				random_seed? random_seed.Get() : DefaultSolver::default_random_seed);
+				random_seed? random_seed.Get() : DefaultSolver::default_random_seed,
+				mohc,
+				compact);
+
+		if (mohc && !quiet)
+			cout << "  mohc contractor:\tON" << endl;
 
 		if (boundary_test_arg) {
 
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 8, 2012
-// Last Update : Jul 6, 2018
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_BISECTOR_H__
@@ -74,10 +74,11 @@ public:
 	 *
 	 * The information in a cell is e.g., used to get the last bisected variable in case
 	 * the bisector is called by a solver/paver (e.g., RoundRobin).
-	 * Implementation is <b>optional</b>. By default, this function call bisect(cell.box).
-	 * See #bisect(const IntervalVector&).
+	 * Implementation is <b>optional</b>. By default, this function bisects the cell
+	 * with the point given by #choose_var(const Cell&). It can be overridden
+	 * to return children whose boxes are already contracted (see Lookahead).
 	 */
-	std::pair<Cell*,Cell*> bisect(const Cell& cell);
+	virtual std::pair<Cell*,Cell*> bisect(const Cell& cell);
 
 	/**
 	 * \brief Bisect a box and return the result.
@@ -0,0 +1,231 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Lookahead.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_Lookahead.h"
+#include "ibex_ContractContext.h"
+#include "ibex_BoxEvent.h"
+#include "ibex_Threads.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Average ratio between the diameters of the (bounded
+ * and non-degenerated) domains of a child and its parent.
+ * Return 0 if the child is empty.
+ */
+double size_ratio(const IntervalVector& box, const IntervalVector& child) {
+	if (child.is_empty()) return 0;
+
+	double s=0;
+	int n=0;
+	for (int j=0; j<box.size(); j++) {
+		double d=box[j].diam();
+		if (d==0 || d==POS_INFINITY) continue;
+		s += child[j].diam()/d;
+		n++;
+	}
+	return n==0 ? 1 : s/n;
+}
+
+}
+
+Lookahead::Lookahead(Bsc& bsc, Ctc& ctc, int nb_candidates, unsigned int max_depth, int goal_var) :
+		Bsc(0), bsc(bsc), nb_candidates(nb_candidates), max_depth(max_depth), goal_var(goal_var), ctcs(ctc), pool(1),
+		last_cell(NULL), last_box(1), last_var(0), last_pos(0), last_rel_pos(true), last_left(1), last_right(1) {
+
+}
+
+Lookahead::Lookahead(Bsc& bsc, Array<Ctc>& ctcs, int nb_candidates, unsigned int max_depth, int goal_var) :
+		Bsc(0), bsc(bsc), nb_candidates(nb_candidates), max_depth(max_depth), goal_var(goal_var), ctcs(ctcs), pool(ctcs.size()),
+		last_cell(NULL), last_box(1), last_var(0), last_pos(0), last_rel_pos(true), last_left(1), last_right(1) {
+
+}
+
+void Lookahead::add_property(const IntervalVector& init_box, BoxProperties& map) {
+	bsc.add_property(init_box, map);
+}
+
+vector<BisectionPoint> Lookahead::candidates(const Cell& cell) {
+
+	const IntervalVector& box=cell.box;
+
+	vector<BisectionPoint> pts;
+	// may throw NoBisectableVariableException
+	pts.push_back(bsc.choose_var(cell));
+
+	unsigned int first=pts[0].var;
+	double ratio=pts[0].rel_pos ? pts[0].pos : Bsc::default_ratio();
+
+	// other candidates: the largest domains
+	vector<pair<double,int> > dom;
+	for (int i=0; i<box.size(); i++) {
+		if (i==(int) first || i==goal_var || bsc.too_small(box,i)) continue;
+		dom.push_back(make_pair(bsc.uniform_prec()? box[i].diam() : box[i].diam()/bsc.prec(i), -i));
+	}
+
+	// note: -i as second key to favor the first variables in case of tie
+	sort(dom.begin(), dom.end(), greater<pair<double,int> >());
+
+	for (int k=0; k<nb_candidates-1 && k<(int) dom.size(); k++)
+		pts.push_back(BisectionPoint(-dom[k].second, ratio, true));
+
+	return pts;
+}
+
+void Lookahead::contract(const Cell& cell, const vector<BisectionPoint>& pts, vector<IntervalVector>& boxes) {
+
+	const IntervalVector& box=cell.box;
+
+	// same as Cell::bisect(...)
+	for (vector<BisectionPoint>::const_iterator it=pts.begin(); it!=pts.end(); ++it) {
+		if (it->rel_pos) {
+			pair<IntervalVector,IntervalVector> p=box.bisect(it->var,it->pos);
+			boxes.push_back(p.first);
+			boxes.push_back(p.second);
+		} else {
+			boxes.push_back(box);
+			boxes.back()[it->var]=Interval(box[it->var].lb(), it->pos);
+			boxes.push_back(box);
+			boxes.back()[it->var]=Interval(it->pos, box[it->var].ub());
+		}
+	}
+
+	int nb_tasks=(int) boxes.size();
+	int nb_threads=pool.size();
+
+	// The properties of the children are created here (not
+	// by the threads) from those of the cell.
+	vector<BoxProperties*> props(nb_tasks);
+	for (int t=0; t<nb_tasks; t++)
+		props[t]=new BoxProperties(boxes[t], cell.prop);
+
+	// The children are statically distributed among the threads
+	// so that each box is always contracted by the same contractor.
+	pool.run([&](int w) {
+		for (int t=w; t<nb_tasks; t+=nb_threads) {
+			ContractContext context(*props[t]);
+			context.impact.clear();
+			context.impact.add(pts[t/2].var);
+			if (goal_var!=-1) context.impact.add(goal_var);
+			ctcs[w].contract(boxes[t], context);
+		}
+	});
+
+	for (int t=0; t<nb_tasks; t++)
+		delete props[t];
+}
+
+double Lookahead::score(const IntervalVector& box, const IntervalVector& left, const IntervalVector& right) const {
+
+	if (left.is_empty() && right.is_empty())
+		return POS_INFINITY;
+
+	// reduction of the children
+	double s=1-(size_ratio(box,left)+size_ratio(box,right))/2;
+
+	// improvement of the lower bound of the objective
+	if (goal_var!=-1) {
+		const Interval& y=box[goal_var];
+		double lb=std::min(left.is_empty() ? POS_INFINITY : left[goal_var].lb(),
+		                   right.is_empty() ? POS_INFINITY : right[goal_var].lb());
+		if (lb>y.lb()) {
+			if (y.lb()==NEG_INFINITY) s += 1;
+			else if (y.diam()<POS_INFINITY) s += std::min(1.0, (lb-y.lb())/y.diam());
+		}
+	}
+
+	return s;
+}
+
+int Lookahead::select(const IntervalVector& box, const vector<IntervalVector>& boxes) const {
+
+	int best=0;
+	double best_score=score(box,boxes[0],boxes[1]);
+
+	for (int i=1; 2*i<(int) boxes.size(); i++) {
+		double s=score(box,boxes[2*i],boxes[2*i+1]);
+		if (s>best_score) {
+			best=i;
+			best_score=s;
+		}
+	}
+	return best;
+}
+
+BisectionPoint Lookahead::lookahead(const Cell& cell) {
+
+	last_cell=NULL;
+
+	vector<BisectionPoint> pts=candidates(cell);
+
+	if (pts.size()==1) return pts[0];
+
+	vector<IntervalVector> boxes;
+	contract(cell, pts, boxes);
+
+	int best=select(cell.box, boxes);
+
+	last_cell=&cell;
+	last_box=cell.box;
+	last_var=pts[best].var;
+	last_pos=pts[best].pos;
+	last_rel_pos=pts[best].rel_pos;
+	last_left=boxes[2*best];
+	last_right=boxes[2*best+1];
+
+	return pts[best];
+}
+
+BisectionPoint Lookahead::choose_var(const Cell& cell) {
+
+	if (cell.depth>=max_depth)
+		return bsc.choose_var(cell);
+
+	if (cached(cell))
+		return BisectionPoint(last_var,last_pos,last_rel_pos);
+	else
+		return lookahead(cell);
+}
+
+pair<Cell*,Cell*> Lookahead::bisect(const Cell& cell) {
+
+	if (cell.depth>=max_depth)
+		return bsc.bisect(cell);
+
+	// the lookahead may have been performed by choose_var(...)
+	if (!cached(cell)) {
+		BisectionPoint pt=lookahead(cell);
+		if (!last_cell) return cell.bisect(pt);
+	}
+
+	last_cell=NULL;
+
+	pair<Cell*,Cell*> cells=cell.bisect(BisectionPoint(last_var,last_pos,last_rel_pos));
+
+	// the contracted children are reused
+	if (!last_left.is_empty()) {
+		cells.first->box = last_left;
+		cells.first->prop.update(BoxEvent(cells.first->box,BoxEvent::CONTRACT));
+	}
+
+	if (!last_right.is_empty()) {
+		cells.second->box = last_right;
+		cells.second->prop.update(BoxEvent(cells.second->box,BoxEvent::CONTRACT));
+	}
+
+	return cells;
+}
+
+} // end namespace ibex
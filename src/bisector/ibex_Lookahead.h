@@ -0,0 +1,196 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Lookahead.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_LOOKAHEAD_H__
+#define __IBEX_LOOKAHEAD_H__
+
+#include "ibex_Bsc.h"
+#include "ibex_Ctc.h"
+#include "ibex_Array.h"
+#include "ibex_Threads.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup bisector
+ *
+ * \brief Lookahead (strong-branching) bisector.
+ *
+ * Near the root of the search tree (depth less than #max_depth), a few
+ * candidate variables are tentatively bisected and both children are
+ * contracted. The variable with the best combined reduction of the
+ * children (and improvement of the objective lower bound, in optimization)
+ * is selected. Below this depth, the choice is delegated to another
+ * bisector.
+ *
+ * The candidates are the variable chosen by the other bisector and
+ * the variables with the largest domains (relatively to the precision
+ * of the other bisector).
+ *
+ * The children are contracted with the properties of the cell (see
+ * #ibex::BoxProperties). The contracted children of the selected
+ * variable are returned by #bisect(const Cell&), so that the contraction
+ * of the strategy (solver, optimizer) starts from these boxes. An empty
+ * child is returned uncontracted (strategies do not expect empty cells)
+ * and is emptied again by the first contraction. If #choose_var(const Cell&)
+ * is called before #bisect(const Cell&) on the same cell, the lookahead is
+ * only performed once.
+ *
+ * The children can be contracted by several threads in parallel.
+ * A contractor is not thread-safe, so each thread works with its
+ * own contractor. The threads are created with the bisector and
+ * reused at each node (see #ibex::WorkerPool). The properties of the children are created by the
+ * calling thread, the values unchanged by the bisection being shared.
+ */
+class Lookahead : public Bsc {
+public:
+
+	/**
+	 * \brief Create a lookahead bisector.
+	 *
+	 * \param bsc           - bisector used below max_depth, and for the first candidate
+	 * \param ctc           - contractor applied to the children
+	 * \param nb_candidates - number of candidate variables (see #default_nb_candidates)
+	 * \param max_depth     - depth under which the lookahead is performed (see #default_max_depth)
+	 * \param goal_var      - index of the objective variable (in optimization) or -1
+	 */
+	Lookahead(Bsc& bsc, Ctc& ctc, int nb_candidates=default_nb_candidates, unsigned int max_depth=default_max_depth, int goal_var=-1);
+
+	/**
+	 * \brief Create a lookahead bisector using several threads.
+	 *
+	 * Same as before except that the children are contracted by ctcs.size()
+	 * threads, the ith thread using ctcs[i]. The contractors must all be
+	 * equivalent (e.g., built from copies of the same system, see System::COPY).
+	 * The selected variable is the same as with one thread.
+	 */
+	Lookahead(Bsc& bsc, Array<Ctc>& ctcs, int nb_candidates=default_nb_candidates, unsigned int max_depth=default_max_depth, int goal_var=-1);
+
+	/**
+	 * \brief Bisect a cell.
+	 *
+	 * The children are contracted if the lookahead is performed.
+	 */
+	virtual std::pair<Cell*,Cell*> bisect(const Cell& cell);
+
+	using Bsc::bisect;
+
+	/**
+	 * \brief Return next variable to be bisected.
+	 *
+	 * The contracted children are kept for the next call
+	 * to #bisect(const Cell&) with the same cell.
+	 */
+	virtual BisectionPoint choose_var(const Cell& cell);
+
+	/**
+	 * \brief Add the properties required by the other bisector.
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
+
+	/**
+	 * \brief Default number of candidates: 4.
+	 */
+	static constexpr int default_nb_candidates = 4;
+
+	/**
+	 * \brief Default maximal depth: 10.
+	 */
+	static constexpr unsigned int default_max_depth = 10;
+
+	/**
+	 * \brief The other bisector.
+	 */
+	Bsc& bsc;
+
+	/**
+	 * \brief Number of candidate variables.
+	 */
+	const int nb_candidates;
+
+	/**
+	 * \brief Maximal depth of the lookahead.
+	 */
+	const unsigned int max_depth;
+
+	/**
+	 * \brief Objective variable (-1 if none).
+	 */
+	const int goal_var;
+
+protected:
+
+	/*
+	 * Candidate bisection points (the first one is the
+	 * choice of the other bisector).
+	 */
+	std::vector<BisectionPoint> candidates(const Cell& cell);
+
+	/*
+	 * Bisect the box of the cell for each candidate and contract
+	 * the children (with the properties of the cell).
+	 *
+	 * The children of the ith candidate are boxes[2i] and boxes[2i+1].
+	 */
+	void contract(const Cell& cell, const std::vector<BisectionPoint>& pts, std::vector<IntervalVector>& boxes);
+
+	/*
+	 * Perform the lookahead on a cell and return the best bisection point.
+	 *
+	 * The result is stored in the "last_" fields, unless there is only one
+	 * candidate (no lookahead; last_cell is NULL).
+	 */
+	BisectionPoint lookahead(const Cell& cell);
+
+	/*
+	 * True if the last lookahead was performed on this cell.
+	 */
+	bool cached(const Cell& cell) const;
+
+	/*
+	 * Index of the best candidate.
+	 */
+	int select(const IntervalVector& box, const std::vector<IntervalVector>& boxes) const;
+
+	/*
+	 * Score of a candidate (the greater the better).
+	 */
+	double score(const IntervalVector& box, const IntervalVector& left, const IntervalVector& right) const;
+
+	/* one contractor per thread */
+	Array<Ctc> ctcs;
+
+	/* the threads (one per contractor) */
+	WorkerPool pool;
+
+	/*
+	 * Result of the last lookahead: the cell (NULL if none), its box
+	 * (to detect another cell allocated at the same address), the best
+	 * bisection point and the contracted children.
+	 */
+	const Cell* last_cell;
+	IntervalVector last_box;
+	unsigned int last_var;
+	double last_pos;
+	bool last_rel_pos;
+	IntervalVector last_left;
+	IntervalVector last_right;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline bool Lookahead::cached(const Cell& cell) const {
+	return last_cell==&cell && last_box==cell.box;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_LOOKAHEAD_H__
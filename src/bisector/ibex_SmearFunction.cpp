@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : July 19 2012
-// Last Update : May 9 2019
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_SmearFunction.h"
@@ -44,7 +44,7 @@ namespace ibex {
   // returns true if it is not an extended system , the constraint is inactive or it is the objective 
   bool SmearFunction::constraint_to_consider (int i, const IntervalVector & box) const {
     if (i==goal_ctr() && _goal_to_consider==false ) return 0;
-    return (goal_ctr()==-1 || i== goal_ctr() || ((sys.ops[i]==LEQ || sys.ops[i]==LT) && sys.f_ctrs[i].eval(box).ub() >= 0.0));
+    return (goal_ctr()==-1 || i== goal_ctr() || ((sys.ops[i]==LEQ || sys.ops[i]==LT) && sys.f_ctrs.eval(i,box).ub() >= 0.0));
   }
 
   // test to not consider the objective when it is equal  to a variable 
@@ -5,40 +5,58 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Oct, 05 2017
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CellList.h"
 
 namespace ibex {
 
+CellList::CellList(bool compact) : compact(compact) {
+
+}
+
 void CellList::flush() {
 	while (!clist.empty()) {
 		delete clist.front();
 		clist.pop_front();
 	}
+	while (!plist.empty()) {
+		delete plist.front();
+		plist.pop_front();
+	}
+	compactor.clear();
 }
 
 unsigned int CellList::size() const {
-	return clist.size();
+	return compact ? plist.size() : clist.size();
 }
 
 bool CellList::empty() const {
-	return clist.empty();
+	return compact ? plist.empty() : clist.empty();
 }
 
 void CellList::push(Cell* cell) {
 	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
-	clist.push_back(cell);
+	if (compact)
+		plist.push_back(compactor.pack(cell));
+	else
+		clist.push_back(cell);
 }
 
 Cell* CellList::pop() {
+	if (compact) {
+		CompactCell* c = plist.front();
+		plist.pop_front();
+		return compactor.unpack(c);
+	}
 	Cell* c = clist.front();
 	clist.pop_front();
 	return c;
 }
 
 Cell* CellList::top() const {
-	return clist.front();
+	return compact ? plist.front()->get() : clist.front();
 }
 
 } // end namespace ibex
@@ -5,12 +5,14 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Oct, 05 2017
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CELL_LIST_H__
 #define __IBEX_CELL_LIST_H__
 
 #include "ibex_CellBuffer.h"
+#include "ibex_CompactCell.h"
 #include <list>
 
 namespace ibex {
@@ -23,6 +25,15 @@ namespace ibex {
  */
 class CellList : public CellBuffer {
  public:
+  /**
+   * \brief Create an empty list.
+   *
+   * \param compact - if true, the pending cells are stored in
+   *                  a compact form (see #ibex::CellCompactor) and
+   *                  restored by top() or pop().
+   */
+  explicit CellList(bool compact=false);
+
   /** Flush the buffer.
    * All the remaining cells will be *deleted* */
   void flush();
@@ -45,6 +56,14 @@ class CellList : public CellBuffer {
  private:
   /* List of cells */
   std::list<Cell*> clist;
+
+  /* Whether cells are compacted */
+  const bool compact;
+
+  /* List of compact cells (in compact mode) */
+  std::list<CompactCell*> plist;
+
+  CellCompactor compactor;
 };
 
 } // end namespace ibex
@@ -5,41 +5,71 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 12, 2012
-// Last Update : May 12, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CellStack.h"
 
 namespace ibex {
 
+CellStack::CellStack(bool compact) : compact(compact), last(NULL) {
+
+}
+
 void CellStack::flush() {
 	while (!cstack.empty()) {
 		delete cstack.top();
 		cstack.pop();
 	}
+	while (!pstack.empty()) {
+		delete pstack.top();
+		pstack.pop();
+	}
+	if (last) {
+		delete last;
+		last=NULL;
+	}
+	compactor.clear();
 }
 
 unsigned int CellStack::size() const {
-	return cstack.size();
+	return compact ? pstack.size()+(last? 1 : 0) : cstack.size();
 }
 
 bool CellStack::empty() const {
-	return cstack.empty();
+	return compact ? !last && pstack.empty() : cstack.empty();
 }
 
 void CellStack::push(Cell* cell) {
 	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
-	cstack.push(cell);
+	if (compact) {
+		if (last) pstack.push(compactor.pack(last));
+		last=cell;
+	} else
+		cstack.push(cell);
 }
 
 Cell* CellStack::pop() {
+	if (compact) {
+		if (last) {
+			Cell* c = last;
+			last = NULL;
+			return c;
+		}
+		CompactCell* c = pstack.top();
+		pstack.pop();
+		return compactor.unpack(c);
+	}
 	Cell* c = cstack.top();
 	cstack.pop();
 	return c;
 }
 
 Cell* CellStack::top() const {
-	return cstack.top();
+	if (compact)
+		return last ? last : pstack.top()->get();
+	else
+		return cstack.top();
 }
 
 } // end namespace ibex
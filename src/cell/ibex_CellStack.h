@@ -5,13 +5,14 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 12, 2012
-// Last Update : May 12, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CELL_STACK_H__
 #define __IBEX_CELL_STACK_H__
 
 #include "ibex_CellBuffer.h"
+#include "ibex_CompactCell.h"
 #include <stack>
 
 namespace ibex {
@@ -24,6 +25,17 @@ namespace ibex {
  */
 class CellStack : public CellBuffer {
  public:
+  /**
+   * \brief Create an empty stack.
+   *
+   * \param compact - if true, the pending cells are stored in
+   *                  a compact form (see #ibex::CellCompactor) and
+   *                  restored by top() or pop(). The last pushed
+   *                  cell, which is usually popped right after, is
+   *                  only packed when another cell is pushed.
+   */
+  explicit CellStack(bool compact=false);
+
   /** Flush the buffer.
    * All the remaining cells will be *deleted* */
   void flush();
@@ -46,6 +58,17 @@ class CellStack : public CellBuffer {
  private:
   /* Stack of cells */
   std::stack<Cell*> cstack;
+
+  /* Whether cells are compacted */
+  const bool compact;
+
+  /* Stack of compact cells (in compact mode) */
+  std::stack<CompactCell*> pstack;
+
+  /* Last pushed cell, not packed yet (in compact mode) */
+  Cell* last;
+
+  CellCompactor compactor;
 };
 
 } // end namespace ibex
@@ -0,0 +1,151 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CompactCell.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CompactCell.h"
+
+namespace ibex {
+
+namespace {
+
+// bounds are compared (not sets)
+bool same(const Interval& x, const Interval& y) {
+	return x.lb()==y.lb() && x.ub()==y.ub();
+}
+
+}
+
+struct CompactCell::Snapshot {
+	Snapshot(const IntervalVector& box) : n(box.size()), box(new Interval[n]), nb_refs(1) {
+		for (int i=0; i<n; i++) this->box[i]=box[i];
+	}
+
+	~Snapshot() {
+		delete[] box;
+	}
+
+	int n;
+	Interval* box;
+	unsigned int nb_refs;
+};
+
+CompactCell::CompactCell(Cell* cell, Snapshot*& current) : ref(NULL), n(cell->box.size()), k(0), idx(NULL), itv(NULL),
+		bisected_var(cell->bisected_var), depth(cell->depth), cell(cell), _unpacked(false) {
+
+	if (!cell->prop.empty())
+		cell->prop.compact();
+
+	const IntervalVector& box=cell->box;
+
+	if (current && current->n==n) {
+		for (int i=0; i<n; i++)
+			if (!same(box[i],current->box[i])) k++;
+	}
+
+	// the cell becomes the new reference
+	if (current && (current->n!=n || 2*k>n)) {
+		release(current);
+		current=NULL;
+	}
+
+	if (!current) {
+		current=new Snapshot(box);
+		k=0;
+	}
+
+	ref=current;
+	ref->nb_refs++;
+
+	if (k>0) {
+		idx=new int[k];
+		itv=new Interval[k];
+		for (int i=0, j=0; i<n; i++)
+			if (!same(box[i],ref->box[i])) {
+				idx[j]=i;
+				itv[j++]=box[i];
+			}
+	}
+
+	if (cell->prop.empty()) {
+		delete cell;
+		this->cell=NULL;
+	} else
+		// frees the heap storage of large boxes
+		cell->box.resize(1);
+}
+
+void CompactCell::restore(IntervalVector& box) const {
+	for (int i=0; i<n; i++) box[i]=ref->box[i];
+	for (int j=0; j<k; j++) box[idx[j]]=itv[j];
+}
+
+Cell* CompactCell::get() {
+	if (!_unpacked) {
+		if (cell) {
+			cell->box.resize(n);
+			restore(cell->box);
+		} else {
+			IntervalVector box(n);
+			restore(box);
+			cell=new Cell(box, bisected_var, depth);
+		}
+
+		delete[] idx;
+		delete[] itv;
+		idx=NULL;
+		itv=NULL;
+		k=0;
+		_unpacked=true;
+	}
+	return cell;
+}
+
+CompactCell::~CompactCell() {
+	if (cell) delete cell;
+	if (idx) delete[] idx;
+	if (itv) delete[] itv;
+	release(ref);
+}
+
+void CompactCell::release(Snapshot* ref) {
+	if (--ref->nb_refs==0) delete ref;
+}
+
+CellCompactor::CellCompactor() : ref(NULL) {
+
+}
+
+CellCompactor::~CellCompactor() {
+	clear();
+}
+
+CompactCell* CellCompactor::pack(Cell* cell) {
+	return new CompactCell(cell, ref);
+}
+
+Cell* CellCompactor::unpack(CompactCell* c) {
+	// the children of the cell will be
+	// encoded against the same reference.
+	c->ref->nb_refs++;
+	clear();
+	ref=c->ref;
+
+	Cell* cell=c->get();
+	c->cell=NULL;
+	delete c;
+	return cell;
+}
+
+void CellCompactor::clear() {
+	if (ref) {
+		CompactCell::release(ref);
+		ref=NULL;
+	}
+}
+
+} // end namespace ibex
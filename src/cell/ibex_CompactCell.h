@@ -0,0 +1,191 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CompactCell.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_COMPACT_CELL_H__
+#define __IBEX_COMPACT_CELL_H__
+
+#include "ibex_Cell.h"
+
+namespace ibex {
+
+class CellCompactor;
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Compact representation of a pending cell.
+ *
+ * The box is stored as the list of its components that differ from
+ * a reference box, which is shared with other compact cells (see
+ * #ibex::CellCompactor). The box is restored at the first call
+ * to #get().
+ *
+ * The cell object itself is deleted, unless it has properties, in which
+ * case it is kept with a box of size 1 (the properties remain bound to
+ * this box object). The property values that only hold recalculable
+ * data, like a preconditioning matrix, are replaced by light copies
+ * (see #ibex::Bxp::light_copy(...)).
+ *
+ * A compact cell is created by a #ibex::CellCompactor.
+ */
+class CompactCell {
+public:
+
+	/**
+	 * \brief The cell.
+	 *
+	 * The box is restored at the first call.
+	 * The cell is still owned by this object.
+	 */
+	Cell* get();
+
+	/**
+	 * \brief True if the box has been restored.
+	 */
+	bool unpacked() const;
+
+	/**
+	 * \brief Number of components stored.
+	 */
+	int nb_components() const;
+
+	/**
+	 * \brief Delete this (and the cell, if still owned).
+	 */
+	~CompactCell();
+
+protected:
+	friend class CellCompactor;
+
+	/*
+	 * Box shared by several compact cells.
+	 */
+	struct Snapshot;
+
+	/*
+	 * Pack a cell. The cell is owned by this object.
+	 * The reference is replaced by a snapshot of the cell
+	 * if the box differs too much from the reference.
+	 */
+	CompactCell(Cell* cell, Snapshot*& ref);
+
+	/*
+	 * Remove a reference to a snapshot (deleted if not shared anymore).
+	 */
+	static void release(Snapshot* ref);
+
+	/*
+	 * Restore the box from the reference and the components stored.
+	 */
+	void restore(IntervalVector& box) const;
+
+	/* reference box */
+	Snapshot* ref;
+
+	/* size of the box */
+	int n;
+
+	/* number of components stored */
+	int k;
+
+	/* indices of the components stored */
+	int* idx;
+
+	/* values of the components stored */
+	Interval* itv;
+
+	int bisected_var;
+
+	unsigned int depth;
+
+	/* the cell (NULL if not kept) */
+	Cell* cell;
+
+	/* whether the box has been restored */
+	bool _unpacked;
+
+private:
+	CompactCell(const CompactCell&); // forbidden
+};
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Compaction of cells stored in a buffer.
+ *
+ * The children of a cell are usually pushed right after
+ * their parent has been popped and, at this point, they only differ from
+ * the ancestors of the parent by the bisected variable and the
+ * contracted domains. So the box of a cell is encoded against the
+ * reference box of the last popped cell. When more than half of the
+ * components differ, the cell itself becomes the new reference.
+ *
+ * This only fits buffers that do not read the pending boxes (stack,
+ * list) and is only relevant for large boxes or large buffers: packing
+ * and unpacking a cell is linear in the size of the box.
+ *
+ * The order of the packed cells in the buffer is not managed by this
+ * class.
+ */
+class CellCompactor {
+public:
+
+	/**
+	 * \brief Create a compactor.
+	 */
+	CellCompactor();
+
+	/**
+	 * \brief Delete this.
+	 *
+	 * The packed cells are not deleted.
+	 */
+	~CellCompactor();
+
+	/**
+	 * \brief Pack a cell.
+	 *
+	 * The cell is owned by the returned object.
+	 */
+	CompactCell* pack(Cell* cell);
+
+	/**
+	 * \brief Unpack a cell.
+	 *
+	 * The compact cell is deleted and the cell is returned. Its reference
+	 * box becomes the current reference.
+	 */
+	Cell* unpack(CompactCell* c);
+
+	/**
+	 * \brief Drop the current reference.
+	 */
+	void clear();
+
+protected:
+	/* current reference */
+	CompactCell::Snapshot* ref;
+
+private:
+	CellCompactor(const CellCompactor&); // forbidden
+};
+
+/*================================== inline implementations ========================================*/
+
+inline bool CompactCell::unpacked() const {
+	return _unpacked;
+}
+
+inline int CompactCell::nb_components() const {
+	return k;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_COMPACT_CELL_H__
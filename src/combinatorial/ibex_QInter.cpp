@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 25, 2012
-// Last Update : Apr 25, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_QInter.h"
@@ -15,7 +15,243 @@ using namespace std;
 
 namespace ibex {
 
-IntervalVector qinter(const Array<IntervalVector>& _boxes, int q) {
+namespace {
+
+/*
+ * Order of the bounds in a dimension: by increasing value and,
+ * for equal values, lower bounds first (boxes are closed).
+ */
+class BoundOrder {
+public:
+	BoundOrder(const std::vector<Interval>& b, int n, int i) : b(b), n(n), i(i) { }
+
+	double value(int e) const {
+		return e%2==0? b[(e/2)*n+i].lb() : b[(e/2)*n+i].ub();
+	}
+
+	bool operator()(int e1, int e2) const {
+		double v1=value(e1);
+		double v2=value(e2);
+		return v1<v2 || (v1==v2 && e1%2<e2%2);
+	}
+
+	const std::vector<Interval>& b;
+	int n;
+	int i;
+};
+
+} // end anonymous namespace
+
+IntervalVector qinter(const Array<IntervalVector>& boxes, int q) {
+	QInter engine;
+	return engine.qinter(boxes,q);
+}
+
+QInter::QInter() : n(0), nb_boxes(0), cell(1) {
+
+}
+
+IntervalVector QInter::qinter(const Array<IntervalVector>& boxes, int q) {
+	assert(boxes.size()>0);
+
+	bool reuse = (n==boxes[0].size() && nb_boxes==boxes.size());
+
+	n=boxes[0].size();
+	nb_boxes=boxes.size();
+
+	b.resize(nb_boxes*n);
+	alive.resize(nb_boxes);
+	live.clear();
+
+	for (int j=0; j<nb_boxes; j++) {
+		alive[j]=!boxes[j].is_empty();
+		for (int i=0; i<n; i++)
+			// note: bounds of dead boxes are only used for sorting
+			b[j*n+i]= alive[j]? boxes[j][i] : Interval::zero();
+		if (alive[j]) live.push_back(j);
+	}
+
+	if (live.empty()) return IntervalVector::empty(n);
+
+	sort_bounds(reuse);
+
+	if (!projection_filter(q)) return IntervalVector::empty(n);
+
+	// ========== build the grid ==========
+	x.resize(n);
+	size.resize(n);
+	cand.resize(n);
+	cell.resize(n);
+
+	live.clear();
+	for (int j=0; j<nb_boxes; j++)
+		if (alive[j]) live.push_back(j);
+
+	for (int i=0; i<n; i++) {
+		BoundOrder o(b,n,i);
+		x[i].clear();
+		for (std::vector<int>::const_iterator e=order[i].begin(); e!=order[i].end(); ++e) {
+			if (!alive[*e/2]) continue;
+			double v=o.value(*e);
+			if (x[i].empty() || x[i].back()!=v) x[i].push_back(v); // remove duplicates
+		}
+
+		size[i]=x[i].size()-1;
+
+		if (size[i]==0) {
+			// in this special case we force the unique bound to be duplicated
+			// so that we have, at least, one (degenerated) cell.
+			x[i].push_back(x[i][0]);
+			size[i]=1;
+		}
+	}
+
+	// ========== sweep ==========
+	IntervalVector inner_box(n);
+	inner_box.set_empty();
+
+	for (int d=0; d<n; d++) {
+
+		double lb0 = d==0? POS_INFINITY : inner_box[d].lb();
+
+		if (sweep(d, 0, true, lb0, q)) {
+			inner_box |= cell;
+			lb0 = cell[d].lb();
+		}
+
+		if (lb0==POS_INFINITY) {
+			inner_box.set_empty();
+			break;
+		}
+
+		double ub0 = inner_box[d].ub();
+
+		if (sweep(d, 0, false, ub0, q)) {
+			inner_box |= cell;
+			ub0 = cell[d].ub();
+		}
+
+		inner_box[d]=Interval(lb0,ub0);
+	}
+
+	return inner_box;
+}
+
+void QInter::sort_bounds(bool reuse) {
+	order.resize(n);
+
+	for (int i=0; i<n; i++) {
+		std::vector<int>& o=order[i];
+		BoundOrder less(b,n,i);
+
+		if (!reuse || (int) o.size()!=2*nb_boxes) {
+			o.resize(2*nb_boxes);
+			for (int e=0; e<2*nb_boxes; e++) o[e]=e;
+			sort(o.begin(),o.end(),less);
+		} else {
+			// insertion sort (almost linear if the order has not changed much)
+			for (int k=1; k<2*nb_boxes; k++) {
+				int e=o[k];
+				int l=k;
+				while (l>0 && less(e,o[l-1])) {
+					o[l]=o[l-1];
+					l--;
+				}
+				o[l]=e;
+			}
+		}
+	}
+}
+
+bool QInter::projection_filter(int q) {
+	int p=live.size();
+
+	if (p<q) return false;
+
+	bool removed=true;
+
+	while (removed) {
+		removed=false;
+
+		for (int i=0; i<n; i++) {
+			const std::vector<int>& o=order[i];
+			BoundOrder bound(b,n,i);
+
+			// lowest point covered by q projections
+			double lo=POS_INFINITY;
+			int count=0;
+			for (std::vector<int>::const_iterator e=o.begin(); e!=o.end(); ++e) {
+				if (!alive[*e/2]) continue;
+				if (*e%2==0) {
+					if (++count>=q) { lo=bound.value(*e); break; }
+				} else
+					count--;
+			}
+
+			if (lo==POS_INFINITY) return false;
+
+			// highest point covered by q projections
+			double hi=NEG_INFINITY;
+			count=0;
+			for (std::vector<int>::const_reverse_iterator e=o.rbegin(); e!=o.rend(); ++e) {
+				if (!alive[*e/2]) continue;
+				if (*e%2==1) {
+					if (++count>=q) { hi=bound.value(*e); break; }
+				} else
+					count--;
+			}
+
+			// note: the order of bounds is preserved by this intersection
+			Interval hull(lo,hi);
+			for (int j=0; j<nb_boxes; j++) {
+				if (!alive[j]) continue;
+				Interval& bji=b[j*n+i];
+				bji &= hull;
+				if (bji.is_empty()) {
+					alive[j]=false;
+					bji=Interval(lo); // keep valid bounds for sorting
+					removed=true;
+					if (--p<q) return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+bool QInter::sweep(int d, int level, bool lower, double limit, int q) {
+	int i=(d+level)%n;
+
+	const std::vector<int>& parent = level==0? live : cand[level-1];
+	std::vector<int>& current = cand[level];
+
+	for (int c=0; c<size[i]; c++) {
+		int k = lower? c : size[i]-1-c;
+
+		if (level==0 && (lower? x[i][k]>=limit : x[i][k+1]<=limit))
+			return false;
+
+		cell[i]=Interval(x[i][k],x[i][k+1]);
+		double mid=cell[i].mid();
+
+		// boxes containing the current cell in the level+1 first dimensions
+		current.clear();
+		for (std::vector<int>::const_iterator j=parent.begin(); j!=parent.end(); ++j) {
+			if (b[*j*n+i].contains(mid)) current.push_back(*j);
+		}
+
+		// no cell with the same first coordinates can be in the q-intersection
+		if ((int) current.size()<q) continue;
+
+		if (level==n-1 || sweep(d, level+1, lower, limit, q))
+			return true;
+	}
+
+	return false;
+}
+
+IntervalVector qinter_grid(const Array<IntervalVector>& _boxes, int q) {
 	assert(_boxes.size()>0);
 	int n=_boxes[0].size();
 
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 25, 2012
-// Last Update : Apr 25, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_Q_INTER_H__
@@ -16,6 +16,8 @@
 #include "ibex_Array.h"
 #include "ibex_IntStack.h"
 
+#include <vector>
+
 namespace ibex {
 
 /**
@@ -25,9 +27,90 @@ namespace ibex {
 /**
  * \ingroup combinatorial
  * \brief Q-intersection - EXACT - Grid algorithm
+ *
+ * Calls #ibex::QInter::qinter (with no reuse of data between calls).
  */
 IntervalVector qinter(const Array<IntervalVector>& boxes, int q);
 
+/**
+ * \ingroup combinatorial
+ * \brief Q-intersection - EXACT - Grid algorithm (reference version)
+ *
+ * At every cell of the grid, all the p boxes are scanned, so the
+ * complexity is in O((2p)^n*p). Kept for comparison purposes.
+ */
+IntervalVector qinter_grid(const Array<IntervalVector>& boxes, int q);
+
+/**
+ * \ingroup combinatorial
+ * \brief Q-intersection - EXACT - Sweep algorithm
+ *
+ * Same result as the grid algorithm but with the following improvements:
+ * <ul>
+ * <li> projection filter: in each dimension, the boxes are intersected with the
+ *      hull of the points covered by at least q projections (1D sweep line),
+ *      and the boxes that become empty are discarded. This is repeated until
+ *      no more box is removed.
+ * <li> the grid is swept dimension by dimension and the list of boxes
+ *      that contain the current cell projection is built incrementally
+ *      from the list of the previous dimension. As soon as less than q
+ *      boxes remain, all the cells sharing the same first coordinates
+ *      are skipped.
+ * <li> the order of the bounds of the boxes in each dimension is kept from
+ *      one call to the other. When the boxes are slightly modified (e.g.,
+ *      contracted), sorting the new bounds is almost linear.
+ * </ul>
+ *
+ * Note: contrary to the reference version, degenerated q-intersections
+ * (e.g., boxes only sharing a facet) are detected when they are revealed
+ * by the projection filter.
+ */
+class QInter {
+public:
+	/**
+	 * \brief Create the algorithm.
+	 */
+	QInter();
+
+	/**
+	 * \brief Calculate the hull of the q-intersection of the boxes.
+	 */
+	IntervalVector qinter(const Array<IntervalVector>& boxes, int q);
+
+protected:
+	/*
+	 * Sort the bounds of the boxes in each dimension. If "reuse" is true,
+	 * the order of the previous call is used as a starting point.
+	 */
+	void sort_bounds(bool reuse);
+
+	/*
+	 * Projection filter.
+	 * Return false if the q-intersection is empty.
+	 */
+	bool projection_filter(int q);
+
+	/*
+	 * Sweep the cells of the grid from dimension (d+level)%n,
+	 * in increasing order (lower=true) or decreasing order, until
+	 * the first coordinate reaches "limit".
+	 * Return true if a cell intersected by q boxes has been found
+	 * (the cell is then stored in "cell").
+	 */
+	bool sweep(int d, int level, bool lower, double limit, int q);
+
+	int n;                                   // number of variables
+	int nb_boxes;                            // number of boxes (including empty ones)
+	std::vector<Interval> b;                 // the boxes (b[j*n+i] is the ith component of the jth box)
+	std::vector<bool> alive;                 // boxes that are non-empty (and not filtered)
+	std::vector<std::vector<int> > order;    // order[i]: sorted bounds in dimension i (2j for lb of box j, 2j+1 for ub)
+	std::vector<std::vector<double> > x;     // x[i]: distinct bounds in dimension i
+	std::vector<int> size;                   // size[i]: number of intervals in dimension i
+	std::vector<std::vector<int> > cand;     // cand[l]: boxes containing the current cell in the l first dimensions swept
+	std::vector<int> live;                   // list of alive boxes
+	IntervalVector cell;                     // current cell
+};
+
 } // end namespace ibex
 
 
@@ -4,6 +4,7 @@
 // Author      : Gilles Chabert
 // License     : See the LICENSE file
 // Created     : May 29, 2018
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CONTRACT_CONTEXT_H__
@@ -13,8 +14,12 @@
 #include "ibex_BoxProperties.h"
 #include "ibex_BitSet.h"
 
+#include <new>
+
 namespace ibex {
 
+class Ctc;
+
 /**
  * \ingroup ctc
  *
@@ -24,6 +29,11 @@ namespace ibex {
  * than just a simple box.
  *
  * Note: A reference to the box to be contracted is stored in prop.box.
+ *
+ * Note: the impact of a context requires no heap allocation for boxes of
+ * at most 64 variables (see BitSet), and the properties
+ * created by the context are stored inside the object. These properties
+ * are only built if the context is not given existing ones.
  */
 class ContractContext {
 public:
@@ -76,19 +86,38 @@ public:
 	 */
 	BoxProperties& prop;
 
+	/**
+	 * \brief Contractor that has emptied the box (NULL if unknown)
+	 *
+	 * Set by composite contractors (see #CtcCompo) to the innermost
+	 * sub-contractor that has emptied the box. Used for statistics
+	 * (see #SearchTelemetry).
+	 */
+	const Ctc* emptied_by;
+
 protected:
-	const bool own_prop; // for cleanup
+	/*
+	 * Whether the properties have been created by the context
+	 * (in local_prop).
+	 */
+	const bool own_prop;
+
+	/*
+	 * Storage of the properties created by the context (not
+	 * built if the properties are given to the constructor).
+	 */
+	alignas(BoxProperties) char local_prop[sizeof(BoxProperties)];
 };
 
 /*============================================================================
  	 	 	 	 	 	 	 inline implementation
  ============================================================================*/
 
-inline ContractContext::ContractContext(BoxProperties& prop) : impact(BitSet::all(prop.box.size())), output_flags(prop.box.size()), prop(prop), own_prop(false) {
+inline ContractContext::ContractContext(BoxProperties& prop) : impact(BitSet::all(prop.box.size())), output_flags(prop.box.size()), prop(prop), emptied_by(NULL), own_prop(false) {
 
 }
 
-inline ContractContext::ContractContext(const IntervalVector& box) : impact(BitSet::all(box.size())), output_flags(box.size()), prop(*new BoxProperties(box)), own_prop(true) {
+inline ContractContext::ContractContext(const IntervalVector& box) : impact(BitSet::all(box.size())), output_flags(box.size()), prop(*new (local_prop) BoxProperties(box)), emptied_by(NULL), own_prop(true) {
 
 }
 
@@ -96,12 +125,12 @@ inline ContractContext::ContractContext(const ContractContext& c) : ContractCont
 
 }
 
-inline ContractContext::ContractContext(const IntervalVector& box, const ContractContext& c) : impact(c.impact), output_flags(c.output_flags), prop(*new BoxProperties(box, c.prop)), own_prop(true) {
+inline ContractContext::ContractContext(const IntervalVector& box, const ContractContext& c) : impact(c.impact), output_flags(c.output_flags), prop(*new (local_prop) BoxProperties(box, c.prop)), emptied_by(NULL), own_prop(true) {
 
 }
 
 inline ContractContext::~ContractContext() {
-	if (own_prop) delete &prop;
+	if (own_prop) prop.~BoxProperties();
 }
 
 } /* namespace ibex */
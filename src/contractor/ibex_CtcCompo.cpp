@@ -206,6 +206,7 @@ void CtcCompo::contract(IntervalVector& box, ContractContext& context) {
 		}
 
 		if (box.is_empty()) {
+			if (!context.emptied_by) context.emptied_by=&list[i];
 			context.output_flags.clear();
 			context.output_flags.add(FIXPOINT);
 			context.impact =  input_impact; // restore!--> useful?
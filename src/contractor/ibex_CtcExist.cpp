@@ -4,7 +4,7 @@
 // Author      : Jordan Ninin, Gilles Chabert
 // License     : See the LICENSE file
 // Created     : Jan 29, 2014
-// Last Update : May 7, 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CtcExist.h"
@@ -25,23 +25,28 @@ CtcExist::CtcExist(const NumConstraint& ctr, const VarSet& vars, const IntervalV
 CtcExist::CtcExist(Ctc& ctc, const BitSet& vars, const IntervalVector& init_box, double prec, bool own_ctc) :
 	CtcQuantif(ctc, VarSet(ctc.nb_var,vars,true), init_box, prec, own_ctc) {
 }
+bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y, bool& inactive, int w) {
+
+	if (is_empty_cached(x_current, y)) return false;
 
-bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y, ContractContext& context) {
 	IntervalVector x = x_current;
+	IntervalVector y_save = y;
 
 	// TODO: handle impact!
-	bool inactive = CtcQuantif::contract(x, y);
+	bool ctc_inactive = CtcQuantif::contract(w, x, y);
 
 	if (x.is_empty()) {
+		cache_empty(x_current, y_save);
 		return false;
 	}
 
 	// if the contractor for c(x,y) is inactive on [x]*[y]
-	if (inactive) {
+	if (ctc_inactive) {
+		Lock lock(mutex);
 		// ... the contractor for \exists y\in[yinit] c(x) is inactive on [x]
 		if (x==x_init) {
 			x_res =x_init;
-			context.output_flags.add(INACTIVE);
+			inactive = true;
 			return true;
 		} else {
 			x_res |= x;
@@ -49,39 +54,33 @@ bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_cur
 		}
 	}
 
-	if (!x.is_subset(x_res)) {
+	{
+		Lock lock(mutex);
+		if (x.is_subset(x_res)) return false;
+
 		if (y.max_diam()<=prec) {
 			x_res |= x;
-			if (x_res==x_init) return true;
+			return x_res==x_init;
 		}
-		else {
-
-			l.push(pair<IntervalVector,IntervalVector>(x,y));
-
-			// ============================== sampling =============================
-			// To converge faster to the result, we contract with the mid-vector of y.
-			// This allows to get an estimate of "res" without waiting for epsilon-sized
-			// parameter boxes (getting quickly some estimate is important for pruning).
-
-			IntervalVector y_mid = y.mid();
-			CtcQuantif::contract(x,y_mid);  // x may be contracted here; that's why we pushed it on the stack *before* sampling.
+	}
 
-			if (!x.is_empty()) {
+	l.push(pair<IntervalVector,IntervalVector>(x,y));
 
-				x_res |= x;
+	// ============================== sampling =============================
+	// To converge faster to the result, we contract with the mid-vector of y.
+	// This allows to get an estimate of "res" without waiting for epsilon-sized
+	// parameter boxes (getting quickly some estimate is important for pruning).
 
-				if (inactive && (x==x_init)) {
-					context.output_flags.add(INACTIVE);
-					return true;
-				}
+	IntervalVector y_mid = y.mid();
+	CtcQuantif::contract(w, x, y_mid);  // x may be contracted here; that's why we pushed it on the stack *before* sampling.
 
-				if (x_res==x_init) return true;
-			} else {
-				// do nothing
-			}
-			// =======================================================================
-		}
+	if (!x.is_empty()) {
+		Lock lock(mutex);
+		x_res |= x;
+		return x_res==x_init;
 	}
+	// =======================================================================
+
 	return false;
 }
 
@@ -93,44 +92,65 @@ void CtcExist::contract(IntervalVector& box) {
 void CtcExist::contract(IntervalVector& box, ContractContext& context) {
 	assert(box.size()==vars.nb_var);
 
+	check_cache();
+
+	if (is_inactive_cached(box, y_init)) {
+		context.output_flags.add(INACTIVE);
+		return;
+	}
+
+	if (is_empty_cached(box, y_init)) {
+		box.set_empty();
+		context.output_flags.add(FIXPOINT);
+		return;
+	}
+
+	const IntervalVector x_init(box);
+
 	// the returned box, initially empty
 	IntervalVector res=IntervalVector::empty(vars.nb_var);
 
-	assert(l.empty()); // old?--> even when an exception is thrown by this function, l is empty.
+	bool inactive=false;
 
-	l.push(pair<IntervalVector,IntervalVector>(box, y_init));
-	
-	IntervalVector x_save(vars.nb_var);
-	IntervalVector x(vars.nb_var);
+	l.clear(); // in case an exception was thrown by a previous call
+	l.push(pair<IntervalVector,IntervalVector>(x_init, y_init));
 
-	IntervalVector y(vars.nb_param);
-	IntervalVector y_mid(vars.nb_param); // for sampling
+	run_threads(nb_threads, [&](int w) {
+		pair<IntervalVector,IntervalVector> p(x_init, y_init);
+		try {
+			while (l.pop(p)) {
+				// get and immediately bisect the domain of parameters (strategy inspired by Optimizer)
+				pair<IntervalVector,IntervalVector> cut = worker_bsc[w]->bisect(p.second);
 
-	bool stop=false;
+				// proceed with the two sub-boxes for y
+				bool stop=proceed(x_init, p.first, res, cut.first, inactive, w);
+				if (!stop) stop=proceed(x_init, p.first, res, cut.second, inactive, w);
 
-	while ((!stop) && (!l.empty())) {
+				if (stop) l.stop();
+				l.done();
+			}
+		} catch(...) {
+			l.stop(); // terminate the other workers
+			throw;
+		}
+	});
 
-		// get the domain of variables
-		x_save = l.top().first;
-		// get and immediately bisect the domain of parameters (strategy inspired by Optimizer)
-		pair<IntervalVector,IntervalVector> cut = bsc->bisect(l.top().second);
-		
-		l.pop();
+	l.clear();
 
-		// proceed with the two sub-boxes for y
-		stop=proceed(box, x_save, res, cut.first, context);
-		if (!stop) stop=proceed(box, x_save, res, cut.second, context);
+	if (inactive) {
+		context.output_flags.add(INACTIVE);
+		cache_inactive(x_init, y_init);
 	}
 
-	while (!l.empty()) l.pop();
-
 	box &= res;
 
 	if (box.is_empty()) {
+		cache_empty(x_init, y_init);
 		context.output_flags.add(FIXPOINT);
 	}
 
 }
 
 
+
 } // end namespace ibex
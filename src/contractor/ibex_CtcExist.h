@@ -4,7 +4,7 @@
 // Author      : Jordan Ninin, Gilles Chabert
 // License     : See the LICENSE file
 // Created     : Jan 29, 2014
-// Last Update : May 7, 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_EXIST_H__
@@ -12,7 +12,6 @@
 
 #include "ibex_CtcQuantif.h"
 
-#include <stack>
 #include <list>
 
 namespace ibex {
@@ -73,13 +72,15 @@ private:
 	 * \param x_res:     the current state of the overall result (proj-union). Corresponds, at the end, to the result
 	 *                   of the contraction
 	 * \param y:         the current box "y"
+	 * \param inactive:  set to true if the contractor is proven to be inactive
+	 * \param w:         the worker
 	 */
-	bool proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y, ContractContext& context);
+	bool proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y, bool& inactive, int w);
 
 	/**
-	 * Stack of pairs (x,y)
+	 * Stack of pairs (x,y) (shared by the workers)
 	 */
-	std::stack<std::pair<IntervalVector,IntervalVector> > l;
+	WorkStack<std::pair<IntervalVector,IntervalVector> > l;
 
 };
 
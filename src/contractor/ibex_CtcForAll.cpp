@@ -4,7 +4,7 @@
 // Author      : Jordan Ninin, Gilles Chabert
 // License     : See the LICENSE file
 // Created     : Jan 29, 2014
-// Last Update : Jan 29, 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CtcForAll.h"
@@ -15,13 +15,6 @@ using namespace std;
 
 namespace ibex {
 
-namespace {
-
-// as soon as the box is emptied for one value of the parameter
-// the whole contraction gives an empty box.
-class ForAllEmptyBox { };
-
-}
 CtcForAll::CtcForAll(const NumConstraint& ctr,  const ExprNode& y, const IntervalVector& init_box, double prec)
  : CtcQuantif(ctr, VarSet(ctr.f,y,false), init_box, prec) {
 }
@@ -34,27 +27,42 @@ CtcForAll::CtcForAll(Ctc& ctc, const BitSet& vars, const IntervalVector& init_bo
 	CtcQuantif(ctc, VarSet(ctc.nb_var,vars,true), init_box, prec, own_ctc) {
 }
 
-void CtcForAll::proceed(IntervalVector& x, const IntervalVector& y, bool& is_inactive) {
+void CtcForAll::proceed(IntervalVector& x, const IntervalVector& y, bool& is_inactive, int w) {
+
+	// the constraint is already known to be satisfied for all y in [y]
+	if (is_inactive_cached(x, y)) return;
 
 	IntervalVector y_tmp = y.mid();
 
 	// TODO: handle impact!
-	bool tmp_inactive = CtcQuantif::contract(x, y_tmp);
+	bool tmp_inactive = CtcQuantif::contract(w, x, y_tmp);
 
-	if (x.is_empty()) throw ForAllEmptyBox();
+	// as soon as the box is emptied for one value of the parameter
+	// the whole contraction gives an empty box.
+	if (x.is_empty()) return;
 
 	if (y.max_diam()>prec) {
 		assert(y.is_bisectable());
 		l.push(y);
 	} else {
+		bool still_inactive;
+		{
+			Lock lock(mutex);
+			still_inactive = is_inactive;
+		}
 
-		if (is_inactive && tmp_inactive) {
+		if (still_inactive && tmp_inactive) {
 			// try to prove the constraint is inactive for all y in [y]
+			IntervalVector x_save(x);
 			y_tmp = y;
-			is_inactive =  CtcQuantif::contract(x, y_tmp);
-		} else {
-			is_inactive = false;
+			if (CtcQuantif::contract(w, x, y_tmp)) {
+				cache_inactive(x_save, y);
+				return;
+			}
 		}
+
+		Lock lock(mutex);
+		is_inactive = false;
 	}
 }
 
@@ -66,38 +74,72 @@ void CtcForAll::contract(IntervalVector& box) {
 void CtcForAll::contract(IntervalVector& box, ContractContext& context) {
 	assert(box.size()==vars.nb_var);
 
-	assert(l.empty()); // old?--> when an exception is thrown by this function, l is flushed.
+	check_cache();
 
-	l.push(y_init);
+	if (is_empty_cached(box, y_init)) {
+		box.set_empty();
+		context.output_flags.add(FIXPOINT);
+		return;
+	}
 
-	bool is_inactive = true;
-	try {
-		while (!l.empty()) {
+	if (is_inactive_cached(box, y_init)) {
+		context.output_flags.add(INACTIVE);
+		return;
+	}
 
-			// get and immediately bisect the domain of parameters (strategy inspired by Optimizer)
-			try {
-				pair<IntervalVector,IntervalVector> cut = bsc->bisect(l.top());
+	const IntervalVector x_init(box);
 
-				l.pop();
+	bool is_inactive = true;
+
+	l.clear(); // in case an exception was thrown by a previous call
+	l.push(y_init);
 
-				// proceed with the two sub-boxes for y
-				proceed(box, cut.first, is_inactive);
-				proceed(box, cut.second, is_inactive);
-			} catch(NoBisectableVariableException& e) { // e.g.: if y_init is degenerated
-				proceed(box, l.top(), is_inactive); // nothing should be pushed in the queue
-				l.pop();
+	run_threads(nb_threads, [&](int w) {
+		IntervalVector x(x_init);
+		IntervalVector y(y_init);
+		try {
+			while (l.pop(y)) {
+				{
+					Lock lock(mutex);
+					x = box;
+				}
+
+				// get and immediately bisect the domain of parameters (strategy inspired by Optimizer)
+				try {
+					pair<IntervalVector,IntervalVector> cut = worker_bsc[w]->bisect(y);
+
+					// proceed with the two sub-boxes for y
+					proceed(x, cut.first, is_inactive, w);
+					if (!x.is_empty()) proceed(x, cut.second, is_inactive, w);
+				} catch(NoBisectableVariableException& e) { // e.g.: if y_init is degenerated
+					proceed(x, y, is_inactive, w); // nothing should be pushed in the queue
+				}
+
+				{
+					Lock lock(mutex);
+					box &= x;
+					if (box.is_empty()) l.stop();
+				}
+				l.done();
 			}
+		} catch(...) {
+			l.stop(); // terminate the other workers
+			throw;
 		}
-	} catch (ForAllEmptyBox& e) {
-		assert(box.is_empty());
+	});
 
-		while (!l.empty()) l.pop();
+	l.clear();
 
+	if (box.is_empty()) {
+		cache_empty(x_init, y_init);
 		context.output_flags.add(FIXPOINT);
 		return;
 	}
 
-	if (is_inactive) context.output_flags.add(INACTIVE);
+	if (is_inactive) {
+		context.output_flags.add(INACTIVE);
+		cache_inactive(box, y_init);
+	}
 
 }
 
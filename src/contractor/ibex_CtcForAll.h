@@ -4,7 +4,7 @@
 // Author      : Jordan Ninin, Gilles Chabert
 // License     : See the LICENSE file
 // Created     : Jan 29, 2014
-// Last Update : Aug 21, 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_FORALL_H__
@@ -12,8 +12,6 @@
 
 #include "ibex_CtcQuantif.h"
 
-#include <stack>
-
 namespace ibex {
 
 /**
@@ -65,17 +63,19 @@ private:
 	/**
 	 * Function call by contract to proceed a pair (x,y).
 	 *
-	 * The overall result x is updated and, if large enough, y is pushed in the list "l".
+	 * The box x is contracted and, if large enough, y is pushed in the list "l".
 	 *
-	 * \param x:   the current box "x". Corresponds, at the end, to the result of the contraction
+	 * \param x:   the current box "x" of the worker.
 	 * \param y:   the current box "y"
+	 * \param is_inactive: set to false if the constraint is not proven to be satisfied for all y in [y]
+	 * \param w:   the worker
 	 */
-	void proceed(IntervalVector& x, const IntervalVector& y, bool& is_inactive);
+	void proceed(IntervalVector& x, const IntervalVector& y, bool& is_inactive, int w);
 
 	/**
-	 * Stack of y
+	 * Stack of y (shared by the workers)
 	 */
-	std::stack<IntervalVector> l;
+	WorkStack<IntervalVector> l;
 
 };
 
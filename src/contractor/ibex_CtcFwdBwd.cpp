@@ -7,12 +7,14 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Feb 27, 2012
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_BxpActiveCtr.h"
 #include "ibex_BxpSystemCache.h"
 #include "ibex_ExprCopy.h"
+#include "ibex_AffineFormEval.h"
 
 using namespace std;
 
@@ -68,6 +70,7 @@ CtcFwdBwd::~CtcFwdBwd() {
 	delete input;
 	delete output;
 	if (own_ctr) delete &ctr;
+	if (affine) delete affine;
 }
 
 void CtcFwdBwd::init() {
@@ -75,6 +78,7 @@ void CtcFwdBwd::init() {
 //	output = new BitSet(ctr.f.used_vars);
 	input = new BitSet(nb_var);
 	output = new BitSet(nb_var);
+	affine = NULL;
 	
 	for (vector<int>::const_iterator it=ctr.f.used_vars.begin(); it!=ctr.f.used_vars.end(); it++) {
 		output->add(*it);
@@ -94,12 +98,21 @@ void CtcFwdBwd::add_property(const IntervalVector& init_box, BoxProperties& map)
 //
 /*	if (ctr_num==-1) {
 		if (ctr.op!=EQ && !map[active_prop_id])
-		map.add(new BxpActiveCtr(init_box, ctr));
+		map.add(new BxpActiveCtr(ctr));
 	} else {
 		// the system cache is added at higher level
 	}*/
 }
 
+void CtcFwdBwd::set_affine(bool a) {
+	if (a && !affine)
+		affine = new AffineFormEval(ctr.f.basic_evaluator());
+	else if (!a && affine) {
+		delete affine;
+		affine = NULL;
+	}
+}
+
 void CtcFwdBwd::contract(IntervalVector& box) {
 	ContractContext context(box);
 	contract(box,context);
@@ -130,7 +143,11 @@ void CtcFwdBwd::contract(IntervalVector& box, ContractContext& context) {
 	}
 
 	//std::cout << " hc4 of " << f << "=" << d << " with box=" << box << std::endl;
-	if (ctr.f.backward(d,box)) {
+	// only the impacted variables are propagated in the forward phase
+	// (unless the forward phase is performed with affine arithmetic)
+	bool inactive = affine ? ctr.f.hc4revise().proj(d,box,*affine) : ctr.f.backward(d,box,context.impact);
+
+	if (inactive) {
 		if (p) p->set_inactive();
 		if (sp) sp->active_ctrs().remove(ctr_num);
 		context.output_flags.add(INACTIVE);
@@ -7,6 +7,7 @@
  *
  * Author(s)   : Gilles Chabert, Jordan Ninin
  * Created     : Feb 27, 2012
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __IBEX_CTC_FWDBWD_H__
@@ -17,6 +18,8 @@
 
 namespace ibex {
 
+class AffineFormEval;
+
 /**
  * \ingroup contractor
  * \brief Forward-backward contractor (HC4Revise).
@@ -86,6 +89,21 @@ public:
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
 
+	/**
+	 * \brief Perform the forward phase with affine arithmetic.
+	 *
+	 * The domains of the nodes are sharpened with affine forms and
+	 * the box is further contracted with the linear relaxation of the
+	 * constraint (see HC4Revise::proj(const Domain&, IntervalVector&, AffineFormEval&)).
+	 *
+	 * This is more costly but generally more effective on boxes with
+	 * small diameters and constraints with multiple occurrences of
+	 * variables. The incremental forward is disabled.
+	 *
+	 * By default: false.
+	 */
+	void set_affine(bool affine);
+
 	/*
 	 * \brief Whether this contractor is idempotent (optional)
 	 */
@@ -117,6 +135,9 @@ protected:
 
 	/* Just to avoid a copy when ctr is given to the constructor. */
 	bool own_ctr;
+
+	/* Affine evaluator (NULL if disabled). */
+	AffineFormEval* affine;
 };
 
 } // namespace ibex
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 20, 2017
-// Created     : Jul 11, 2019
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CtcKuhnTucker.h"
@@ -18,11 +18,25 @@ using namespace std;
 
 namespace ibex {
 
-CtcKuhnTucker::CtcKuhnTucker(const NormalizedSystem& sys, bool reject_unbounded) : Ctc(sys.nb_var+1 /* extended box expected*/), sys(sys), reject_unbounded(reject_unbounded) {
+CtcKuhnTucker::CtcKuhnTucker(const NormalizedSystem& sys, bool reject_unbounded) : Ctc(sys.nb_var+1 /* extended box expected*/), sys(sys),
+		dg(NULL), hf(NULL), hg(NULL), reject_unbounded(reject_unbounded) {
+
+	try {
+		hf = new Hessian(sys.goal->basic_evaluator());
+		if (sys.nb_ctr>0)
+			hg = new Hessian(sys.f_ctrs.basic_evaluator());
+	} catch(Hessian::Unsupported&) {
+		// resort to symbolic differentiation
+		if (hf) delete hf;
+		hf = NULL;
+	}
+
 	try {
 		df = new Function(*sys.goal,Function::DIFF);
 
-		if (sys.nb_ctr>0) {
+		// symbolic gradients of constraints are only required
+		// if the Hessians cannot be calculated automatically
+		if (!hf && sys.nb_ctr>0) {
 			dg = new Function*[sys.f_ctrs.image_dim()];
 
 			for (int i=0; i<sys.f_ctrs.image_dim(); i++) {
@@ -42,6 +56,8 @@ CtcKuhnTucker::CtcKuhnTucker(const NormalizedSystem& sys, bool reject_unbounded)
 }
 
 CtcKuhnTucker::~CtcKuhnTucker() {
+	if (hf) delete hf;
+	if (hg) delete hg;
 	if (df) delete df;
 	if (dg!=NULL) {
 		for (int i=0; i<sys.f_ctrs.image_dim(); i++)
@@ -62,7 +78,18 @@ void CtcKuhnTucker::contract(IntervalVector& box) {
 
 	IntervalVector x=box.subvector(0,n-1);
 
-	FncKuhnTucker fkkt(sys,*df,dg,x);
+	if (hf) {
+		FncKuhnTucker fkkt(sys,*hf,hg,x);
+		contract(box,x,fkkt);
+	} else {
+		FncKuhnTucker fkkt(sys,*df,dg,x);
+		contract(box,x,fkkt);
+	}
+}
+
+void CtcKuhnTucker::contract(IntervalVector& box, IntervalVector& x, FncKuhnTucker& fkkt) {
+
+	int n=sys.nb_var;
 
 	if (fkkt.nb_mult==1) { // <=> no active constraint
 		// for unconstrained optimization we benefit from a cheap
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 19, 2017
-// Created     : Jul 11, 2019
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_KUHN_TUCKER_H__
@@ -32,10 +32,14 @@ public:
 	 * an "extended" box in the "contract" function (in order to be uniform with
 	 * all other contractors in optimization).
 	 *
-	 * \warning: building this object is **costly** in both time and memory!
-	 *           (symbolic derivation of all constraints, because Ibex does not
-	 *           have automatic hessian computation).
-	 *           Don't build this contractor on-the-fly.
+	 * The Hessian of the Lagrangian is calculated by automatic differentiation
+	 * (see #ibex::Hessian). Only if this is not possible (e.g., a constraint
+	 * involves a sub-function call), the contractor resorts to symbolic
+	 * derivation of all constraints.
+	 *
+	 * \warning: building this object requires symbolic derivation of the objective
+	 *           (and possibly of all constraints, see above). Don't build this
+	 *           contractor on-the-fly.
 	 *
 	 * \warning: sys.box should be properly set before calling this constructor.
 	 *           In particular, this field **should not change** once this
@@ -65,6 +69,11 @@ public:
 
 protected:
 
+	/**
+	 * \brief Contract with the KKT function built for the box x.
+	 */
+	void contract(IntervalVector& box, IntervalVector& x, FncKuhnTucker& fkkt);
+
 	/**
 	 * \brief The (normalized) NLP problem.
 	 */
@@ -77,9 +86,22 @@ protected:
 
 	/**
 	 * \brief Symbolic gradient of constraints.
+	 *
+	 * NULL if the Hessians are calculated by automatic differentiation.
 	 */
 	Function** dg;
 
+	/**
+	 * \brief Hessian of the objective (NULL if not supported).
+	 */
+	Hessian* hf;
+
+	/**
+	 * \brief Hessian of the constraints (NULL if not supported
+	 *        or unconstrained problem).
+	 */
+	Hessian* hg;
+
 	/**
 	 * \brief Whether unbounded boxes are rejected.
 	 *
@@ -0,0 +1,225 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcMohc.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CtcMohc.h"
+#include "ibex_ExprOccCounter.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Count the occurrences of one component of a symbol.
+ */
+class VarOccCounter : public ExprOccCounter {
+public:
+	VarOccCounter(const ExprSymbol& x, int k) : x(x), k(k) { }
+
+	~VarOccCounter() {
+		for (IBEX_NODE_MAP(Matrix*)::iterator it=cache.begin(); it!=cache.end(); ++it)
+			delete it->second;
+	}
+
+	using ExprOccCounter::visit;
+
+protected:
+	Matrix* visit(const ExprSymbol& e) {
+		Matrix* m=new Matrix(e.dim.nb_rows(), e.dim.nb_cols(), 0.);
+		if (&e==&x) (*m)[k/e.dim.nb_cols()][k%e.dim.nb_cols()]=1;
+		return m;
+	}
+
+	const ExprSymbol& x;
+	int k;
+};
+
+}
+
+CtcMohc::CtcMohc(const Function& f, CmpOp op, double tau_mohc, double eps) : Ctc(f.nb_var()),
+		fwdbwd(f,op), ctr(fwdbwd.ctr), tau_mohc(tau_mohc), eps(eps) {
+	init();
+}
+
+CtcMohc::CtcMohc(const NumConstraint& ctr, double tau_mohc, double eps) : Ctc(ctr.f.nb_var()),
+		fwdbwd(ctr), ctr(ctr), tau_mohc(tau_mohc), eps(eps) {
+	init();
+}
+
+CtcMohc::CtcMohc(const System& sys, int i, double tau_mohc, double eps) : Ctc(sys.nb_var),
+		fwdbwd(sys,i), ctr(sys.ctrs[i]), tau_mohc(tau_mohc), eps(eps) {
+	init();
+}
+
+CtcMohc::~CtcMohc() {
+	delete input;
+	delete output;
+}
+
+void CtcMohc::init() {
+	input = new BitSet(nb_var);
+	output = new BitSet(nb_var);
+
+	for (vector<int>::const_iterator it=ctr.f.used_vars.begin(); it!=ctr.f.used_vars.end(); it++) {
+		output->add(*it);
+		input->add(*it);
+	}
+
+	scalar = ctr.f.expr().dim.is_scalar();
+
+	mono.resize(nb_var,0);
+
+	if (!scalar) return;
+
+	y = ctr.right_hand_side().i();
+
+	// index of the first component of each argument
+	int first=0;
+	for (int i=0; i<ctr.f.nb_arg(); i++) {
+		const ExprSymbol& x=ctr.f.arg(i);
+		for (int k=0; k<x.dim.size(); k++) {
+			if (ctr.f.used(first+k)) {
+				VarOccCounter c(x,k);
+				if (c.total(c.count(ctr.f.expr()))>1)
+					multi.push_back(first+k);
+			}
+		}
+		first += x.dim.size();
+	}
+}
+
+void CtcMohc::add_property(const IntervalVector& init_box, BoxProperties& map) {
+	fwdbwd.add_property(init_box,map);
+}
+
+void CtcMohc::contract(IntervalVector& box) {
+	ContractContext context(box);
+	contract(box,context);
+}
+
+void CtcMohc::contract(IntervalVector& box, ContractContext& context) {
+
+	fwdbwd.contract(box,context);
+
+	if (box.is_empty() || context.output_flags[INACTIVE] || multi.empty())
+		return;
+
+	if (mohc_revise(box)) {
+		if (box.is_empty())
+			context.output_flags.add(FIXPOINT);
+		context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
+	}
+}
+
+bool CtcMohc::mohc_revise(IntervalVector& box) {
+
+	IntervalVector g=ctr.f.gradient(box);
+	if (g.is_empty()) return false;
+
+	IntervalVector xmin(box);
+	IntervalVector xmax(box);
+
+	bool mono_multi=false; // is there a monotone multi-occurring variable?
+
+	for (vector<int>::const_iterator it=ctr.f.used_vars.begin(); it!=ctr.f.used_vars.end(); it++) {
+		int j=*it;
+		if (g[j].lb()>=0)      mono[j]=1;
+		else if (g[j].ub()<=0) mono[j]=-1;
+		else                   mono[j]=0;
+
+		if (mono[j]!=0) {
+			xmin[j]=mono[j]==1 ? box[j].lb() : box[j].ub();
+			xmax[j]=mono[j]==1 ? box[j].ub() : box[j].lb();
+		}
+	}
+
+	for (vector<int>::const_iterator it=multi.begin(); it!=multi.end(); it++)
+		if (mono[*it]!=0) mono_multi=true;
+
+	if (!mono_multi) return false;
+
+	Interval fmin=ctr.f.eval(xmin);
+	Interval fmax=ctr.f.eval(xmax);
+
+	if (fmin.is_empty() || fmax.is_empty()) return false;
+
+	if (fmin.lb()>y.ub() || fmax.ub()<y.lb()) {
+		box.set_empty();
+		return true;
+	}
+
+	// the monotonic range is not sharp enough: not worth shaving
+	Interval fx=ctr.f.eval(box);
+	if (!(Interval(fmin.lb(),fmax.ub()).diam() < tau_mohc*fx.diam()))
+		return false;
+
+	IntervalVector save(box);
+
+	for (vector<int>::const_iterator it=multi.begin(); it!=multi.end(); it++) {
+		int j=*it;
+		if (mono[j]==0 || box[j].is_unbounded() || box[j].is_degenerated()) continue;
+
+		// increasing: the lower bound of x_j is bounded by f(xmax) >= y.lb
+		// and the upper bound by f(xmin) <= y.ub (and conversely).
+		shave(box, j, mono[j]==1 ? xmax : xmin, true,  mono[j]==1);
+		if (box.is_empty()) return true;
+		shave(box, j, mono[j]==1 ? xmin : xmax, false, mono[j]==-1);
+		if (box.is_empty()) return true;
+
+		xmin[j]=mono[j]==1 ? box[j].lb() : box[j].ub();
+		xmax[j]=mono[j]==1 ? box[j].ub() : box[j].lb();
+	}
+
+	return box!=save;
+}
+
+bool CtcMohc::infeasible(IntervalVector& corner, int j, double t, bool upper) {
+	Interval tmp=corner[j];
+	corner[j]=t;
+	Interval fx=ctr.f.eval(corner);
+	corner[j]=tmp;
+	// note: an empty image is not considered as infeasible
+	// (not necessarily monotone outside the definition domain)
+	return !fx.is_empty() && (upper ? fx.ub()<y.lb() : fx.lb()>y.ub());
+}
+
+void CtcMohc::shave(IntervalVector& box, int j, IntervalVector& corner, bool left, bool upper) {
+
+	double lb=box[j].lb();
+	double ub=box[j].ub();
+
+	// the first bound (not removed yet)
+	double a=left ? lb : ub;
+	// the opposite bound
+	double b=left ? ub : lb;
+
+	if (!infeasible(corner, j, a, upper)) return;
+
+	if (infeasible(corner, j, b, upper)) {
+		box.set_empty();
+		return;
+	}
+
+	double prec=eps*box[j].diam();
+
+	// invariant: the slice between the first bound and a can be removed
+	//            and b is not proven infeasible.
+	while (::fabs(b-a)>prec) {
+		double m=(left ? Interval(a,b) : Interval(b,a)).mid();
+		if (m==a || m==b) break;
+		if (infeasible(corner, j, m, upper)) a=m;
+		else b=m;
+	}
+
+	if (left) box[j]=Interval(a,ub);
+	else box[j]=Interval(lb,a);
+}
+
+} // namespace ibex
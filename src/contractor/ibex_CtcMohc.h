@@ -0,0 +1,165 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcMohc.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_MOHC_H__
+#define __IBEX_CTC_MOHC_H__
+
+#include "ibex_CtcFwdBwd.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ *
+ * \brief Monotonicity-based contractor (Mohc).
+ *
+ * Forward-backward (HC4Revise) is optimal only when each variable occurs
+ * once in the constraint. This contractor further exploits the
+ * monotonicity of the constraint f(x) in [y] w.r.t. the variables that
+ * occur several times, detected with the interval gradient of f.
+ *
+ * After a forward-backward contraction, the variables w.r.t. which f is
+ * monotone are replaced by their bounds to obtain two "corners" xmin and
+ * xmax of the box, so that [f(xmin).lb, f(xmax).ub] is a sharper range of
+ * f than the natural interval evaluation. If this range is significantly
+ * sharper (see #tau_mohc), each monotone multi-occurring variable is shaved
+ * from both sides: the smallest and largest values for which the corners
+ * are compatible with [y] are found by dichotomy (see #eps).
+ *
+ * Only scalar constraints are concerned. With vector or matrix-valued
+ * functions, this contractor only performs forward-backward.
+ *
+ * Reference: I. Araya, G. Trombettoni, B. Neveu, "Exploiting Monotonicity
+ * in Interval Constraint Propagation", AAAI 2010.
+ */
+class CtcMohc : public Ctc {
+protected:
+	/* Forward-backward contractor (run first).
+	 * Declared first because it builds #ctr. */
+	CtcFwdBwd fwdbwd;
+
+public:
+	/**
+	 * \brief Build the contractor for "f(x)=0" or "f(x)<=0".
+	 *
+	 * \param op: by default: EQ.
+	 */
+	CtcMohc(const Function& f, CmpOp op=EQ, double tau_mohc=default_tau_mohc, double eps=default_eps);
+
+	/**
+	 * \remark ctr is kept by reference.
+	 */
+	CtcMohc(const NumConstraint& ctr, double tau_mohc=default_tau_mohc, double eps=default_eps);
+
+	/**
+	 * \brief Build the contrator for the ith constraint of a system.
+	 */
+	CtcMohc(const System& sys, int i, double tau_mohc=default_tau_mohc, double eps=default_eps);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~CtcMohc();
+
+	/**
+	 * \brief Contract a box.
+	 */
+	void contract(IntervalVector& box);
+
+	/**
+	 * \brief Contract the box.
+	 */
+	virtual void contract(IntervalVector& box, ContractContext& context);
+
+	/**
+	 * \brief Add the properties of forward-backward.
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
+
+	/**
+	 * \brief The variables that occur several times in the constraint.
+	 */
+	const std::vector<int>& multi_occ_vars() const;
+
+	/** The constraint. */
+	const NumConstraint& ctr;
+
+	/**
+	 * \brief Monotonicity ratio.
+	 *
+	 * The shaving is only performed if the diameter of
+	 * [f(xmin).lb, f(xmax).ub] is less than tau_mohc times
+	 * the diameter of the natural evaluation of f. With 1, the
+	 * shaving is performed as soon as a multi-occurring variable
+	 * is monotone.
+	 */
+	const double tau_mohc;
+
+	/**
+	 * \brief Relative precision of the shaving.
+	 *
+	 * The dichotomy stops when the current slice is smaller
+	 * than eps times the diameter of the variable domain.
+	 */
+	const double eps;
+
+	/** Default monotonicity ratio: 0.9. */
+	static constexpr double default_tau_mohc = 0.9;
+
+	/** Default relative precision of the shaving: 0.1. */
+	static constexpr double default_eps = 0.1;
+
+protected:
+	void init();
+
+	/*
+	 * Shave the monotone multi-occurring variables.
+	 * Set the box to empty if the constraint is proven infeasible.
+	 * Return true iff the box has been contracted.
+	 */
+	bool mohc_revise(IntervalVector& box);
+
+	/*
+	 * Shave the left (resp. right) bound of the jth variable.
+	 * If upper is true, the slices are removed when the upper bound
+	 * of f(corner) with x_j=t is less than y; otherwise when the lower
+	 * bound is greater than y.
+	 */
+	void shave(IntervalVector& box, int j, IntervalVector& corner, bool left, bool upper);
+
+	/*
+	 * Whether the constraint is violated by the corner with x_j=t.
+	 */
+	bool infeasible(IntervalVector& corner, int j, double t, bool upper);
+
+	/* Right-hand side of the constraint (if scalar) */
+	Interval y;
+
+	/* Whether the constraint is scalar. */
+	bool scalar;
+
+	/* Variables (indices) occurring more than once. */
+	std::vector<int> multi;
+
+	/* Monotonicity of f w.r.t. each variable: 1 (increasing),
+	 * -1 (decreasing) or 0 (unknown). */
+	std::vector<int> mono;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline const std::vector<int>& CtcMohc::multi_occ_vars() const {
+	return multi;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_CTC_MOHC_H__
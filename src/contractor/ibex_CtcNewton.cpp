@@ -5,16 +5,18 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 24, 2012
-// Last Update : May 24, 2012
+// Last Update : Oct 19, 2026
 //====================================f========================================
 
 #include "ibex_CtcNewton.h"
 #include "ibex_Exception.h"
+#include "ibex_Id.h"
+#include "ibex_BxpPrecond.h"
 
 namespace ibex {
 
 CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), vars(NULL), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+		Ctc(f.nb_var()), f(f), vars(NULL), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio), precond_id(next_id()) {
 
 	if (f.nb_var()!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
@@ -22,7 +24,7 @@ CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
 }
 
 CtcNewton::CtcNewton(const Fnc& f, const VarSet& vars, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), vars(&vars), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+		Ctc(f.nb_var()), f(f), vars(&vars), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio), precond_id(next_id()) {
 
 	if (vars.nb_var!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
@@ -34,13 +36,20 @@ void CtcNewton::contract(IntervalVector& box) {
 	contract(box,context);
 }
 
+void CtcNewton::add_property(const IntervalVector& init_box, BoxProperties& map) {
+	if (!map[precond_id])
+		map.add(new BxpPrecond(precond_id, f.image_dim()));
+}
+
 void CtcNewton::contract(IntervalVector& box, ContractContext& context) {
 	if (!(box.max_diam()<=ceil)) return;
 	else {
+		// note: the preconditioning matrix is only copied
+		// if it has to be recalculated.
 		if (!vars)
-			newton(f,box,prec,gauss_seidel_ratio);
+			newton(f,box,context.prop,precond_id,prec,gauss_seidel_ratio);
 		else
-			newton(f,*vars,box,prec,gauss_seidel_ratio);
+			newton(f,*vars,box,context.prop,precond_id,prec,gauss_seidel_ratio);
 	}
 
 	if (box.is_empty()) {
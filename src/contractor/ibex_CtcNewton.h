@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 24, 2012
-// Last Update : May 24, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_NEWTON_H__
@@ -53,6 +53,15 @@ public:
 
 	void contract(IntervalVector& box, ContractContext& context);
 
+	/**
+	 * \brief Add BxpPrecond.
+	 *
+	 * The preconditioning matrix calculated for a box is then
+	 * inherited by its sub-boxes, and reused as long as it
+	 * is effective.
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
+
 	/** The function. */
 	const Fnc& f;
 
@@ -74,6 +83,10 @@ public:
 	/** Initialized to 0.01 */
 	static constexpr double default_ceil = 0.01;
 
+protected:
+	/* Identifier of the preconditioning matrix property. */
+	const long precond_id;
+
 };
 
 } // end namespace ibex
@@ -13,14 +13,18 @@
 #include "ibex_Cell.h"
 #include "ibex_Bsc.h"
 
+#include <chrono>
+
 using namespace std;
 
 namespace ibex {
 
 CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 		  Ctc(cl), list(cl), ratio(ratio), incremental(incremental),
-		  accumulate(false), g(cl.size(), nb_var), agenda(cl.size()),
-		  active(BitSet::empty(cl.size())) {
+		  accumulate(false), cutoff(0), g(cl.size(), nb_var), agenda(cl.size()),
+		  active(BitSet::empty(cl.size())), priority(NULL), prio_agenda(cl.size()),
+		  pushed_gain(cl.size(),0), pending_gain(0), prev_box(nb_var),
+		  impacts(cl.size(), BitSet(nb_var)) {
 
 	assert(check_nb_var_ctc_list(cl));
 
@@ -38,6 +42,45 @@ void CtcPropag::add_property(const IntervalVector& init_box, BoxProperties& map)
 		list[i].add_property(init_box, map);
 }
 
+void CtcPropag::set_priority(PropagPriority& p) {
+	priority=&p;
+	priority->init(g);
+}
+
+void CtcPropag::push(int c) {
+	if (priority) {
+		double gain=priority->expected_gain(c);
+		pending_gain += gain - (prio_agenda.contains(c)? pushed_gain[c] : 0);
+		pushed_gain[c]=gain;
+		prio_agenda.push(c, priority->priority(c));
+	} else
+		agenda.push(c);
+}
+
+void CtcPropag::pop(int& c) {
+	if (priority) {
+		prio_agenda.pop(c);
+		// no rounding residue when the agenda is empty
+		if (prio_agenda.empty())
+			pending_gain = 0;
+		else
+			pending_gain -= pushed_gain[c];
+	} else
+		agenda.pop(c);
+}
+
+bool CtcPropag::agenda_empty() const {
+	return priority? prio_agenda.empty() : agenda.empty();
+}
+
+void CtcPropag::flush_agenda() {
+	if (priority) {
+		prio_agenda.flush();
+		pending_gain=0;
+	} else
+		agenda.flush();
+}
+
 void CtcPropag::contract(IntervalVector& box) {
 	ContractContext context(box);
 	contract(box,context);
@@ -47,6 +90,8 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 
 	assert(box.size()==nb_var);
 
+	pending_gain = 0;
+
 	if (incremental) {
 		/**
 		 * Note: when context.impact() is NULL, we can
@@ -61,28 +106,29 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 			if (context.impact[i]) {
 				set<int> ctrs=g.output_ctrs(i);
 				for (set<int>::iterator c=ctrs.begin(); c!=ctrs.end(); c++)
-					agenda.push(*c);
+					push(*c);
 			}
 		}
 	} else { // push all the contractors
 		for (int i=0; i<list.size(); i++)
-			agenda.push(i);
+			push(i);
 	}
 
-	BitSet input_impact(context.impact); // save (useful?)
+	BitSet input_impact(context.impact); // save (restored at the end)
 
 	/*
 	 * Now, context.impact is the impact of a call to a
-	 * subcontractor.
-	 *
-	 * When we call a contractor, we assume all
-	 * its variables have been impacted although there might be
-	 * only one of them impacted. In a future version, we may
-	 * consider a more fine propagation where the information
-	 * about the variables that are actually impacted is
-	 * given to the awaken contractor.
+	 * subcontractor, that is, the variables whose domain
+	 * has been reduced (and propagated, see the ratio)
+	 * since the last call to this subcontractor.
+	 * Initially, this is the input impact.
 	 */
-	context.impact.fill(0,nb_var-1);
+	for (int i=0; i<list.size(); i++) {
+		if (incremental)
+			impacts[i]=input_impact;
+		else
+			impacts[i].fill(0,nb_var-1);
+	}
 
 	// By default, all contractors are active
 	active.fill(0,list.size()-1);
@@ -103,12 +149,26 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 	//     if (thres(i)<w) thres(i)=w;
 	//   }
 	//cout << "=========== Start propagation ==========" << endl;
-	while (!agenda.empty()) {
+	while (!agenda_empty()) {
 
-		agenda.pop(c);
+		if (priority && cutoff>0 && pending_gain<cutoff) {
+			// the expected gain is not worth the effort
+			flush_agenda();
+			break;
+		}
+
+		pop(c);
 
 		set<int> vars=g.output_vars(c);
 
+		if (priority) {
+			for (set<int>::iterator v=vars.begin(); v!=vars.end(); v++)
+				prev_box[*v] = box[*v];
+		}
+
+		chrono::steady_clock::time_point start;
+		if (priority && priority->timed()) start=chrono::steady_clock::now();
+
 		// ===================== fine propagation =========================
 		// reset the old box to the current domains just before contraction
 		if (!accumulate) {
@@ -122,10 +182,33 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 
 		context.output_flags.clear();
 
+		context.impact=impacts[c];
+		impacts[c].clear();
+
 		list[c].contract(box, context);
 
+		if (priority) {
+			double time=priority->timed() ?
+					chrono::duration<double>(chrono::steady_clock::now()-start).count() : -1;
+
+			if (box.is_empty())
+				priority->contracted(c, vars.size(), time);
+			else {
+				double gain=0;
+				for (set<int>::iterator v=vars.begin(); v!=vars.end(); v++) {
+					double r=prev_box[*v].ratiodelta(box[*v]);
+					if (r>0) {
+						gain+=r;
+						priority->reduced(*v, r);
+					}
+				}
+				priority->contracted(c, gain, time);
+			}
+		}
+
 		if (box.is_empty()) {
-			agenda.flush();
+			flush_agenda();
+			context.impact=input_impact;
 			//cout << "=========== End propagation ==========" << endl;
 			//cout << "   empty!" << endl;
 			return;
@@ -142,8 +225,9 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 			if (old_box[v].ratiodelta(box[v])>=ratio) {
 				set<int> ctrs=g.output_ctrs(v);
 				for (set<int>::iterator c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
+					impacts[*c2].add(v);
 					if ((c!=*c2 && active[*c2]) || (c==*c2 && !context.output_flags[FIXPOINT]))
-						agenda.push(*c2);
+						push(*c2);
 				}
 				// ===================== coarse propagation =========================
 				// reset the old box to the current domains just after propagation
@@ -167,6 +251,8 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 
 	context.output_flags.clear(); // re-init
 
+	context.impact=input_impact;
+
 	if (active.empty())
 		// TODO: does not respect the current definition of INACTIVE
 		// which imposes that the contractor is inactive before contraction
@@ -13,10 +13,14 @@
 #define __IBEX_CTC_PROPAG_H__
 
 #include "ibex_Agenda.h"
+#include "ibex_PriorityAgenda.h"
+#include "ibex_PropagPriority.h"
 #include "ibex_Ctc.h"
 #include "ibex_DirectedHyperGraph.h"
 #include "ibex_Array.h"
 
+#include <vector>
+
 namespace ibex {
 
 /**
@@ -27,6 +31,10 @@ namespace ibex {
  * This class is an implementation of the classical interval variant of the AC3 constraint propagation
  * algorithm.
  *
+ * By default, pending contractors are handled in FIFO order. A priority can be
+ * set with #set_priority(...); the pending contractor with highest priority is then
+ * applied first and the propagation can be stopped before the fixpoint (see #cutoff).
+ *
  */
 class CtcPropag : public Ctc {
 public:
@@ -59,6 +67,11 @@ public:
 	 * If #incremental is true, the propagation will start from the
 	 * impacted variables only (instead of from all the variables).
 	 *
+	 * Each sub-contractor is called with, as impact, the variables
+	 * reduced (by more than #ratio) since its last call (in this
+	 * propagation). Initially, the impact is the input impact if
+	 * #incremental is true and all the variables otherwise.
+	 *
 	 * \see #contract(IntervalVector&, const BitSet&).
 	 * \throw #ibex::EmptyBoxException - if inconsistency is detected.
 	 */
@@ -69,6 +82,15 @@ public:
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
 
+	/**
+	 * \brief Set the priority of contractors.
+	 *
+	 * The priority is initialized with the constraint network
+	 * of this propagation and informed of each contraction.
+	 * The object is not copied (it must not be deleted before this).
+	 */
+	void set_priority(PropagPriority& priority);
+
 	/** The list of contractors to propagate */
 	Array<Ctc> list;
 
@@ -81,6 +103,17 @@ public:
 	/** Accumulate residual contractions? */
 	bool accumulate;
 
+	/**
+	 * \brief Cut-off of a propagation with priority.
+	 *
+	 * The propagation stops as soon as the sum of the expected
+	 * gains of the pending contractors (see PropagPriority::expected_gain(...))
+	 * is less than this value. Only used if a priority is set.
+	 *
+	 * By default: 0 (propagation until fixpoint).
+	 */
+	double cutoff;
+
 	/** Default ratio used by propagation, set to 0.1. */
 	static constexpr double default_ratio = 0.01;
 
@@ -92,6 +125,24 @@ protected:
 
 	BitSet active;      // mark active sub-contractors
 
+	PropagPriority* priority; // NULL if FIFO
+
+	PriorityAgenda prio_agenda; // propagation agenda (with priority)
+
+	std::vector<double> pushed_gain; // expected gain of each contractor in prio_agenda
+
+	double pending_gain;  // sum of expected gains in prio_agenda
+
+	IntervalVector prev_box; // domains before last contraction (with priority)
+
+	std::vector<BitSet> impacts; // variables reduced since the last call of each contractor
+
+private:
+	// agenda operations (FIFO or with priority)
+	void push(int c);
+	void pop(int& c);
+	bool agenda_empty() const;
+	void flush_agenda();
 
 };
 
@@ -5,11 +5,10 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 30, 2012
-// Last Update : Apr 30, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CtcQInter.h"
-#include "ibex_QInter.h"
 
 namespace ibex {
 
@@ -38,7 +37,7 @@ void CtcQInter::contract(IntervalVector& box, ContractContext& context) {
 		refs.set_ref(i,boxes[i]);
 	}
 
-	box = qinter(refs,q);
+	box = engine.qinter(refs,q);
 
 	context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
 
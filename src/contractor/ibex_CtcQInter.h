@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 30, 2012
-// Last Update : Apr 30, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_Q_INTER_H__
@@ -14,6 +14,7 @@
 #include "ibex_Ctc.h"
 #include "ibex_Array.h"
 #include "ibex_IntervalMatrix.h"
+#include "ibex_QInter.h"
 
 namespace ibex {
 
@@ -59,6 +60,7 @@ public:
 
 protected:
 	IntervalMatrix boxes; // store boxes for each contraction
+	QInter engine;        // q-intersection algorithm (keeps data from one call to the other)
 };
 
 } // end namespace ibex
@@ -5,6 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Aug 21, 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CtcQuantif.h"
@@ -14,11 +15,14 @@
 
 namespace ibex {
 
+const int CtcQuantif::default_cache_size = 5000;
 
 CtcQuantif::CtcQuantif(const NumConstraint& ctr, const VarSet& _vars, const IntervalVector& init_box, double prec) :
 				Ctc(_vars.nb_var), y_init(init_box),
 				ctc(new CtcFwdBwd(ctr)), bsc(new LargestFirst(prec)),
-				vars(_vars), prec(prec), _own_ctc(true) {
+				vars(_vars), prec(prec), nb_threads(1),
+				worker_ctc(1,ctc), worker_bsc(1,bsc), ctr(&ctr),
+				cache_size(default_cache_size), cache_y_init(y_init), _own_ctc(true) {
 
 	assert(vars.nb_var>0);
 	assert(vars.nb_param>0); // sure?
@@ -29,25 +33,65 @@ CtcQuantif::CtcQuantif(const NumConstraint& ctr, const VarSet& _vars, const Inte
 CtcQuantif::CtcQuantif(Ctc& ctc, const VarSet& _vars, const IntervalVector& init_box, double prec, bool own_ctc) :
 			   Ctc(_vars.nb_var), y_init(init_box),
 			   ctc(&ctc), bsc(new LargestFirst(prec)),
-			   vars(_vars), prec(prec), _own_ctc(own_ctc) {
+			   vars(_vars), prec(prec), nb_threads(1),
+			   worker_ctc(1,&ctc), worker_bsc(1,bsc), ctr(NULL),
+			   cache_size(default_cache_size), cache_y_init(y_init), _own_ctc(own_ctc) {
 
 	assert(ctc.nb_var==_vars.nb_var+_vars.nb_param);
 
 }
 
 CtcQuantif::~CtcQuantif(){
+	set_nb_threads(1);
 	if (_own_ctc) delete ctc;
 	delete bsc;
 }
 
+void CtcQuantif::set_nb_threads(int n) {
+	assert(n>=1);
+
+	if (n>1 && !ctr)
+		ibex_error("CtcQuantif: multi-threading requires a contractor built from a constraint");
+
+	for (int w=1; w<nb_threads; w++) {
+		delete worker_ctc[w];
+		delete worker_bsc[w];
+		delete worker_ctr[w-1];
+	}
+	worker_ctc.resize(1);
+	worker_bsc.resize(1);
+	worker_ctr.clear();
+
+	for (int w=1; w<n; w++) {
+		// the evaluation of a function is not thread-safe
+		worker_ctr.push_back(new NumConstraint(*new Function(ctr->f,Function::COPY), ctr->op, true));
+		worker_ctc.push_back(new CtcFwdBwd(*worker_ctr.back()));
+		worker_bsc.push_back(new LargestFirst(prec));
+	}
+
+	nb_threads=n;
+}
+
+void CtcQuantif::set_cache_size(int n) {
+	assert(n>=0);
+	Lock lock(cache_mutex);
+	cache_size=n;
+	empty_cache.clear();
+	inactive_cache.clear();
+}
+
 
 bool CtcQuantif::contract(IntervalVector& x, IntervalVector& y) {
+	return contract(0,x,y);
+}
+
+bool CtcQuantif::contract(int w, IntervalVector& x, IntervalVector& y) {
 	// create the full box by concatening x and y
 	IntervalVector fullbox = vars.full_box(x,y);
 
 	ContractContext slice_context(fullbox);
 
-	ctc->contract(fullbox, slice_context);
+	worker_ctc[w]->contract(fullbox, slice_context);
 
 	x=vars.var_box(fullbox);
 	y=vars.param_box(fullbox);
@@ -55,4 +99,44 @@ bool CtcQuantif::contract(IntervalVector& x, IntervalVector& y) {
 	return slice_context.output_flags[INACTIVE];
 }
 
+void CtcQuantif::check_cache() {
+	Lock lock(cache_mutex);
+	if (cache_y_init.size()!=y_init.size() || !(cache_y_init==y_init)) {
+		empty_cache.clear();
+		inactive_cache.clear();
+		cache_y_init=y_init;
+	}
+}
+
+bool CtcQuantif::is_empty_cached(const IntervalVector& x, const IntervalVector& y) {
+	if (cache_size==0) return false;
+	Lock lock(cache_mutex);
+	return empty_cache.find_superset(cart_prod(x,y))!=-1;
+}
+
+bool CtcQuantif::is_inactive_cached(const IntervalVector& x, const IntervalVector& y) {
+	if (cache_size==0) return false;
+	Lock lock(cache_mutex);
+	return inactive_cache.find_superset(cart_prod(x,y))!=-1;
+}
+
+void CtcQuantif::cache_empty(const IntervalVector& x, const IntervalVector& y) {
+	cache(empty_cache,x,y);
+}
+
+void CtcQuantif::cache_inactive(const IntervalVector& x, const IntervalVector& y) {
+	cache(inactive_cache,x,y);
+}
+
+void CtcQuantif::cache(RTree& tree, const IntervalVector& x, const IntervalVector& y) {
+	if (cache_size==0 || x.is_empty() || y.is_empty()) return;
+	Lock lock(cache_mutex);
+	if (empty_cache.size()+inactive_cache.size()>=cache_size) {
+		// flush (the most recent boxes are usually the most relevant ones)
+		empty_cache.clear();
+		inactive_cache.clear();
+	}
+	tree.insert(cart_prod(x,y),tree.size());
+}
+
 } // namespace ibex
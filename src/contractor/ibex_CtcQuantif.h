@@ -5,6 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Aug 21, 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_QUANTIF_H__
@@ -16,11 +17,24 @@
 #include "ibex_NumConstraint.h"
 #include "ibex_BitSet.h"
 #include "ibex_VarSet.h"
+#include "ibex_RTree.h"
+#include "ibex_Threads.h"
+
+#include <vector>
 
 namespace ibex {
 
 /**
  * \brief Abstract contractor for quantified constraints (proj-union/proj-inter)
+ *
+ * The parameter box is explored by a branch & bound that can be run by
+ * several threads (see #set_nb_threads).
+ *
+ * Pairs of boxes (x,y) proven to contain no solution, or proven to satisfy
+ * the constraint everywhere (inactive contractor), are cached so that
+ * subsequent calls on sub-boxes of x (e.g., when the contractor is called inside
+ * a solver) skip the exploration of y. The cache is flushed when #y_init
+ * is modified or when its size exceeds the limit (see #set_cache_size).
  */
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -68,6 +82,28 @@ public:
 	 */
 	IntervalVector y_init;
 
+	/**
+	 * \brief Set the number of threads exploring the parameter box.
+	 *
+	 * Each thread works with its own copy of the constraint, so this
+	 * is only possible if this contractor has been built from
+	 * a NumConstraint. Default value is 1.
+	 */
+	void set_nb_threads(int n);
+
+	/**
+	 * \brief Set the maximal number of boxes in the cache.
+	 *
+	 * The value 0 disables the cache.
+	 * Default value is #default_cache_size.
+	 */
+	void set_cache_size(int n);
+
+	/**
+	 * \brief Default maximal number of boxes in the cache.
+	 */
+	static const int default_cache_size;
+
 protected:
 	/**
 	 * \brief Contract the "full" box (x,y)
@@ -79,6 +115,38 @@ protected:
 	 */
 	bool contract(IntervalVector& x, IntervalVector& y);
 
+	/**
+	 * \brief Contract the "full" box (x,y) with the contractor of the worker w.
+	 */
+	bool contract(int w, IntervalVector& x, IntervalVector& y);
+
+	/**
+	 * \brief Flush the cache if y_init has changed.
+	 *
+	 * Must be called at the beginning of each contraction.
+	 */
+	void check_cache();
+
+	/**
+	 * \brief True if [x]x[y] is known to contain no solution.
+	 */
+	bool is_empty_cached(const IntervalVector& x, const IntervalVector& y);
+
+	/**
+	 * \brief True if the constraint is known to be satisfied everywhere in [x]x[y].
+	 */
+	bool is_inactive_cached(const IntervalVector& x, const IntervalVector& y);
+
+	/**
+	 * \brief Record that [x]x[y] contains no solution.
+	 */
+	void cache_empty(const IntervalVector& x, const IntervalVector& y);
+
+	/**
+	 * \brief Record that the constraint is satisfied everywhere in [x]x[y].
+	 */
+	void cache_inactive(const IntervalVector& x, const IntervalVector& y);
+
 	/**
 	 * \brief The Contractor.
 	 */
@@ -100,8 +168,43 @@ protected:
 	 */
 	double prec;
 
+	/**
+	 * \brief Number of threads.
+	 */
+	int nb_threads;
+
+	/**
+	 * \brief Contractor of each worker (the first one is #ctc).
+	 */
+	std::vector<Ctc*> worker_ctc;
+
+	/**
+	 * \brief Bisector of each worker (the first one is #bsc).
+	 */
+	std::vector<LargestFirst*> worker_bsc;
+
+	/**
+	 * \brief Protects the data shared by the workers.
+	 */
+	Mutex mutex;
+
 private:
 
+	void cache(RTree& tree, const IntervalVector& x, const IntervalVector& y);
+
+	/* The constraint (NULL if built from a contractor) */
+	const NumConstraint* ctr;
+
+	/* Copies of the constraint (one per additional worker) */
+	std::vector<NumConstraint*> worker_ctr;
+
+	/* Cache */
+	int cache_size;
+	IntervalVector cache_y_init;
+	RTree empty_cache;
+	RTree inactive_cache;
+	Mutex cache_mutex;
+
 	/* Information for cleanup only */
 	bool _own_ctc;
 };
@@ -0,0 +1,85 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_PropagPriority.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_PROPAG_PRIORITY_H__
+#define __IBEX_PROPAG_PRIORITY_H__
+
+#include "ibex_DirectedHyperGraph.h"
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ *
+ * \brief Priority of contractors in a propagation.
+ *
+ * By default, a propagation (see #CtcPropag) handles the pending
+ * contractors in FIFO order. With a priority (see CtcPropag::set_priority(...)),
+ * the pending contractor with highest priority is applied first.
+ *
+ * The propagation informs the priority of the result of each contraction,
+ * so that priorities can be learnt during the search.
+ *
+ * \see #PropagScore.
+ */
+class PropagPriority {
+public:
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~PropagPriority() { }
+
+	/**
+	 * \brief Initialize the priority for a constraint network.
+	 *
+	 * Contractor and variable numbers in the other functions refer to this network.
+	 */
+	virtual void init(const DirectedHyperGraph& g)=0;
+
+	/**
+	 * \brief Priority of a contractor (the higher, the sooner).
+	 */
+	virtual double priority(int c)=0;
+
+	/**
+	 * \brief Expected gain of a contractor.
+	 *
+	 * The gain of a contraction is the sum of the relative reductions (see Interval::ratiodelta(...))
+	 * of the output variables. Used for the cut-off of the propagation (see CtcPropag::cutoff).
+	 */
+	virtual double expected_gain(int c)=0;
+
+	/**
+	 * \brief Contractor \a c has been applied.
+	 *
+	 * \param gain - the gain of the contraction (the number of output variables if the box is emptied).
+	 * \param time - wall-clock time of the contraction in seconds (-1 if #timed() is false).
+	 */
+	virtual void contracted(int c, double gain, double time)=0;
+
+	/**
+	 * \brief Variable \a v has been reduced by a contraction.
+	 *
+	 * \param ratio - relative reduction (see Interval::ratiodelta(...)).
+	 *
+	 * Does nothing by default.
+	 */
+	virtual void reduced(int v, double ratio) { }
+
+	/**
+	 * \brief Whether contractions have to be timed.
+	 *
+	 * By default: false.
+	 */
+	virtual bool timed() const { return false; }
+};
+
+} // namespace ibex
+
+#endif // __IBEX_PROPAG_PRIORITY_H__
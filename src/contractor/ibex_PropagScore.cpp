@@ -0,0 +1,69 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_PropagScore.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_PropagScore.h"
+#include "ibex_Interval.h"
+
+using namespace std;
+
+namespace ibex {
+
+const double PropagScore::default_alpha = 0.3;
+
+const double PropagScore::default_activity_weight = 0.5;
+
+PropagScore::PropagScore(bool timed, double alpha, double activity_weight) :
+		alpha(alpha), activity_weight(activity_weight), _timed(timed) {
+
+}
+
+void PropagScore::init(const DirectedHyperGraph& g) {
+	vars.resize(g.nb_ctr());
+	gain.assign(g.nb_ctr(), 1.0);
+	cost.assign(g.nb_ctr(), 0.0);
+	activity.assign(g.nb_var(), 0.0);
+	stimulus.assign(g.nb_ctr(), 1.0);
+
+	ctrs.resize(g.nb_var());
+	for (int v=0; v<g.nb_var(); v++) {
+		const set<int>& in=g.output_ctrs(v);
+		ctrs[v].assign(in.begin(), in.end());
+	}
+
+	for (int c=0; c<g.nb_ctr(); c++) {
+		const set<int>& out=g.output_vars(c);
+		vars[c].assign(out.begin(), out.end());
+		if (!_timed) cost[c]=vars[c].empty() ? 1 : vars[c].size();
+	}
+}
+
+double PropagScore::priority(int c) {
+	if (cost[c]==0) return POS_INFINITY; // not tried yet
+
+	double act=0;
+	if (!vars[c].empty()) {
+		for (vector<int>::const_iterator v=vars[c].begin(); v!=vars[c].end(); ++v)
+			act+=activity[*v];
+		act/=vars[c].size();
+	}
+
+	return stimulus[c] * (gain[c] + activity_weight*act) / cost[c];
+}
+
+void PropagScore::contracted(int c, double g, double time) {
+	gain[c] = (1-alpha)*gain[c] + alpha*g;
+	stimulus[c] = 0;
+
+	if (_timed) {
+		double t=time*1e6+1e-3; // in microseconds (never 0)
+		cost[c] = cost[c]==0? t : (1-alpha)*cost[c] + alpha*t;
+	}
+}
+
+} // namespace ibex
@@ -0,0 +1,123 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_PropagScore.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_PROPAG_SCORE_H__
+#define __IBEX_PROPAG_SCORE_H__
+
+#include "ibex_PropagPriority.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ *
+ * \brief Gain/cost priority of contractors.
+ *
+ * The priority of a contractor c is
+ *
+ *    stimulus(c) * (gain(c) + activity_weight * activity(c)) / cost(c)
+ *
+ * where:
+ * - stimulus(c) is the sum of the relative reductions of the input variables of c
+ *   since the last contraction with c (1 initially). A contractor whose input
+ *   has hardly changed is delayed, so that it is applied once after several
+ *   reductions instead of after each of them.
+ * - gain(c) is the moving average of the gains of the previous contractions with c.
+ *   It is initialized to 1 (optimistic) so that all contractors are tried.
+ * - activity(c) is the average activity of the output variables of c, the activity of a
+ *   variable being the moving average of its reductions (whatever the contractor).
+ * - cost(c) is the moving average of the time of the previous contractions with c (in
+ *   microseconds) or, if contractions are not timed, the number of output variables
+ *   of c. A contractor that has not been timed yet has highest priority.
+ *
+ * Moving averages are updated with the smoothing factor #alpha:
+ *    avg <- (1-alpha)*avg + alpha*value.
+ *
+ * The priority is learnt along the search (it is not reset between two calls to the
+ * propagation) so the same object must not be shared by different propagations.
+ */
+class PropagScore : public PropagPriority {
+public:
+	/**
+	 * \brief Create a score.
+	 *
+	 * \param timed           - whether the cost is the running time (true) or
+	 *                          the number of variables (false).
+	 * \param alpha           - smoothing factor of moving averages.
+	 * \param activity_weight - weight of the variable activity.
+	 */
+	PropagScore(bool timed=true, double alpha=default_alpha, double activity_weight=default_activity_weight);
+
+	void init(const DirectedHyperGraph& g);
+
+	double priority(int c);
+
+	double expected_gain(int c);
+
+	void contracted(int c, double gain, double time);
+
+	void reduced(int v, double ratio);
+
+	bool timed() const;
+
+	/** Smoothing factor of moving averages. */
+	const double alpha;
+
+	/** Weight of the variable activity. */
+	const double activity_weight;
+
+	/** Default smoothing factor: 0.3. */
+	static const double default_alpha;
+
+	/** Default weight of the variable activity: 0.5. */
+	static const double default_activity_weight;
+
+protected:
+	const bool _timed;
+
+	/** Output variables of each contractor. */
+	std::vector<std::vector<int> > vars;
+
+	/** Average gain of each contractor. */
+	std::vector<double> gain;
+
+	/** Average cost of each contractor (0 if unknown). */
+	std::vector<double> cost;
+
+	/** Activity of each variable. */
+	std::vector<double> activity;
+
+	/** Contractors with each variable as input. */
+	std::vector<std::vector<int> > ctrs;
+
+	/** Stimulus of each contractor. */
+	std::vector<double> stimulus;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline double PropagScore::expected_gain(int c) {
+	return gain[c];
+}
+
+inline void PropagScore::reduced(int v, double ratio) {
+	activity[v] = (1-alpha)*activity[v] + alpha*ratio;
+	for (std::vector<int>::const_iterator c=ctrs[v].begin(); c!=ctrs[v].end(); ++c)
+		stimulus[*c] += ratio;
+}
+
+inline bool PropagScore::timed() const {
+	return _timed;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_PROPAG_SCORE_H__
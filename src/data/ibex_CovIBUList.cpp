@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Nov 07, 2018
-// Last update : Feb 28, 2019
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CovIBUList.h"
@@ -202,6 +202,13 @@ ofstream* CovIBUList::write(const char* filename, const CovIBUList& cov, stack<u
 	return f;
 }
 
+void CovIBUList::clear() {
+	CovIUList::clear();
+	data->_IBU_status.clear();
+	data->_IBU_boundary.clear();
+	data->_IBU_unknown.clear();
+}
+
 void CovIBUList::format(stringstream& ss, const string& title, stack<unsigned int>& format_id, stack<unsigned int>& format_version) {
 	format_id.push(subformat_number);
 	format_version.push(FORMAT_VERSION);
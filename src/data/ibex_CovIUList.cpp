@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Nov 07, 2018
-// Last update : Feb 28, 2019
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CovIUList.h"
@@ -167,6 +167,13 @@ ofstream* CovIUList::write(const char* filename, const CovIUList& cov, std::stac
 	return f;
 }
 
+void CovIUList::clear() {
+	CovList::clear();
+	data->_IU_status.clear();
+	data->_IU_inner.clear();
+	data->_IU_unknown.clear();
+}
+
 void CovIUList::format(stringstream& ss, const string& title, std::stack<unsigned int>& format_id, std::stack<unsigned int>& format_version) {
 	format_id.push(subformat_number);
 	format_version.push(FORMAT_VERSION);
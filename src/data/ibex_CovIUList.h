@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Nov 07, 2018
-// Last update : Feb 28, 2019
+// Last update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_COV_IU_LIST_H__
@@ -76,6 +76,11 @@ public:
 	 */
 	virtual void add(const IntervalVector& x);
 
+	/**
+	 * \brief Remove all the boxes.
+	 */
+	virtual void clear();
+
 	/**
 	 * \brief Status of the ith box.
 	 */
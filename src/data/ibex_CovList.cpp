@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Nov 07, 2018
-// Last update : Feb 28, 2019
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CovList.h"
@@ -104,6 +104,11 @@ IntervalVector CovList::read_box(ifstream& f, size_t n) {
 	return box;
 }
 
+void CovList::clear() {
+	data->lst.clear();
+	data->vec.clear();
+}
+
 void CovList::write_box(ofstream& f, const IntervalVector& box) {
 	for (int i=0; i<box.size(); i++) {
 		write_double(f,box[i].lb());
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Nov 07, 2018
-// Last update : Feb 28, 2019
+// Last update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_COV_LIST_H__
@@ -67,6 +67,11 @@ public:
 	 */
 	const IntervalVector& operator[](int i) const;
 
+	/**
+	 * \brief Remove all the boxes.
+	 */
+	virtual void clear();
+
 	/**
 	 * \brief Number of boxes
 	 */
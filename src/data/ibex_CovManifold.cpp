@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Nov 08, 2018
-// Last update : Feb 28, 2019
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CovManifold.h"
@@ -29,6 +29,7 @@ CovManifold::CovManifold(size_t n, size_t m, size_t nb_ineq, BoundaryType bounda
 	data->_manifold_nb_eq = m;
 	data->_manifold_nb_ineq = nb_ineq;
 	data->_manifold_boundary_type =  boundary_type;
+	data->_manifold_nb_cleared = 0;
 
 	if (n>0) { // if well initialized
 		// create once for all varset structure for variables and parameters
@@ -71,6 +72,7 @@ CovManifold::CovManifold(const Cov& cov, bool copy) : CovIBUList(cov, copy) {
 		data->_manifold_nb_eq = 0;
 		data->_manifold_nb_ineq = 0;
 		data->_manifold_boundary_type = EQU_ONLY; /* by default */
+		data->_manifold_nb_cleared = 0;
 		for (size_t i=0; i<size(); i++) {
 			switch(CovIBUList::status(i)) {
 			case CovIBUList::INNER :
@@ -160,12 +162,31 @@ void CovManifold::add_solution(const IntervalVector& existence, const IntervalVe
 	CovIBUList::add_boundary(existence);
 	data->_manifold_solution.push_back(size()-1);
 	data->_manifold_unicity.push_back(unicity);
+	data->_manifold_unicity_index.insert(unicity, data->_manifold_nb_cleared+nb_solution()-1);
 	data->_manifold_status.push_back(SOLUTION);
 
 	if (nb_eq()<n) // useless otherwise
 		data->_manifold_solution_varset.push_back(varset);
 }
 
+void CovManifold::clear() {
+	CovIBUList::clear();
+
+	// the unicity boxes remain in the index
+	data->_manifold_nb_cleared += nb_solution();
+
+	data->_manifold_status.clear();
+	data->_manifold_solution.clear();
+	data->_manifold_boundary.clear();
+	data->_manifold_unknown.clear();
+	data->_manifold_unicity.clear();
+
+	// the unique varset (m=0 or m=n) is kept
+	if (nb_eq()>0 && nb_eq()<n)
+		data->_manifold_solution_varset.clear();
+	data->_manifold_boundary_varset.clear();
+}
+
 ostream& operator<<(ostream& os, const CovManifold& manif) {
 
 	for (size_t i=0; i<manif.nb_solution(); i++) {
@@ -254,6 +275,7 @@ ifstream* CovManifold::read(const char* filename, CovManifold& cov, std::stack<u
 					cov.data->_manifold_solution_varset.push_back(read_varset(*f, cov.n, cov.nb_eq()));
 
 				cov.data->_manifold_unicity.push_back(read_box(*f, cov.n));
+				cov.data->_manifold_unicity_index.insert(cov.data->_manifold_unicity.back(), cov.data->_manifold_nb_cleared+cov.data->_manifold_unicity.size()-1);
 			}
 		}
 
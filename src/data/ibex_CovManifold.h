@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Nov 08, 2018
-// Last update : Feb 28, 2019
+// Last update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_COV_MANIFOLD_H__
@@ -13,6 +13,7 @@
 
 #include "ibex_CovIBUList.h"
 #include "ibex_VarSet.h"
+#include "ibex_RTree.h"
 
 namespace ibex {
 
@@ -111,6 +112,14 @@ public:
 	 */
 	void add_boundary(const IntervalVector& x);
 
+	/**
+	 * \brief Remove all the boxes.
+	 *
+	 * The unicity boxes of the solutions removed are kept in the
+	 * index (see #find_unicity(const IntervalVector&)).
+	 */
+	virtual void clear();
+
 	/**
 	 * \brief Add a new 'boundary' box at the end of the list.
 	 */
@@ -176,6 +185,18 @@ public:
 	 */
 	const IntervalVector& unicity(int j) const;
 
+	/**
+	 * \brief Find a unicity box containing \a box.
+	 *
+	 * The unicity boxes are indexed (see #RTree) so that the time
+	 * of this query is (typically) logarithmic in the number of solutions.
+	 *
+	 * \return the index j of the solution or -1 if \a box is not included
+	 *         in any unicity box. If the solution has been removed by
+	 *         #clear(), the return value is -2.
+	 */
+	int find_unicity(const IntervalVector& box) const;
+
 	/**
 	 * \brief Certificate of the jth solution.
 	 *
@@ -285,6 +306,8 @@ protected:
 		std::vector<size_t>          _manifold_boundary;  // indices of 'boundary' boxes
 		std::vector<size_t>          _manifold_unknown;  // indices of 'unknown' boxes
 		std::vector<IntervalVector>  _manifold_unicity;   // all the unicity boxes
+		RTree                        _manifold_unicity_index; // spatial index of unicity boxes
+		size_t                       _manifold_nb_cleared; // number of solutions removed by clear()
 
 		// in the special cases where m=0 or m=n, there is only one
 		// possible varset, so a unique varset is stored:
@@ -327,6 +350,13 @@ inline const IntervalVector& CovManifold::unicity(int j) const {
 	return data->_manifold_unicity[j];
 }
 
+inline int CovManifold::find_unicity(const IntervalVector& box) const {
+	int j=data->_manifold_unicity_index.find_superset(box);
+	if (j==-1) return -1;
+	else if (j<(int) data->_manifold_nb_cleared) return -2;
+	else return j-(int) data->_manifold_nb_cleared;
+}
+
 inline const VarSet& CovManifold::solution_varset(int j) const {
 	if (nb_eq()>0 && nb_eq()<n)
 		return data->_manifold_solution_varset[j];
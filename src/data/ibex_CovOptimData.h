@@ -150,6 +150,7 @@ public:
 
 protected:
 	friend class Optimizer;
+	friend class DistributedOptimizer;
 
 	/**
 	 * \brief Load optimizer data from a COV file.
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Nov 08, 2018
-// Last update : Feb 28, 2019
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CovSolverData.h"
@@ -142,6 +142,13 @@ ostream& operator<<(ostream& os, const CovSolverData& solver) {
 
 }
 
+void CovSolverData::clear() {
+	CovManifold::clear();
+	data->_solver_status.clear();
+	data->_solver_pending.clear();
+	data->_solver_unknown.clear();
+}
+
 void CovSolverData::read_vars(ifstream& f, size_t n, vector<string>& var_names) {
 	char x;
 	for (size_t i=0; i<n; i++) {
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Nov 08, 2018
-// Last update : Feb 28, 2019
+// Last update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_COV_SOLVER_DATA_H__
@@ -97,6 +97,15 @@ public:
 	 */
 	void add_boundary(const IntervalVector& x);
 
+	/**
+	 * \brief Remove all the boxes.
+	 *
+	 * The unicity boxes of the solutions removed are kept in the
+	 * index (see #find_unicity(const IntervalVector&)). The other
+	 * data (variable names, status, time, number of cells) are kept.
+	 */
+	virtual void clear();
+
 	/**
 	 * \brief Add a new 'boundary' box at the end of the list.
 	 */
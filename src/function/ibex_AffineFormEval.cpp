@@ -0,0 +1,265 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_AffineFormEval.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_AffineFormEval.h"
+
+using namespace std;
+
+namespace ibex {
+
+const int AffineFormEval::default_max_terms = 64;
+
+namespace {
+
+/*
+ * kth component of a domain (row by row in the case of a matrix).
+ */
+const Interval& elt(const Domain& d, int k) {
+	switch (d.dim.type()) {
+	case Dim::SCALAR:     return d.i();
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR: return d.v()[k];
+	default:              return d.m()[k/d.dim.nb_cols()][k%d.dim.nb_cols()];
+	}
+}
+
+}
+
+AffineFormEval::AffineFormEval(Eval& e, int max_terms) : max_terms(max_terms), f(e.f), itv_eval(e), d(e.d),
+		af(f.nodes.size()), mid(f.nb_var()), rad(f.nb_var()) {
+
+	for (int i=0; i<f.nodes.size(); i++)
+		af[i].resize(f.node(i).dim.size());
+}
+
+Domain& AffineFormEval::eval(const IntervalVector& box) {
+
+	Domain& y=itv_eval.eval(box);
+
+	if (y.is_empty()) return y;
+
+	// by default (variables not used)
+	for (int j=0; j<f.nb_var(); j++) {
+		mid[j]=box[j].mid();
+		rad[j]=0;
+	}
+
+	try {
+		f.forward<AffineFormEval>(*this);
+	} catch(EmptyBoxException&) {
+		d.top->set_empty();
+	}
+
+	return *d.top;
+}
+
+void AffineFormEval::contract(const Domain& y, IntervalVector& box) const {
+
+	for (size_t i=0; i<af[0].size(); i++) {
+		const AffineForm& z=af[0][i];
+		if (!z.is_affine()) continue;
+
+		// a_1*e_1 + ... + a_n*e_n in r
+		Interval r=elt(y,i)-z.center()+Interval(-1,1)*z.err();
+
+		Interval sum(0);
+		for (int k=0; k<z.nb_terms(); k++)
+			sum += ::fabs(z.coeff(k));
+
+		for (int k=0; k<z.nb_terms(); k++) {
+			int j=z.symbol(k);
+			if (rad[j]==0) continue;
+			double others=(sum-::fabs(z.coeff(k))).ub();
+			Interval e=((r+Interval(-others,others))/z.coeff(k)) & Interval(-1,1);
+			box[j] &= mid[j]+rad[j]*e;
+			if (box[j].is_empty()) {
+				box.set_empty();
+				return;
+			}
+		}
+	}
+}
+
+Interval& AffineFormEval::itv(int y, int k) {
+	return (Interval&) elt(d[y],k);
+}
+
+void AffineFormEval::itv_fwd(int y) {
+	for (size_t k=0; k<af[y].size(); k++)
+		af[y][k]=AffineForm(itv(y,k));
+}
+
+void AffineFormEval::tighten(int y) {
+	for (size_t k=0; k<af[y].size(); k++) {
+		AffineForm& z=af[y][k];
+		Interval& x=itv(y,k);
+		z.condense(max_terms);
+		z &= x;
+		x=z.itv();
+		if (x.is_empty()) throw EmptyBoxException();
+	}
+}
+
+void AffineFormEval::symbol_fwd(int y) {
+	const ExprSymbol& s=(const ExprSymbol&) f.node(y);
+	int first=f.symbol_index(s.key);
+
+	for (int k=0; k<s.dim.size(); k++) {
+		af[y][k]=AffineForm(itv(y,k),first+k);
+		if (af[y][k].nb_terms()>0) {
+			mid[first+k]=af[y][k].center();
+			rad[first+k]=af[y][k].coeff(0);
+		}
+	}
+}
+
+void AffineFormEval::cst_fwd(int y) {
+	itv_fwd(y);
+}
+
+void AffineFormEval::idx_cp_fwd(int x, int y) {
+	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
+
+	const ExprIndex& e = (const ExprIndex&) f.node(y);
+	int nb_cols=f.node(x).dim.nb_cols();
+
+	int k=0;
+	for (int r=e.index.first_row(); r<=e.index.last_row(); r++)
+		for (int c=e.index.first_col(); c<=e.index.last_col(); c++)
+			af[y][k++]=af[x][r*nb_cols+c];
+	tighten(y);
+}
+
+void AffineFormEval::vector_fwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	const ExprVector& v = (const ExprVector&) f.node(y);
+	int nb_cols=v.dim.nb_cols();
+
+	int j=0; // first column (row vector) or first row (column vector) of the current argument
+
+	for (int i=0; i<v.length(); i++) {
+		const Dim& dim=v.arg(i).dim;
+		for (int r=0; r<dim.nb_rows(); r++)
+			for (int c=0; c<dim.nb_cols(); c++) {
+				if (v.row_vector())
+					af[y][r*nb_cols+j+c]=af[x[i]][r*dim.nb_cols()+c];
+				else
+					af[y][(j+r)*nb_cols+c]=af[x[i]][r*dim.nb_cols()+c];
+			}
+		j+= v.row_vector()? dim.nb_cols() : dim.nb_rows();
+	}
+	tighten(y);
+}
+
+void AffineFormEval::minus_V_fwd(int x, int y) {
+	for (size_t k=0; k<af[y].size(); k++)
+		af[y][k]=-af[x][k];
+	tighten(y);
+}
+
+void AffineFormEval::minus_M_fwd(int x, int y) {
+	minus_V_fwd(x,y);
+}
+
+void AffineFormEval::trans_V_fwd(int x, int y) {
+	af[y]=af[x];
+	tighten(y);
+}
+
+void AffineFormEval::trans_M_fwd(int x, int y) {
+	int nb_rows=f.node(x).dim.nb_rows();
+	int nb_cols=f.node(x).dim.nb_cols();
+
+	for (int r=0; r<nb_rows; r++)
+		for (int c=0; c<nb_cols; c++)
+			af[y][c*nb_rows+r]=af[x][r*nb_cols+c];
+	tighten(y);
+}
+
+void AffineFormEval::add_V_fwd(int x1, int x2, int y) {
+	for (size_t k=0; k<af[y].size(); k++)
+		af[y][k]=af[x1][k]+af[x2][k];
+	tighten(y);
+}
+
+void AffineFormEval::add_M_fwd(int x1, int x2, int y) {
+	add_V_fwd(x1,x2,y);
+}
+
+void AffineFormEval::sub_V_fwd(int x1, int x2, int y) {
+	for (size_t k=0; k<af[y].size(); k++)
+		af[y][k]=af[x1][k]-af[x2][k];
+	tighten(y);
+}
+
+void AffineFormEval::sub_M_fwd(int x1, int x2, int y) {
+	sub_V_fwd(x1,x2,y);
+}
+
+void AffineFormEval::mul_SV_fwd(int x1, int x2, int y) {
+	for (size_t k=0; k<af[y].size(); k++)
+		af[y][k]=af[x1][0]*af[x2][k];
+	tighten(y);
+}
+
+void AffineFormEval::mul_SM_fwd(int x1, int x2, int y) {
+	mul_SV_fwd(x1,x2,y);
+}
+
+void AffineFormEval::mul_VV_fwd(int x1, int x2, int y) {
+	AffineForm z;
+	for (size_t k=0; k<af[x1].size(); k++)
+		z=z+af[x1][k]*af[x2][k];
+	af[y][0]=z;
+	tighten(y);
+}
+
+void AffineFormEval::mul_MV_fwd(int x1, int x2, int y) {
+	int nb_cols=f.node(x1).dim.nb_cols();
+
+	for (size_t r=0; r<af[y].size(); r++) {
+		AffineForm z;
+		for (int c=0; c<nb_cols; c++)
+			z=z+af[x1][r*nb_cols+c]*af[x2][c];
+		af[y][r]=z;
+	}
+	tighten(y);
+}
+
+void AffineFormEval::mul_VM_fwd(int x1, int x2, int y) {
+	int nb_rows=f.node(x2).dim.nb_rows();
+	int nb_cols=f.node(x2).dim.nb_cols();
+
+	for (int c=0; c<nb_cols; c++) {
+		AffineForm z;
+		for (int r=0; r<nb_rows; r++)
+			z=z+af[x1][r]*af[x2][r*nb_cols+c];
+		af[y][c]=z;
+	}
+	tighten(y);
+}
+
+void AffineFormEval::mul_MM_fwd(int x1, int x2, int y) {
+	int nb_rows=f.node(x1).dim.nb_rows();
+	int n=f.node(x1).dim.nb_cols();
+	int nb_cols=f.node(x2).dim.nb_cols();
+
+	for (int r=0; r<nb_rows; r++)
+		for (int c=0; c<nb_cols; c++) {
+			AffineForm z;
+			for (int k=0; k<n; k++)
+				z=z+af[x1][r*n+k]*af[x2][k*nb_cols+c];
+			af[y][r*nb_cols+c]=z;
+		}
+	tighten(y);
+}
+
+} // namespace ibex
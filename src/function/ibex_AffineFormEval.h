@@ -0,0 +1,222 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_AffineFormEval.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_AFFINE_FORM_EVAL_H__
+#define __IBEX_AFFINE_FORM_EVAL_H__
+
+#include "ibex_Eval.h"
+#include "ibex_AffineForm.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Function evaluator with affine arithmetic.
+ *
+ * The function is first evaluated with interval arithmetic (by the
+ * interval evaluator given to the constructor) and then with affine
+ * arithmetic (see #AffineForm). The domain of each node of the interval
+ * evaluator is intersected with the range of the affine form of the node,
+ * so that the backward phase of HC4Revise also benefits from the
+ * sharper domains (see HC4Revise::proj(const Domain&, IntervalVector&, AffineFormEval&)).
+ *
+ * The noise symbols are the variables of the function. The operators
+ * that are not linearized (trigonometric functions, abs, min/max,
+ * function calls, etc.) result in forms without dependency.
+ */
+class AffineFormEval : public FwdAlgorithm {
+
+public:
+	/**
+	 * \brief Build the affine evaluator from an interval evaluator.
+	 *
+	 * \param max_terms - maximal number of terms of an affine form (see #AffineForm::condense(int)).
+	 */
+	AffineFormEval(Eval& e, int max_terms=default_max_terms);
+
+	/**
+	 * \brief Run the forward algorithm with an input box.
+	 *
+	 * \return the domain of the root node in the interval evaluator.
+	 */
+	Domain& eval(const IntervalVector& box);
+
+	/**
+	 * \brief Affine form of the ith component of the function (after #eval(const IntervalVector&)).
+	 *
+	 * The components of a matrix-valued function are numbered row by row.
+	 */
+	const AffineForm& form(int i=0) const;
+
+	/**
+	 * \brief Contract a box with respect to f(x) in y using the affine forms.
+	 *
+	 * Each component f_i(x) of the function satisfies, for all x in the box
+	 * of the last evaluation, a linear inequality
+	 *
+	 *    c_i + a_i1*e_1 + ... + a_in*e_n + err_i*[-1,1] in y_i
+	 *
+	 * where x_j=mid_j+rad_j*e_j. This inequality is projected onto each e_j.
+	 *
+	 * \pre box is a subset of the box of the last evaluation.
+	 *
+	 * The box is set to the empty box if the constraint is not satisfied.
+	 */
+	void contract(const Domain& y, IntervalVector& box) const;
+
+	/**
+	 * \brief Default maximal number of terms of an affine form.
+	 */
+	static const int default_max_terms;
+
+	/**
+	 * \brief Maximal number of terms of an affine form.
+	 */
+	const int max_terms;
+
+protected:
+	/**
+	 * Class used internally to interrupt the forward procedure
+	 * when an empty domain occurs.
+	 */
+	class EmptyBoxException { };
+
+	/*
+	 * Interval domain of the kth component of the node y.
+	 */
+	Interval& itv(int y, int k);
+
+	/*
+	 * Set the forms of the node y to the interval domains (no dependency).
+	 */
+	void itv_fwd(int y);
+
+	/*
+	 * Intersect the forms of the node y with the interval domains
+	 * and the interval domains with the range of the forms.
+	 */
+	void tighten(int y);
+
+	Function& f;
+	Eval& itv_eval;
+	ExprDomain& d;
+
+	/* Affine forms of the components of each node */
+	std::vector<std::vector<AffineForm> > af;
+
+	/* Midpoint and radius of the domain of each variable */
+	std::vector<double> mid;
+	std::vector<double> rad;
+
+public: // because called from CompiledFunction
+	void vector_fwd (int* x, int y);
+	void apply_fwd  (int* x, int y);
+	void idx_fwd    (int x, int y);
+	void idx_cp_fwd (int x, int y);
+	void symbol_fwd (int y);
+	void cst_fwd    (int y);
+	void chi_fwd    (int x1, int x2, int x3, int y);
+	void gen2_fwd   (int x, int x2, int y);
+	void add_fwd    (int x1, int x2, int y);
+	void mul_fwd    (int x1, int x2, int y);
+	void sub_fwd    (int x1, int x2, int y);
+	void div_fwd    (int x1, int x2, int y);
+	void max_fwd    (int x1, int x2, int y);
+	void min_fwd    (int x1, int x2, int y);
+	void atan2_fwd  (int x1, int x2, int y);
+	void gen1_fwd   (int x, int y);
+	void minus_fwd  (int x, int y);
+	void minus_V_fwd(int x, int y);
+	void minus_M_fwd(int x, int y);
+	void trans_V_fwd(int x, int y);
+	void trans_M_fwd(int x, int y);
+	void sign_fwd   (int x, int y);
+	void abs_fwd    (int x, int y);
+	void power_fwd  (int x, int y, int p);
+	void sqr_fwd    (int x, int y);
+	void sqrt_fwd   (int x, int y);
+	void exp_fwd    (int x, int y);
+	void log_fwd    (int x, int y);
+	void cos_fwd    (int x, int y);
+	void sin_fwd    (int x, int y);
+	void tan_fwd    (int x, int y);
+	void cosh_fwd   (int x, int y);
+	void sinh_fwd   (int x, int y);
+	void tanh_fwd   (int x, int y);
+	void acos_fwd   (int x, int y);
+	void asin_fwd   (int x, int y);
+	void atan_fwd   (int x, int y);
+	void acosh_fwd  (int x, int y);
+	void asinh_fwd  (int x, int y);
+	void atanh_fwd  (int x, int y);
+	void floor_fwd  (int x, int y);
+	void ceil_fwd   (int x, int y);
+	void saw_fwd    (int x, int y);
+	void add_V_fwd  (int x1, int x2, int y);
+	void add_M_fwd  (int x1, int x2, int y);
+	void mul_SV_fwd (int x1, int x2, int y);
+	void mul_SM_fwd (int x1, int x2, int y);
+	void mul_VV_fwd (int x1, int x2, int y);
+	void mul_MV_fwd (int x1, int x2, int y);
+	void mul_VM_fwd (int x1, int x2, int y);
+	void mul_MM_fwd (int x1, int x2, int y);
+	void sub_V_fwd  (int x1, int x2, int y);
+	void sub_M_fwd  (int x1, int x2, int y);
+};
+
+/*================================== inline implementations ========================================*/
+
+inline const AffineForm& AffineFormEval::form(int i) const {
+	return af[0][i];
+}
+
+inline void AffineFormEval::chi_fwd(int, int, int, int y)  { itv_fwd(y); }
+inline void AffineFormEval::gen2_fwd(int, int, int y)      { itv_fwd(y); }
+inline void AffineFormEval::apply_fwd(int*, int y)         { itv_fwd(y); }
+inline void AffineFormEval::max_fwd(int, int, int y)       { itv_fwd(y); }
+inline void AffineFormEval::min_fwd(int, int, int y)       { itv_fwd(y); }
+inline void AffineFormEval::atan2_fwd(int, int, int y)     { itv_fwd(y); }
+inline void AffineFormEval::gen1_fwd(int, int y)           { itv_fwd(y); }
+inline void AffineFormEval::sign_fwd(int, int y)           { itv_fwd(y); }
+inline void AffineFormEval::abs_fwd(int, int y)            { itv_fwd(y); }
+inline void AffineFormEval::cos_fwd(int, int y)            { itv_fwd(y); }
+inline void AffineFormEval::sin_fwd(int, int y)            { itv_fwd(y); }
+inline void AffineFormEval::tan_fwd(int, int y)            { itv_fwd(y); }
+inline void AffineFormEval::cosh_fwd(int, int y)           { itv_fwd(y); }
+inline void AffineFormEval::sinh_fwd(int, int y)           { itv_fwd(y); }
+inline void AffineFormEval::tanh_fwd(int, int y)           { itv_fwd(y); }
+inline void AffineFormEval::acos_fwd(int, int y)           { itv_fwd(y); }
+inline void AffineFormEval::asin_fwd(int, int y)           { itv_fwd(y); }
+inline void AffineFormEval::atan_fwd(int, int y)           { itv_fwd(y); }
+inline void AffineFormEval::acosh_fwd(int, int y)          { itv_fwd(y); }
+inline void AffineFormEval::asinh_fwd(int, int y)          { itv_fwd(y); }
+inline void AffineFormEval::atanh_fwd(int, int y)          { itv_fwd(y); }
+inline void AffineFormEval::floor_fwd(int, int y)          { itv_fwd(y); }
+inline void AffineFormEval::ceil_fwd(int, int y)           { itv_fwd(y); }
+inline void AffineFormEval::saw_fwd(int, int y)            { itv_fwd(y); }
+
+inline void AffineFormEval::idx_fwd(int x, int y)          { idx_cp_fwd(x,y); }
+
+inline void AffineFormEval::add_fwd(int x1, int x2, int y) { af[y][0]=af[x1][0]+af[x2][0]; tighten(y); }
+inline void AffineFormEval::sub_fwd(int x1, int x2, int y) { af[y][0]=af[x1][0]-af[x2][0]; tighten(y); }
+inline void AffineFormEval::mul_fwd(int x1, int x2, int y) { af[y][0]=af[x1][0]*af[x2][0]; tighten(y); }
+inline void AffineFormEval::div_fwd(int x1, int x2, int y) { af[y][0]=af[x1][0]/af[x2][0]; tighten(y); }
+inline void AffineFormEval::minus_fwd(int x, int y)        { af[y][0]=-af[x][0]; tighten(y); }
+inline void AffineFormEval::power_fwd(int x, int y, int p) { af[y][0]=pow(af[x][0],p); tighten(y); }
+inline void AffineFormEval::sqr_fwd(int x, int y)          { af[y][0]=sqr(af[x][0]); tighten(y); }
+inline void AffineFormEval::sqrt_fwd(int x, int y)         { af[y][0]=sqrt(af[x][0]); tighten(y); }
+inline void AffineFormEval::exp_fwd(int x, int y)          { af[y][0]=exp(af[x][0]); tighten(y); }
+inline void AffineFormEval::log_fwd(int x, int y)          { af[y][0]=log(af[x][0]); tighten(y); }
+
+} // namespace ibex
+
+#endif // __IBEX_AFFINE_FORM_EVAL_H__
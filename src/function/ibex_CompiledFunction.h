@@ -87,6 +87,7 @@ public:
 	 * Print the structure to the standard output.
 	 */
 	friend class Function;
+	friend class HC4Revise;
 
 protected:
 	typedef enum {
@@ -19,7 +19,7 @@ using namespace std;
 
 namespace ibex {
 
-Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL), matrix_fwd_agenda(NULL), matrix_bwd_agenda(NULL) {
+Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL), matrix_fwd_agenda(NULL), matrix_bwd_agenda(NULL), nb_eval(0) {
 
 	Dim dim=f.expr().dim;
 	int m=dim.vec_size();
@@ -91,6 +91,8 @@ Eval::~Eval() {
 
 Domain& Eval::eval(const Array<const Domain>& d2) {
 
+	nb_eval++;
+
 	d.write_arg_domains(d2);
 
 	//------------- for debug
@@ -109,6 +111,8 @@ Domain& Eval::eval(const Array<const Domain>& d2) {
 
 Domain& Eval::eval(const Array<Domain>& d2) {
 
+	nb_eval++;
+
 	d.write_arg_domains(d2);
 
 	try {
@@ -121,6 +125,8 @@ Domain& Eval::eval(const Array<Domain>& d2) {
 
 Domain& Eval::eval(const IntervalVector& box) {
 
+	nb_eval++;
+
 	d.write_arg_domains(box);
 
 	try {
@@ -131,12 +137,30 @@ Domain& Eval::eval(const IntervalVector& box) {
 	return *d.top;
 }
 
+Domain& Eval::eval(const IntervalVector& box, const Agenda& a) {
+
+	nb_eval++;
+
+	d.write_arg_domains(box);
+
+	if (a.empty()) return *d.top;
+
+	try {
+		f.cf.forward<Eval>(*this,a);
+	} catch(EmptyBoxException&) {
+		d.top->set_empty();
+	}
+	return *d.top;
+}
+
 Domain Eval::eval(const IntervalVector& box, const BitSet& components) {
 
 	Dim dim=d.top->dim;
 
 	if (dim.type()==Dim::SCALAR) return eval(box);
 
+	nb_eval++;
+
 	d.write_arg_domains(box);
 
 	assert(!components.empty());
@@ -198,6 +222,8 @@ Domain Eval::eval(const IntervalVector& box, const BitSet& rows, const BitSet& c
 	default : ;// ok continue
 	}
 
+	nb_eval++;
+
 	d.write_arg_domains(box);
 
 	assert(!rows.empty());
@@ -55,6 +55,14 @@ public:
 	 */
 	Domain& eval(const IntervalVector& box);
 
+	/**
+	 * \brief Partial evaluation.
+	 *
+	 * Only the nodes in the agenda \a a are evaluated (in the
+	 * order of the agenda), the other nodes keep their current domain.
+	 */
+	Domain& eval(const IntervalVector& box, const Agenda& a);
+
 	/**
 	 * \brief Evaluate a subset of components.
 	 *
@@ -144,6 +152,15 @@ public: // because called from CompiledFunction
 	Agenda** bwd_agenda;         // one agenda for each vector component/matrix row
 	Agenda*** matrix_fwd_agenda; // one agenda for each matrix element
 	Agenda*** matrix_bwd_agenda; // one agenda for each matrix element
+
+	/**
+	 * \brief Number of evaluations so far.
+	 *
+	 * Incremented each time the domains of the nodes are overwritten.
+	 * Allows to know if the domains obtained by a previous evaluation
+	 * are still there (see HC4Revise).
+	 */
+	unsigned long nb_eval;
 };
 
 /* ============================================================================
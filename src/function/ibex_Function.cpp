@@ -7,6 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Jan 5, 2012
+ * Last Update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "ibex_Function.h"
@@ -46,7 +47,7 @@ Function::~Function() {
 		if (image_dim()>1) {
 			int m=_image_dim.is_vector() ? _image_dim.vec_size() : _image_dim.nb_rows();
 			for (int i=0; i<m; i++)
-				if (!zero || comp[i]!=zero) delete comp[i];
+				if (comp[i] && comp[i]!=zero) delete comp[i];
 		}
 		if (zero) delete zero;
 		delete[] comp;
@@ -7,6 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Jan 5, 2012
+ * Last Update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __IBEX_FUNCTION_H__
@@ -21,6 +22,7 @@
 #include "ibex_BitSet.h"
 
 #include <stdexcept>
+#include <atomic>
 #include <stdarg.h>
 #include <stdio.h>
 
@@ -557,6 +559,13 @@ public:
 	 *
 	 * *not* in:   <br>
 	 *    { (x,y)->x+y ; (z,y)->z-y }
+	 *
+	 * The component is generated at the first call (only the
+	 * sub-expression of the ith component is copied if f is
+	 * a vector of expressions). Prefer eval(int,const IntervalVector&),
+	 * eval_vector(const IntervalVector&, const BitSet&) or jacobian(...)
+	 * when possible: they work directly on the DAG of f and
+	 * generate no component.
 	 */
 	Function& operator[](int i);
 
@@ -794,6 +803,14 @@ public:
 	 */
 	bool backward(const IntervalMatrix& y, IntervalVector& x) const;
 
+	/**
+	 * \brief Contract x w.r.t. f(x)=y, incrementally.
+	 *
+	 * Only the variables in \a impact that have changed since the last call
+	 * are propagated in the forward phase (see HC4Revise::proj(const Domain&, IntervalVector&, const BitSet&)).
+	 */
+	bool backward(const Domain& y, IntervalVector& x, const BitSet& impact) const;
+
 	/**
 	 * \brief Inner projection f(x)=y onto x.
 	 */
@@ -884,9 +901,13 @@ protected:
 	void generate_used_vars() const;
 
 	/**
-	 * \brief Generate f[0], f[1], etc. (all stored in "comp")
+	 * \brief Generate f[i] (stored in "comp")
+	 *
+	 * The components are generated one by one, on demand.
+	 * The generation is serialized, so that a function can be
+	 * shared by several threads.
 	 */
-	void generate_comp();
+	void generate_comp(int i);
 
 	/**
 	 * \brief Print the function "x->f(x)" (including arguments)
@@ -905,6 +926,8 @@ protected:
 
 private:
 	friend class VarSet;
+	friend class HC4Revise;
+	friend class AffineFormEval;
 
 	void build_from_string(const Array<const char*>& x, const char* y, const char* name=NULL);
 
@@ -922,7 +945,7 @@ private:
 	BitSet is_used;                             // tells whether the i^th component is used.
 
 	// only generated if required
-	Function** comp;                             // the components. ==this if output_size()==1.
+	std::atomic<Function*>* comp;               // the components (NULL if not generated yet). ==this if output_size()==1.
 
 	bool __all_symbols_scalar;                  // true if all symbols are scalar
 
@@ -967,12 +990,12 @@ inline const Function& Function::diff() const {
 }
 
 inline Function& Function::operator[](int i) {
-	if (!comp) generate_comp();
+	if (!comp[i]) generate_comp(i);
 	return *comp[i];
 }
 
 inline Function& Function::operator[](int i) const {
-	if (!comp) ((Function&) *this).generate_comp();
+	if (!comp[i]) ((Function&) *this).generate_comp(i);
 	return *comp[i];
 }
 
@@ -1080,6 +1103,10 @@ inline bool Function::backward(const IntervalMatrix& y, IntervalVector& x) const
 	return backward(Domain((IntervalMatrix&) y),x); // y will not be modified
 }
 
+inline bool Function::backward(const Domain& y, IntervalVector& x, const BitSet& impact) const {
+	return ((Function*) this)->_hc4revise->proj(y,x,impact);
+}
+
 inline void Function::ibwd(const Domain& y, IntervalVector& x) const {
 	((Function*) this)->_inhc4revise->iproj(y,x);
 }
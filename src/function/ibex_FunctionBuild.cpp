@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Jan 5, 2012
- * Last Update : Nov 22, 2017
+ * Last Update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #include <sstream>
@@ -29,12 +29,17 @@
 #include <mutex>
 namespace {
 std::mutex mtx;
+std::recursive_mutex comp_mtx; // generation of components (see Function::generate_comp)
 }
 #define LOCK mtx.lock()
 #define UNLOCK mtx.unlock()
+#define LOCK_COMP comp_mtx.lock()
+#define UNLOCK_COMP comp_mtx.unlock()
 #else
 #define LOCK
 #define UNLOCK
+#define LOCK_COMP
+#define UNLOCK_COMP
 #endif
 
 using namespace std;
@@ -436,10 +441,15 @@ Function::Function(const Function& f, copy_mode mode) {
 	}
 }
 
-void Function::generate_comp() {
-	if (expr().type()==Dim::SCALAR) {
-		comp=new Function*[1];
-		comp[0]=(Function*) this; // a function cannot be modified anyway
+void Function::generate_comp(int i) {
+
+	// The array "comp" is allocated by init(). The slot is
+	// checked again under the lock as another thread may have
+	// generated the component in the meantime.
+	LOCK_COMP;
+
+	if (comp[i]) {
+		UNLOCK_COMP;
 		return;
 	}
 
@@ -448,26 +458,38 @@ void Function::generate_comp() {
 
 	int m=_image_dim.is_vector() ? _image_dim.vec_size() : _image_dim.nb_rows();
 
-	comp = new Function*[m];
+	Array<const ExprSymbol> x(nb_arg());
+	varcopy(symbs,x);
+
+	const ExprNode* yi;
 
-	for (int i=0; i<m; i++) {
-		Array<const ExprSymbol> x(nb_arg());
-		varcopy(symbs,x);
+	// If f is a vector of expressions (the most frequent case), we only copy
+	// the sub-DAG of the ith expression, instead of the whole DAG
+	// (which would be then simplified).
+	const ExprVector* vec=dynamic_cast<const ExprVector*>(&expr());
+	if (vec && (vec->orient==ExprVector::COL || _image_dim.type()==Dim::ROW_VECTOR) && m==vec->nb_args) {
+		// simplification level 1 should be enough here
+		yi=&ExprCopy().copy(symbs, x, vec->arg(i)).simplify(ExprNode::default_simpl_level);
+	} else {
 		const ExprIndex& yi_tmp=expr()[i];
 		// simplification level 1 should be enough here
-		const ExprNode& yi=ExprCopy().copy(symbs, x, yi_tmp).simplify(ExprNode::default_simpl_level);
+		yi=&ExprCopy().copy(symbs, x, yi_tmp).simplify(ExprNode::default_simpl_level);
 		delete &yi_tmp;
-		Function* fi=new Function(x,yi);
-		const ExprConstant* c=dynamic_cast<const ExprConstant*>(&(fi->expr()));
-		if (c && c->dim.is_scalar() && c->get_value()==Interval::zero()) { // use a more efficient structure than a DAG!
-			if (!zero) zero=fi;
-			else delete fi;
-			comp[i] = zero;
-		} else {
-			comp[i] = fi;
-		}
 	}
 
+	Function* fi=new Function(x,*yi);
+	const ExprConstant* c=dynamic_cast<const ExprConstant*>(&(fi->expr()));
+	if (c && c->dim.is_scalar() && c->get_value()==Interval::zero()) { // use a more efficient structure than a DAG!
+		if (!zero) zero=fi;
+		else delete fi;
+		fi = zero;
+	}
+
+	// published once the component is complete
+	comp[i] = fi;
+
+	UNLOCK_COMP;
+
 	// This old code was generating all the m*n components
 	// in the case of a matrix-valued function
 	// -----------------------------------------------------------------------------------------
@@ -559,6 +581,17 @@ void Function::init(const Array<const ExprSymbol>& x, const ExprNode& y, const c
 	_grad = new Gradient(*_eval);
 	_inhc4revise = new InHC4Revise(*_eval);
 
+	// the components themselves are only generated on demand
+	if (expr().type()==Dim::SCALAR) {
+		comp = new std::atomic<Function*>[1];
+		comp[0] = this; // a function cannot be modified anyway
+	} else {
+		int m=_image_dim.is_vector() ? _image_dim.vec_size() : _image_dim.nb_rows();
+		comp = new std::atomic<Function*>[m];
+		for (int j=0; j<m; j++)
+			comp[j] = NULL;
+	}
+
 	// ===== display adjacency (debug) =========
 //	cout << "adjacency of function" << *this << ":" << endl;
 //	for (int i=0; i<nb_used_inputs; i++)
@@ -7,6 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Jan 27, 2012
+ * Last Update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "ibex_Function.h"
@@ -18,10 +19,24 @@ using namespace std;
 namespace ibex {
 
 Gradient::Gradient(Eval& e): f(e.f), _eval(e), d(e.d), g(f),
-		coeff_matrix(f.image_dim(),f.nb_var()+1), is_linear(new bool[f.image_dim()]) {
+		coeff_matrix(1,1), is_linear(NULL), linear_init(false) {
 
-	if (f.expr().dim.is_matrix())
+}
+
+void Gradient::init_linear_part() {
+
+	Lock lock(linear_mutex);
+
+	if (linear_init.load(std::memory_order_relaxed))
+		return; // done by another thread in the meantime
+
+	coeff_matrix.resize(f.image_dim(),f.nb_var()+1);
+	is_linear=new bool[f.image_dim()];
+
+	if (f.expr().dim.is_matrix()) {
+		linear_init.store(true, std::memory_order_release);
 		return; // class not called in this case
+	}
 
 	ExprLinearity el(f.args(),f.expr());
 
@@ -33,10 +48,12 @@ Gradient::Gradient(Eval& e): f(e.f), _eval(e), d(e.d), g(f),
 	for (int i=0; i<f.image_dim(); i++) {
 		is_linear[i]=!coeff_matrix[i].is_unbounded();
 	}
+
+	linear_init.store(true, std::memory_order_release);
 }
 
 Gradient::~Gradient() {
-	delete[] is_linear;
+	if (is_linear) delete[] is_linear;
 }
 
 void Gradient::gradient(const Array<Domain>& d2, IntervalVector& gbox) {
@@ -104,6 +121,8 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 
 	int c; // constraint number
 
+	if (!linear_init.load(std::memory_order_acquire)) init_linear_part();
+
 	// ============================================================================
 	// Detect the "nonlinear" components (those that requires gradient calculation)
 	BitSet nonlinear_components=BitSet::empty(f.image_dim());
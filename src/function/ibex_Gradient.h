@@ -7,6 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Jan 27, 2012
+ * Last Update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __IBEX_GRADIENT_H__
@@ -15,6 +16,9 @@
 #include "ibex_Eval.h"
 #include "ibex_BwdAlgorithm.h"
 #include "ibex_Agenda.h"
+#include "ibex_Threads.h"
+
+#include <atomic>
 
 namespace ibex {
 
@@ -71,6 +75,11 @@ public:
 	 */
 	void jacobian(const Array<Domain>& d, IntervalMatrix& J);
 
+	/**
+	 * \brief True if the ith component of f is linear (w.r.t. all variables).
+	 */
+	bool linear(int i);
+
 	/* ====================================== Forward =================================== */
 
 	inline void idx_fwd(int , int ) { /* nothing to do */ }
@@ -184,6 +193,20 @@ public:
 	inline void sub_V_bwd (int x1, int x2, int y) { g[x1].v() += g[y].v(); g[x2].v() -= g[y].v(); }
 	inline void sub_M_bwd (int x1, int x2, int y) { g[x1].m() += g[y].m(); g[x2].m() -= g[y].m(); }
 
+	/**
+	 * Calculate the linear part of f.
+	 *
+	 * Only done on demand, i.e., when a Jacobian matrix is
+	 * calculated for the first time. Indeed, the linearity
+	 * analysis takes O(n) per node and is useless for the many
+	 * functions built (e.g., by normalized/extended systems)
+	 * that are only evaluated or contracted.
+	 *
+	 * Several threads may call this function concurrently (e.g., through
+	 * #linear(int)): the analysis is only performed once.
+	 */
+	void init_linear_part();
+
 	Function& f;
 	Eval& _eval;
 	ExprDomain& d;
@@ -192,9 +215,22 @@ public:
 	// that these coefficients are only calculated once.
 	IntervalMatrix coeff_matrix;
 	// True if the ith component is linear (wrt all variables)
+	// (NULL if the linear part is not calculated yet)
 	bool *is_linear;
+	// Whether the linear part is calculated
+	// (set once coeff_matrix and is_linear are written)
+	std::atomic<bool> linear_init;
+	// For the initialization of the linear part
+	Mutex linear_mutex;
 };
 
+/*================================== inline implementations ========================================*/
+
+inline bool Gradient::linear(int i) {
+	if (!linear_init.load(std::memory_order_acquire)) init_linear_part();
+	return is_linear[i];
+}
+
 } // namespace ibex
 
 #endif // __IBEX_GRADIENT_H__
@@ -5,16 +5,66 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Dec 31, 2011
-// Last update : Jan 28, 2020
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_Function.h"
 #include "ibex_HC4Revise.h"
+#include "ibex_AffineFormEval.h"
+
+using namespace std;
 
 namespace ibex {
 
-HC4Revise::HC4Revise(Eval& e) : f(e.f), eval(e), d(e.d) {
+HC4Revise::HC4Revise(Eval& e) : f(e.f), eval(e), d(e.d), incremental_ready(false), cache(false),
+		cache_eval(0), cache_y(NULL), cache_fixpoint(false), agenda(NULL) {
+
+}
 
+HC4Revise::~HC4Revise() {
+	if (cache_y) delete cache_y;
+	if (agenda) delete agenda;
+}
+
+void HC4Revise::init_incremental() {
+	int n=f.cf.n; // nodes of the root expression only
+
+	var_nodes.resize(f.nb_var());
+	input_node.assign(n,false);
+	dirty.assign(n,false);
+	input.resize(f.used_vars.size());
+	cache_x.resize(f.nb_var());
+	agenda=new Agenda(f.nb_nodes());
+
+	for (int i=0; i<n; i++) {
+		const ExprNode& e=f.node(i);
+
+		const ExprSymbol* s=dynamic_cast<const ExprSymbol*>(&e);
+		if (s) {
+			input_node[i]=true;
+			int first=f.symbol_index(s->key);
+			for (int j=0; j<s->dim.size(); j++)
+				var_nodes[first+j].push_back(i);
+			continue;
+		}
+
+		const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e);
+		if (idx && idx->indexed_symbol()) {
+			pair<const ExprSymbol*, bool**> p = idx->symbol_mask();
+			if (p.first==NULL) continue;
+			input_node[i]=true;
+			const ExprSymbol& s= *p.first;
+			int first=f.symbol_index(s.key);
+			for (int r=0; r<s.dim.nb_rows(); r++) {
+				for (int c=0; c<s.dim.nb_cols(); c++)
+					if (p.second[r][c]) var_nodes[first+r*s.dim.nb_cols()+c].push_back(i);
+				delete[] p.second[r];
+			}
+			delete[] p.second;
+		}
+	}
+
+	incremental_ready=true;
 }
 
 bool HC4Revise::proj(const Domain& y, Array<Domain>& x) {
@@ -35,6 +85,117 @@ bool HC4Revise::proj(const Domain& y, IntervalVector& x) {
 	eval.eval(x);
 	//std::cout << "forward:" << std::endl; f.cf.print(d);
 
+	return proj_bwd(y,x);
+}
+
+bool HC4Revise::proj(const Domain& y, IntervalVector& x, const BitSet& impact) {
+
+	if (!incremental_ready) init_incremental();
+
+	const vector<int>& vars=f.used_vars;
+
+	bool full = !cache || eval.nb_eval!=cache_eval || !(*cache_y==y);
+	size_t nb_changed = 0;
+
+	if (!full) {
+		for (vector<int>::const_iterator v=vars.begin(); v!=vars.end(); ++v) {
+			if (x[*v]==cache_x[*v]) continue;
+			if (!x[*v].is_subset(cache_x[*v])) {
+				full=true; // the node domains are not valid enclosures anymore
+				break;
+			}
+			if (impact[*v]) {
+				nb_changed++;
+				for (vector<int>::const_iterator i=var_nodes[*v].begin(); i!=var_nodes[*v].end(); ++i)
+					dirty[*i]=true;
+			}
+		}
+		// if most variables have changed, a full forward is cheaper
+		if (2*nb_changed > vars.size()) full=true;
+	}
+
+	if (full) {
+		dirty.assign(dirty.size(),false);
+		eval.eval(x);
+	} else {
+		if (nb_changed==0 && cache_fixpoint) return false; // the result would be the same
+
+		// the nodes depending on dirty nodes are dirty
+		agenda->flush();
+		for (int i=f.cf.n-1; i>=0; i--) {
+			if (!dirty[i] && !input_node[i]) {
+				for (int j=0; j<f.cf.nb_args[i]; j++) {
+					if (dirty[f.cf.args[i][j]]) {
+						dirty[i]=true;
+						break;
+					}
+				}
+			}
+			if (dirty[i]) agenda->push(i);
+		}
+
+		if (!agenda->empty())
+			for (int i=agenda->first(); i!=agenda->end(); i=agenda->next(i))
+				dirty[i]=false;
+
+		eval.eval(x, *agenda);
+	}
+
+	cache_eval=eval.nb_eval;
+	if (!cache_y) cache_y=new Domain(y);
+	else if (!(*cache_y==y)) *cache_y=y;
+
+	for (size_t j=0; j<vars.size(); j++)
+		input[j]=x[vars[j]];
+
+	bool is_inner=proj_bwd(y,x);
+
+	if (x.is_empty())
+		cache=false; // the node domains may be partially updated
+	else {
+		// The domains of the input nodes after backward. The node domains
+		// enclose the values of the sub-expressions for all the solutions
+		// in this box, so they can be reused for any sub-box.
+		cache_x=x;
+
+		// The input nodes of variables that have changed but not been
+		// propagated hold the domains of a previous call.
+		for (size_t j=0; j<vars.size(); j++) {
+			x[vars[j]] &= input[j];
+			if (x[vars[j]].is_empty()) {
+				x.set_empty();
+				cache=false;
+				return false;
+			}
+		}
+
+		cache=true;
+		cache_fixpoint=true;
+		for (size_t j=0; j<vars.size(); j++)
+			if (x[vars[j]]!=input[j]) {
+				cache_fixpoint=false;
+				break;
+			}
+	}
+
+	return is_inner;
+}
+
+bool HC4Revise::proj(const Domain& y, IntervalVector& x, AffineFormEval& affine) {
+	affine.eval(x);
+
+	bool is_inner=proj_bwd(y,x);
+
+	// the box is contracted by the backward phase but the
+	// linear relaxation remains valid for any sub-box.
+	if (!x.is_empty() && !is_inner)
+		affine.contract(y,x);
+
+	return is_inner;
+}
+
+bool HC4Revise::proj_bwd(const Domain& y, IntervalVector& x) {
+
 	bool is_inner=false;
 
 	try {
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Dec 31, 2011
-// Last Update : 
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_HC4_REVISE_H__
@@ -13,8 +13,12 @@
 
 #include "ibex_Eval.h"
 
+#include <vector>
+
 namespace ibex {
 
+class AffineFormEval;
+
 /**
  * \ingroup symbolic
  * \brief The famous forward-backward contraction algorithm.
@@ -31,6 +35,11 @@ public:
 	 */
 	HC4Revise(Eval& e);
 
+	/**
+	 * \brief Delete this.
+	 */
+	~HC4Revise();
+
 	/**
 	 * \brief Project f(x)=y onto x (forward/backward algorithm)
 	 *
@@ -42,6 +51,40 @@ public:
 	 */
 	bool proj(const Domain& y, IntervalVector& x);
 
+	/**
+	 * \brief Project f(x)=y onto x with incremental forward.
+	 *
+	 * Same as proj(y,x) except that the forward phase only re-evaluates
+	 * the nodes that depend on variables in \a impact whose domain has
+	 * changed since the last call. The other nodes keep the domains obtained
+	 * at the end of the last call: they are still valid enclosures if the
+	 * box is a subset of the box obtained at the end of the last call. If this
+	 * is not the case (a variable domain is not included in its domain
+	 * at the end of the last call, the evaluator has been used for another
+	 * box or y is different), a full forward is performed.
+	 *
+	 * Variables outside \a impact may have been contracted since the last
+	 * call: their domain is simply not propagated in the forward phase (the
+	 * result is intersected with their domain).
+	 *
+	 * If no variable in \a impact has changed and the last call did not
+	 * contract the box, nothing is done.
+	 */
+	bool proj(const Domain& y, IntervalVector& x, const BitSet& impact);
+
+	/**
+	 * \brief Project f(x)=y onto x with affine forward.
+	 *
+	 * Same as proj(y,x) except that the forward phase is performed
+	 * with \a affine (the domains of the nodes are intersected with the
+	 * range of their affine forms) and that, after the backward phase,
+	 * the box is further contracted with the linear relaxation of
+	 * f(x)=y given by the affine form of the root node.
+	 *
+	 * \pre \a affine is built from the same evaluator.
+	 */
+	bool proj(const Domain& y, IntervalVector& x, AffineFormEval& affine);
+
 	/**
 	 * \brief Ratio for the contraction of a
 	 * matrix-vector / matrix-matrix multiplication.
@@ -78,10 +121,35 @@ protected:
 	 */
 	bool backward(const Domain& y);
 
+	/**
+	 * Backward of f(x)=y and read the domains of x (x is set
+	 * to the empty box if the backward fails).
+	 */
+	bool proj_bwd(const Domain& y, IntervalVector& x);
+
+	/**
+	 * Initialize the data structures of the incremental forward.
+	 */
+	void init_incremental();
+
 	Function& f;
 	Eval& eval;
 	ExprDomain& d;
 
+	// ================ incremental forward ====================
+	bool incremental_ready;              // whether init_incremental() has been called
+	bool cache;                          // whether the node domains of the last call are valid
+	unsigned long cache_eval;            // eval.nb_eval after the last call
+	Domain* cache_y;                     // y in the last call
+	IntervalVector cache_x;              // domains of the input nodes at the end of the last call
+	bool cache_fixpoint;                 // whether the last call did not contract the box
+	std::vector<std::vector<int> > var_nodes; // input nodes (symbols and indexed symbols) of each variable
+	std::vector<bool> input_node;        // whether a node is an input node
+	std::vector<bool> dirty;             // nodes to be re-evaluated
+	std::vector<Interval> input;         // domains of the used variables before backward
+	Agenda* agenda;                      // nodes to be re-evaluated, in forward order
+	// =========================================================
+
 public: // because called from CompiledFunction
 	inline void idx_bwd    (int, int)          { /* nothing to do */ }
 	       void idx_cp_bwd (int, int);
@@ -0,0 +1,879 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Hessian.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_Hessian.h"
+
+using namespace std;
+
+namespace ibex {
+
+/*
+ * Forward-over-reverse differentiation.
+ *
+ * For each node y of the DAG, we have:
+ *   - d[y]: the domain of y (calculated by the evaluator)
+ *   - t[y]: the tangent, i.e., the directional derivative of y w.r.t. the
+ *           direction u (forward phase)
+ *   - g[y]: the adjoint, i.e., the partial derivative of the Lagrangian L=lambda^T*f
+ *           w.r.t. y (backward phase)
+ *   - h[y]: the tangent of the adjoint, i.e., the directional derivative of g[y]
+ *           w.r.t. u (backward phase)
+ *
+ * For y=phi(x), the backward phase reads:
+ *
+ *   g[x] += g[y]*phi'(x)
+ *   h[x] += h[y]*phi'(x) + g[y]*phi''(x)*t[x]
+ *
+ * and, at the end, h contains the Hessian-vector product (at the symbols).
+ */
+
+namespace {
+
+void vector_fwd(const ExprVector& v, ExprDomain& a, int* x, int y) {
+	int j=0;
+
+	if (v.dim.is_vector()) {
+		for (int i=0; i<v.length(); i++) {
+			if (v.arg(i).dim.is_vector()) {
+				a[y].v().put(j,a[x[i]].v());
+				j+=v.arg(i).dim.vec_size();
+			} else {
+				a[y].v()[j]=a[x[i]].i();
+				j++;
+			}
+		}
+	}
+	else {
+		if (v.row_vector()) {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					a[y].m().put(0,j,a[x[i]].m());
+					j+=v.arg(i).dim.nb_cols();
+				} else if (v.arg(i).dim.is_vector()) {
+					a[y].m().set_col(j,a[x[i]].v());
+					j++;
+				}
+			}
+		} else {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					a[y].m().put(j,0,a[x[i]].m());
+					j+=v.arg(i).dim.nb_rows();
+				} else if (v.arg(i).dim.is_vector()) {
+					a[y].m().set_row(j,a[x[i]].v());
+					j++;
+				}
+			}
+		}
+	}
+}
+
+void vector_bwd(const ExprVector& v, ExprDomain& a, int* x, int y) {
+	int j=0;
+
+	if (v.dim.is_vector()) {
+		for (int i=0; i<v.length(); i++) {
+			if (v.arg(i).dim.is_vector()) {
+				a[x[i]].v()+=a[y].v().subvector(j,j+v.arg(i).dim.vec_size()-1);
+				j+=v.arg(i).dim.vec_size();
+			} else {
+				a[x[i]].i()+=a[y].v()[j];
+				j++;
+			}
+		}
+	}
+	else {
+		if (v.row_vector()) {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					a[x[i]].m()+=a[y].m().submatrix(0,v.dim.nb_rows()-1,j,j+v.arg(i).dim.nb_cols()-1);
+					j+=v.arg(i).dim.nb_cols();
+				} else if (v.arg(i).dim.is_vector()) {
+					a[x[i]].v()+=a[y].m().col(j);
+					j++;
+				}
+			}
+		} else {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					a[x[i]].m()+=a[y].m().submatrix(j,j+v.arg(i).dim.nb_rows()-1,0,v.dim.nb_cols()-1);
+					j+=v.arg(i).dim.nb_rows();
+				} else if (v.arg(i).dim.is_vector()) {
+					a[x[i]].v()+=a[y].m().row(j);
+					j++;
+				}
+			}
+		}
+	}
+}
+
+void idx_cp_bwd(const ExprIndex& e, ExprDomain& a, int x, int y) {
+	Domain ax=a[x][e.index];
+	ax = ax + a[y];
+	a[x].put(e.index.first_row(), e.index.first_col(), ax);
+}
+
+// sum of the products of the coefficients of two matrices
+Interval inner(const IntervalMatrix& m1, const IntervalMatrix& m2) {
+	Interval res=Interval::zero();
+	for (int i=0; i<m1.nb_rows(); i++)
+		res+=m1[i]*m2[i];
+	return res;
+}
+
+/*
+ * First-order derivatives of chi(a,b,c) (see Gradient::chi_bwd)
+ * Return true if chi is smooth on the domains.
+ */
+bool chi_diff(const Interval& a, const Interval& b, const Interval& c, Interval& ga, Interval& gb, Interval& gc) {
+	if (a.ub()<0) {
+		ga=Interval::zero();
+		gb=Interval::one();
+		gc=Interval::zero();
+		return true;
+	} else if (a.lb()>0) {
+		ga=Interval::zero();
+		gb=Interval::zero();
+		gc=Interval::one();
+		return true;
+	} else {
+		if (b.is_degenerated() && c.is_degenerated()) {
+			double _b=b.ub();
+			double _c=c.ub();
+			if (_b<_c) ga=Interval::pos_reals();
+			else if (_b>_c) ga=Interval::neg_reals();
+			else ga=Interval::zero();
+		} else {
+			ga=Interval::all_reals();
+		}
+		gb=Interval(0,1);
+		gc=Interval(0,1);
+		return false;
+	}
+}
+
+/*
+ * First-order derivatives of max(x1,x2) (see Gradient::max_bwd)
+ * Return true if max is smooth on the domains.
+ */
+bool max_diff(const Interval& x1, const Interval& x2, Interval& g1, Interval& g2) {
+	if (x1.lb() > x2.ub()) {
+		g1=Interval::one();
+		g2=Interval::zero();
+		return true;
+	} else if (x2.lb() > x1.ub()) {
+		g1=Interval::zero();
+		g2=Interval::one();
+		return true;
+	} else {
+		g1=Interval(0,1);
+		g2=Interval(0,1);
+		return false;
+	}
+}
+
+// second-order derivative of a function with first-order
+// derivative constant (smooth=true) or discontinuous.
+Interval kink(bool smooth) {
+	return smooth? Interval::zero() : Interval::all_reals();
+}
+
+} // end anonymous namespace
+
+Hessian::Hessian(Eval& e) : f(e.f), _eval(e), d(e.d), t(f), g(f), h(f) {
+
+	if (f.expr().dim.is_matrix())
+		throw Unsupported();
+
+	for (int i=0; i<f.nb_nodes(); i++) {
+		switch(f.node(i).type_id()) {
+		case ExprNode::NumExprApply:
+		case ExprNode::NumExprGenericUnaryOp:
+		case ExprNode::NumExprGenericBinaryOp:
+			throw Unsupported();
+		default:
+			break;
+		}
+	}
+}
+
+Hessian::~Hessian() {
+
+}
+
+void Hessian::calc_hessian(const IntervalVector& box, const IntervalVector& lambda, IntervalMatrix& H, IntervalMatrix* J, int v) {
+
+	int n=f.nb_var();
+
+	assert(box.size()==n);
+	assert(lambda.size()==f.image_dim());
+	assert(H.nb_rows()==n && H.nb_cols()==n);
+	assert(!J || (J->nb_rows()==f.image_dim() && J->nb_cols()==n));
+
+	if (_eval.eval(box).is_empty()) {
+		// outside definition domain -> empty hessian
+		H.set_empty();
+		if (J) J->set_empty();
+		return;
+	}
+
+	IntervalVector u(n);
+	IntervalVector Hu(n);
+
+	for (int j=(v==-1? 0 : v); j<(v==-1? n : v+1); j++) {
+		u.clear();
+		u[j]=1.0;
+
+		hessian_vector(lambda,u,Hu);
+
+		if (Hu.is_empty()) {
+			H.set_empty();
+			if (J) J->set_empty();
+			return;
+		}
+
+		H.set_col(j,Hu);
+
+		if (J) {
+			if (f.expr().dim.is_scalar())
+				(*J)[0][j]=t.top->i();
+			else
+				J->set_col(j,t.top->v());
+		}
+	}
+
+	// the Hessian matrix is symmetric
+	if (v==-1) H &= H.transpose();
+}
+
+void Hessian::hessian_vector(const IntervalVector& box, const IntervalVector& lambda, const IntervalVector& u, IntervalVector& Hu) {
+	if (_eval.eval(box).is_empty()) {
+		Hu.set_empty();
+		return;
+	}
+
+	hessian_vector(lambda,u,Hu);
+}
+
+void Hessian::hessian_vector(const IntervalVector& lambda, const IntervalVector& u, IntervalVector& Hu) {
+
+	t.write_arg_domains(u);
+
+	// variables that do not appear in f
+	Hu.clear();
+	g.write_arg_domains(Hu);
+	h.write_arg_domains(Hu);
+
+	f.forward<Hessian>(*this);
+
+	if (f.expr().dim.is_scalar())
+		g.top->i()=lambda[0];
+	else
+		g.top->v()=lambda;
+
+	f.backward<Hessian>(*this);
+
+	h.read_arg_domains(Hu);
+}
+
+void Hessian::clear(int y) {
+	g[y].clear();
+	h[y].clear();
+}
+
+void Hessian::unary_bwd(int x, int y, const Interval& d1, const Interval& d2) {
+	g[x].i() += g[y].i()*d1;
+	h[x].i() += h[y].i()*d1 + g[y].i()*d2*t[x].i();
+}
+
+void Hessian::binary_bwd(int x1, int x2, int y, const Interval& d1, const Interval& d2, const Interval& d11, const Interval& d12, const Interval& d22) {
+	g[x1].i() += g[y].i()*d1;
+	g[x2].i() += g[y].i()*d2;
+	h[x1].i() += h[y].i()*d1 + g[y].i()*(d11*t[x1].i() + d12*t[x2].i());
+	h[x2].i() += h[y].i()*d2 + g[y].i()*(d12*t[x1].i() + d22*t[x2].i());
+}
+
+/* ====================================== Forward =================================== */
+
+void Hessian::idx_cp_fwd(int x, int y) {
+	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
+
+	const ExprIndex& e = (const ExprIndex&) f.node(y);
+
+	t[y] = t[x][e.index];
+	clear(y);
+}
+
+void Hessian::vector_fwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	::ibex::vector_fwd((const ExprVector&) f.node(y), t, x, y);
+	clear(y);
+}
+
+void Hessian::cst_fwd(int y) {
+	t[y].clear();
+	clear(y);
+}
+
+void Hessian::symbol_fwd(int y) {
+	clear(y);
+}
+
+void Hessian::apply_fwd(int*, int) {
+	not_implemented("Hessian of a function with sub-function calls");
+}
+
+void Hessian::gen1_fwd(int, int) {
+	not_implemented("Hessian of a function with generic operators");
+}
+
+void Hessian::gen2_fwd(int, int, int) {
+	not_implemented("Hessian of a function with generic operators");
+}
+
+void Hessian::chi_fwd(int a, int b, int c, int y) {
+	Interval ga,gb,gc;
+	chi_diff(d[a].i(),d[b].i(),d[c].i(),ga,gb,gc);
+	t[y].i()=ga*t[a].i()+gb*t[b].i()+gc*t[c].i();
+	clear(y);
+}
+
+void Hessian::add_fwd(int x1, int x2, int y) {
+	t[y].i()=t[x1].i()+t[x2].i();
+	clear(y);
+}
+
+void Hessian::mul_fwd(int x1, int x2, int y) {
+	t[y].i()=t[x1].i()*d[x2].i()+d[x1].i()*t[x2].i();
+	clear(y);
+}
+
+void Hessian::sub_fwd(int x1, int x2, int y) {
+	t[y].i()=t[x1].i()-t[x2].i();
+	clear(y);
+}
+
+void Hessian::div_fwd(int x1, int x2, int y) {
+	t[y].i()=(t[x1].i()-d[y].i()*t[x2].i())/d[x2].i();
+	clear(y);
+}
+
+void Hessian::max_fwd(int x1, int x2, int y) {
+	Interval g1,g2;
+	max_diff(d[x1].i(),d[x2].i(),g1,g2);
+	t[y].i()=g1*t[x1].i()+g2*t[x2].i();
+	clear(y);
+}
+
+void Hessian::min_fwd(int x1, int x2, int y) {
+	Interval g1,g2;
+	max_diff(d[x2].i(),d[x1].i(),g2,g1);
+	t[y].i()=g1*t[x1].i()+g2*t[x2].i();
+	clear(y);
+}
+
+void Hessian::atan2_fwd(int x1, int x2, int y) {
+	Interval r=sqr(d[x1].i())+sqr(d[x2].i());
+	t[y].i()=(d[x2].i()*t[x1].i()-d[x1].i()*t[x2].i())/r;
+	clear(y);
+}
+
+void Hessian::minus_fwd(int x, int y) {
+	t[y].i()=-t[x].i();
+	clear(y);
+}
+
+void Hessian::minus_V_fwd(int x, int y) {
+	t[y].v()=-t[x].v();
+	clear(y);
+}
+
+void Hessian::minus_M_fwd(int x, int y) {
+	t[y].m()=-t[x].m();
+	clear(y);
+}
+
+void Hessian::trans_V_fwd(int, int y) {
+	// t[y] is a reference to t[x]
+	clear(y);
+}
+
+void Hessian::trans_M_fwd(int x, int y) {
+	t[y].m()=t[x].m().transpose();
+	clear(y);
+}
+
+void Hessian::sign_fwd(int x, int y) {
+	if (d[x].i().contains(0)) t[y].i()=Interval::pos_reals()*t[x].i();
+	else t[y].i()=0;
+	clear(y);
+}
+
+void Hessian::abs_fwd(int x, int y) {
+	if (d[x].i().lb()>0) t[y].i()=t[x].i();
+	else if (d[x].i().ub()<0) t[y].i()=-t[x].i();
+	else t[y].i()=Interval(-1,1)*t[x].i();
+	clear(y);
+}
+
+void Hessian::power_fwd(int x, int y, int p) {
+	t[y].i()=p*pow(d[x].i(),p-1)*t[x].i();
+	clear(y);
+}
+
+void Hessian::sqr_fwd(int x, int y) {
+	t[y].i()=2.0*d[x].i()*t[x].i();
+	clear(y);
+}
+
+void Hessian::sqrt_fwd(int x, int y) {
+	t[y].i()=0.5*t[x].i()/d[y].i();
+	clear(y);
+}
+
+void Hessian::exp_fwd(int x, int y) {
+	t[y].i()=d[y].i()*t[x].i();
+	clear(y);
+}
+
+void Hessian::log_fwd(int x, int y) {
+	t[y].i()=t[x].i()/d[x].i();
+	clear(y);
+}
+
+void Hessian::cos_fwd(int x, int y) {
+	t[y].i()=-sin(d[x].i())*t[x].i();
+	clear(y);
+}
+
+void Hessian::sin_fwd(int x, int y) {
+	t[y].i()=cos(d[x].i())*t[x].i();
+	clear(y);
+}
+
+void Hessian::tan_fwd(int x, int y) {
+	t[y].i()=(1.0+sqr(d[y].i()))*t[x].i();
+	clear(y);
+}
+
+void Hessian::cosh_fwd(int x, int y) {
+	t[y].i()=sinh(d[x].i())*t[x].i();
+	clear(y);
+}
+
+void Hessian::sinh_fwd(int x, int y) {
+	t[y].i()=cosh(d[x].i())*t[x].i();
+	clear(y);
+}
+
+void Hessian::tanh_fwd(int x, int y) {
+	t[y].i()=(1.0-sqr(d[y].i()))*t[x].i();
+	clear(y);
+}
+
+void Hessian::acos_fwd(int x, int y) {
+	t[y].i()=-t[x].i()/sqrt(1.0-sqr(d[x].i()));
+	clear(y);
+}
+
+void Hessian::asin_fwd(int x, int y) {
+	t[y].i()=t[x].i()/sqrt(1.0-sqr(d[x].i()));
+	clear(y);
+}
+
+void Hessian::atan_fwd(int x, int y) {
+	t[y].i()=t[x].i()/(1.0+sqr(d[x].i()));
+	clear(y);
+}
+
+void Hessian::acosh_fwd(int x, int y) {
+	t[y].i()=t[x].i()/sqrt(sqr(d[x].i())-1.0);
+	clear(y);
+}
+
+void Hessian::asinh_fwd(int x, int y) {
+	t[y].i()=t[x].i()/sqrt(1.0+sqr(d[x].i()));
+	clear(y);
+}
+
+void Hessian::atanh_fwd(int x, int y) {
+	t[y].i()=t[x].i()/(1.0-sqr(d[x].i()));
+	clear(y);
+}
+
+void Hessian::floor_fwd(int x, int y) {
+	if (std::floor(d[x].i().ub()) >= d[x].i().lb()) t[y].i()=Interval::pos_reals()*t[x].i();
+	else t[y].i()=0;
+	clear(y);
+}
+
+void Hessian::ceil_fwd(int x, int y) {
+	floor_fwd(x,y);
+}
+
+void Hessian::saw_fwd(int x, int y) {
+	if (round(d[x].i().lb()) == round(d[x].i().ub())) t[y].i()=t[x].i();
+	else t[y].i()=Interval(NEG_INFINITY,1)*t[x].i();
+	clear(y);
+}
+
+void Hessian::add_V_fwd(int x1, int x2, int y) {
+	t[y].v()=t[x1].v()+t[x2].v();
+	clear(y);
+}
+
+void Hessian::add_M_fwd(int x1, int x2, int y) {
+	t[y].m()=t[x1].m()+t[x2].m();
+	clear(y);
+}
+
+void Hessian::mul_SV_fwd(int x1, int x2, int y) {
+	t[y].v()=t[x1].i()*d[x2].v()+d[x1].i()*t[x2].v();
+	clear(y);
+}
+
+void Hessian::mul_SM_fwd(int x1, int x2, int y) {
+	t[y].m()=t[x1].i()*d[x2].m()+d[x1].i()*t[x2].m();
+	clear(y);
+}
+
+void Hessian::mul_VV_fwd(int x1, int x2, int y) {
+	t[y].i()=t[x1].v()*d[x2].v()+d[x1].v()*t[x2].v();
+	clear(y);
+}
+
+void Hessian::mul_MV_fwd(int x1, int x2, int y) {
+	t[y].v()=t[x1].m()*d[x2].v()+d[x1].m()*t[x2].v();
+	clear(y);
+}
+
+void Hessian::mul_VM_fwd(int x1, int x2, int y) {
+	t[y].v()=t[x1].v()*d[x2].m()+d[x1].v()*t[x2].m();
+	clear(y);
+}
+
+void Hessian::mul_MM_fwd(int x1, int x2, int y) {
+	t[y].m()=t[x1].m()*d[x2].m()+d[x1].m()*t[x2].m();
+	clear(y);
+}
+
+void Hessian::sub_V_fwd(int x1, int x2, int y) {
+	t[y].v()=t[x1].v()-t[x2].v();
+	clear(y);
+}
+
+void Hessian::sub_M_fwd(int x1, int x2, int y) {
+	t[y].m()=t[x1].m()-t[x2].m();
+	clear(y);
+}
+
+/* ====================================== Backward =================================== */
+
+void Hessian::idx_cp_bwd(int x, int y) {
+	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
+
+	const ExprIndex& e = (const ExprIndex&) f.node(y);
+
+	::ibex::idx_cp_bwd(e, g, x, y);
+	::ibex::idx_cp_bwd(e, h, x, y);
+}
+
+void Hessian::vector_bwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	const ExprVector& v = (const ExprVector&) f.node(y);
+
+	::ibex::vector_bwd(v, g, x, y);
+	::ibex::vector_bwd(v, h, x, y);
+}
+
+void Hessian::apply_bwd(int*, int) {
+	not_implemented("Hessian of a function with sub-function calls");
+}
+
+void Hessian::gen1_bwd(int, int) {
+	not_implemented("Hessian of a function with generic operators");
+}
+
+void Hessian::gen2_bwd(int, int, int) {
+	not_implemented("Hessian of a function with generic operators");
+}
+
+void Hessian::chi_bwd(int a, int b, int c, int y) {
+	Interval ga,gb,gc;
+	Interval d2=kink(chi_diff(d[a].i(),d[b].i(),d[c].i(),ga,gb,gc));
+	Interval ty=t[a].i()+t[b].i()+t[c].i();
+
+	g[a].i() += g[y].i()*ga;
+	g[b].i() += g[y].i()*gb;
+	g[c].i() += g[y].i()*gc;
+	h[a].i() += h[y].i()*ga + g[y].i()*d2*ty;
+	h[b].i() += h[y].i()*gb + g[y].i()*d2*ty;
+	h[c].i() += h[y].i()*gc + g[y].i()*d2*ty;
+}
+
+void Hessian::add_bwd(int x1, int x2, int y) {
+	g[x1].i() += g[y].i();
+	g[x2].i() += g[y].i();
+	h[x1].i() += h[y].i();
+	h[x2].i() += h[y].i();
+}
+
+void Hessian::mul_bwd(int x1, int x2, int y) {
+	g[x1].i() += g[y].i()*d[x2].i();
+	g[x2].i() += g[y].i()*d[x1].i();
+	h[x1].i() += h[y].i()*d[x2].i() + g[y].i()*t[x2].i();
+	h[x2].i() += h[y].i()*d[x1].i() + g[y].i()*t[x1].i();
+}
+
+void Hessian::sub_bwd(int x1, int x2, int y) {
+	g[x1].i() += g[y].i();
+	g[x2].i() -= g[y].i();
+	h[x1].i() += h[y].i();
+	h[x2].i() -= h[y].i();
+}
+
+void Hessian::div_bwd(int x1, int x2, int y) {
+	const Interval& x=d[x1].i();
+	const Interval& z=d[x2].i();
+	Interval z2=sqr(z);
+	binary_bwd(x1, x2, y, 1.0/z, -x/z2, Interval::zero(), -1.0/z2, 2.0*x/(z2*z));
+}
+
+void Hessian::max_bwd(int x1, int x2, int y) {
+	Interval g1,g2;
+	Interval d2=kink(max_diff(d[x1].i(),d[x2].i(),g1,g2));
+	binary_bwd(x1, x2, y, g1, g2, d2, d2, d2);
+}
+
+void Hessian::min_bwd(int x1, int x2, int y) {
+	Interval g1,g2;
+	Interval d2=kink(max_diff(d[x2].i(),d[x1].i(),g2,g1));
+	binary_bwd(x1, x2, y, g1, g2, d2, d2, d2);
+}
+
+void Hessian::atan2_bwd(int x1, int x2, int y) {
+	const Interval& a=d[x1].i();
+	const Interval& b=d[x2].i();
+	Interval r=sqr(a)+sqr(b);
+	Interval r2=sqr(r);
+	binary_bwd(x1, x2, y, b/r, -a/r, -2.0*a*b/r2, (sqr(a)-sqr(b))/r2, 2.0*a*b/r2);
+}
+
+void Hessian::minus_bwd(int x, int y) {
+	g[x].i() -= g[y].i();
+	h[x].i() -= h[y].i();
+}
+
+void Hessian::minus_V_bwd(int x, int y) {
+	g[x].v() -= g[y].v();
+	h[x].v() -= h[y].v();
+}
+
+void Hessian::minus_M_bwd(int x, int y) {
+	g[x].m() -= g[y].m();
+	h[x].m() -= h[y].m();
+}
+
+void Hessian::trans_M_bwd(int x, int y) {
+	g[x].m() += g[y].m().transpose();
+	h[x].m() += h[y].m().transpose();
+}
+
+void Hessian::sign_bwd(int x, int y) {
+	bool smooth=!d[x].i().contains(0);
+	unary_bwd(x, y, smooth? Interval::zero() : Interval::pos_reals(), kink(smooth));
+}
+
+void Hessian::abs_bwd(int x, int y) {
+	if (d[x].i().lb()>0) unary_bwd(x, y, Interval::one(), Interval::zero());
+	else if (d[x].i().ub()<0) unary_bwd(x, y, -Interval::one(), Interval::zero());
+	else unary_bwd(x, y, Interval(-1,1), Interval::all_reals());
+}
+
+void Hessian::power_bwd(int x, int y, int p) {
+	const Interval& z=d[x].i();
+	switch(p) {
+	case 0:  unary_bwd(x, y, Interval::zero(), Interval::zero()); break;
+	case 1:  unary_bwd(x, y, Interval::one(), Interval::zero()); break;
+	default: unary_bwd(x, y, p*pow(z,p-1), (p*(p-1))*pow(z,p-2));
+	}
+}
+
+void Hessian::sqr_bwd(int x, int y) {
+	unary_bwd(x, y, 2.0*d[x].i(), Interval(2.0));
+}
+
+void Hessian::sqrt_bwd(int x, int y) {
+	const Interval& s=d[y].i(); // sqrt(x)
+	unary_bwd(x, y, 0.5/s, -0.25/(d[x].i()*s));
+}
+
+void Hessian::exp_bwd(int x, int y) {
+	unary_bwd(x, y, d[y].i(), d[y].i());
+}
+
+void Hessian::log_bwd(int x, int y) {
+	const Interval& z=d[x].i();
+	unary_bwd(x, y, 1.0/z, -1.0/sqr(z));
+}
+
+void Hessian::cos_bwd(int x, int y) {
+	unary_bwd(x, y, -sin(d[x].i()), -d[y].i());
+}
+
+void Hessian::sin_bwd(int x, int y) {
+	unary_bwd(x, y, cos(d[x].i()), -d[y].i());
+}
+
+void Hessian::tan_bwd(int x, int y) {
+	Interval d1=1.0+sqr(d[y].i());
+	unary_bwd(x, y, d1, 2.0*d[y].i()*d1);
+}
+
+void Hessian::cosh_bwd(int x, int y) {
+	unary_bwd(x, y, sinh(d[x].i()), d[y].i());
+}
+
+void Hessian::sinh_bwd(int x, int y) {
+	unary_bwd(x, y, cosh(d[x].i()), d[y].i());
+}
+
+void Hessian::tanh_bwd(int x, int y) {
+	Interval d1=1.0-sqr(d[y].i());
+	unary_bwd(x, y, d1, -2.0*d[y].i()*d1);
+}
+
+void Hessian::acos_bwd(int x, int y) {
+	const Interval& z=d[x].i();
+	Interval r=1.0-sqr(z);
+	Interval s=sqrt(r);
+	unary_bwd(x, y, -1.0/s, -z/(r*s));
+}
+
+void Hessian::asin_bwd(int x, int y) {
+	const Interval& z=d[x].i();
+	Interval r=1.0-sqr(z);
+	Interval s=sqrt(r);
+	unary_bwd(x, y, 1.0/s, z/(r*s));
+}
+
+void Hessian::atan_bwd(int x, int y) {
+	const Interval& z=d[x].i();
+	Interval r=1.0+sqr(z);
+	unary_bwd(x, y, 1.0/r, -2.0*z/sqr(r));
+}
+
+void Hessian::acosh_bwd(int x, int y) {
+	const Interval& z=d[x].i();
+	Interval r=sqr(z)-1.0;
+	Interval s=sqrt(r);
+	unary_bwd(x, y, 1.0/s, -z/(r*s));
+}
+
+void Hessian::asinh_bwd(int x, int y) {
+	const Interval& z=d[x].i();
+	Interval r=1.0+sqr(z);
+	Interval s=sqrt(r);
+	unary_bwd(x, y, 1.0/s, -z/(r*s));
+}
+
+void Hessian::atanh_bwd(int x, int y) {
+	const Interval& z=d[x].i();
+	Interval r=1.0-sqr(z);
+	unary_bwd(x, y, 1.0/r, 2.0*z/sqr(r));
+}
+
+void Hessian::floor_bwd(int x, int y) {
+	bool smooth=std::floor(d[x].i().ub()) < d[x].i().lb();
+	unary_bwd(x, y, smooth? Interval::zero() : Interval::pos_reals(), kink(smooth));
+}
+
+void Hessian::ceil_bwd(int x, int y) {
+	floor_bwd(x,y);
+}
+
+void Hessian::saw_bwd(int x, int y) {
+	bool smooth=round(d[x].i().lb()) == round(d[x].i().ub());
+	unary_bwd(x, y, smooth? Interval::one() : Interval(NEG_INFINITY,1), kink(smooth));
+}
+
+void Hessian::add_V_bwd(int x1, int x2, int y) {
+	g[x1].v() += g[y].v();
+	g[x2].v() += g[y].v();
+	h[x1].v() += h[y].v();
+	h[x2].v() += h[y].v();
+}
+
+void Hessian::add_M_bwd(int x1, int x2, int y) {
+	g[x1].m() += g[y].m();
+	g[x2].m() += g[y].m();
+	h[x1].m() += h[y].m();
+	h[x2].m() += h[y].m();
+}
+
+void Hessian::mul_SV_bwd(int x1, int x2, int y) {
+	g[x1].i() += g[y].v()*d[x2].v();
+	g[x2].v() += d[x1].i()*g[y].v();
+	h[x1].i() += h[y].v()*d[x2].v() + g[y].v()*t[x2].v();
+	h[x2].v() += d[x1].i()*h[y].v() + t[x1].i()*g[y].v();
+}
+
+void Hessian::mul_SM_bwd(int x1, int x2, int y) {
+	g[x1].i() += inner(g[y].m(),d[x2].m());
+	g[x2].m() += d[x1].i()*g[y].m();
+	h[x1].i() += inner(h[y].m(),d[x2].m()) + inner(g[y].m(),t[x2].m());
+	h[x2].m() += d[x1].i()*h[y].m() + t[x1].i()*g[y].m();
+}
+
+void Hessian::mul_VV_bwd(int x1, int x2, int y) {
+	g[x1].v() += g[y].i()*d[x2].v();
+	g[x2].v() += g[y].i()*d[x1].v();
+	h[x1].v() += h[y].i()*d[x2].v() + g[y].i()*t[x2].v();
+	h[x2].v() += h[y].i()*d[x1].v() + g[y].i()*t[x1].v();
+}
+
+void Hessian::mul_MV_bwd(int x1, int x2, int y) {
+	g[x1].m() += outer_product(g[y].v(),d[x2].v());
+	g[x2].v() += d[x1].m().transpose()*g[y].v();
+	h[x1].m() += outer_product(h[y].v(),d[x2].v()) + outer_product(g[y].v(),t[x2].v());
+	h[x2].v() += d[x1].m().transpose()*h[y].v() + t[x1].m().transpose()*g[y].v();
+}
+
+void Hessian::mul_VM_bwd(int x1, int x2, int y) {
+	g[x1].v() += d[x2].m()*g[y].v();
+	g[x2].m() += outer_product(d[x1].v(),g[y].v());
+	h[x1].v() += d[x2].m()*h[y].v() + t[x2].m()*g[y].v();
+	h[x2].m() += outer_product(d[x1].v(),h[y].v()) + outer_product(t[x1].v(),g[y].v());
+}
+
+void Hessian::mul_MM_bwd(int x1, int x2, int y) {
+	g[x1].m() += g[y].m()*d[x2].m().transpose();
+	g[x2].m() += d[x1].m().transpose()*g[y].m();
+	h[x1].m() += h[y].m()*d[x2].m().transpose() + g[y].m()*t[x2].m().transpose();
+	h[x2].m() += d[x1].m().transpose()*h[y].m() + t[x1].m().transpose()*g[y].m();
+}
+
+void Hessian::sub_V_bwd(int x1, int x2, int y) {
+	g[x1].v() += g[y].v();
+	g[x2].v() -= g[y].v();
+	h[x1].v() += h[y].v();
+	h[x2].v() -= h[y].v();
+}
+
+void Hessian::sub_M_bwd(int x1, int x2, int y) {
+	g[x1].m() += g[y].m();
+	g[x2].m() -= g[y].m();
+	h[x1].m() += h[y].m();
+	h[x2].m() -= h[y].m();
+}
+
+} // namespace ibex
@@ -0,0 +1,263 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Hessian.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_HESSIAN_H__
+#define __IBEX_HESSIAN_H__
+
+#include "ibex_Eval.h"
+#include "ibex_BwdAlgorithm.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ * \brief Calculates the Hessian of a (weighted sum of) function(s).
+ *
+ * Given f:R^n->R^m and a vector of weights lambda (e.g., Lagrange multipliers),
+ * this class calculates an enclosure of the Hessian matrix of the "Lagrangian"
+ *
+ *    lambda[0]*f_0(x) + ... + lambda[m-1]*f_{m-1}(x)
+ *
+ * by automatic differentiation (forward-over-reverse mode) on the DAG
+ * of f. No symbolic differentiation is performed.
+ *
+ * A Hessian-vector product costs one forward (tangent) and one backward
+ * (adjoint) sweep of the DAG, whatever the number of components of f
+ * (common subexpressions are handled once). A full Hessian matrix costs
+ * n such products. The Jacobian-vector product f'(x).u is obtained as a
+ * by-product of the forward sweep.
+ *
+ * Non-smooth operators (abs, max, sign, etc.) are supported: the second-order
+ * derivatives are unbounded if the domain of the argument contains a
+ * non-differentiable point.
+ */
+class Hessian : public FwdAlgorithm, public BwdAlgorithm {
+
+public:
+
+	/**
+	 * \brief Thrown if the function is not supported.
+	 *
+	 * This is the case of matrix-valued functions and functions involving
+	 * sub-function calls (see #ExprApply) or generic operators.
+	 */
+	class Unsupported : public Exception { };
+
+	/**
+	 * \brief Build the Hessian algorithm.
+	 *
+	 * For memory saving, the algorithm is built from an
+	 * already existing Eval object (as #Gradient).
+	 *
+	 * \throw Unsupported - see #Unsupported.
+	 */
+	Hessian(Eval& eval);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~Hessian();
+
+	/**
+	 * \brief Calculate the Hessian of a real-valued function f on the box \a box and store the result in \a H.
+	 *
+	 * \param v - only update the vth column of H. Default value is -1
+	 *            (means: update all the columns).
+	 */
+	void hessian(const IntervalVector& box, IntervalMatrix& H, int v=-1);
+
+	/**
+	 * \brief Calculate the Hessian of lambda^T*f on the box \a box and store the result in \a H.
+	 *
+	 * \param lambda - the weights of the components of f (size 1 if f is real-valued).
+	 * \param v      - only update the vth column of H. Default value is -1
+	 *                 (means: update all the columns).
+	 */
+	void hessian(const IntervalVector& box, const IntervalVector& lambda, IntervalMatrix& H, int v=-1);
+
+	/**
+	 * \brief Same as hessian(box,lambda,H,v) but also calculate the Jacobian matrix \a J of f.
+	 *
+	 * The Jacobian matrix is obtained for free (no additional sweep of the DAG).
+	 * If v!=-1, only the vth column of J is updated.
+	 */
+	void hessian(const IntervalVector& box, const IntervalVector& lambda, IntervalMatrix& H, IntervalMatrix& J, int v=-1);
+
+	/**
+	 * \brief Calculate the product of the Hessian of lambda^T*f on \a box by the vector \a u.
+	 */
+	void hessian_vector(const IntervalVector& box, const IntervalVector& lambda, const IntervalVector& u, IntervalVector& Hu);
+
+	/* ====================================== Forward =================================== */
+
+	void idx_fwd    (int, int) { /* nothing to do */ }
+	void idx_cp_fwd (int x, int y);
+	void vector_fwd (int* x, int y);
+	void cst_fwd    (int y);
+	void symbol_fwd (int y);
+	void apply_fwd  (int* x, int y);
+	void chi_fwd    (int x1, int x2, int x3, int y);
+	void gen2_fwd   (int x1, int x2, int y);
+	void add_fwd    (int x1, int x2, int y);
+	void mul_fwd    (int x1, int x2, int y);
+	void sub_fwd    (int x1, int x2, int y);
+	void div_fwd    (int x1, int x2, int y);
+	void max_fwd    (int x1, int x2, int y);
+	void min_fwd    (int x1, int x2, int y);
+	void atan2_fwd  (int x1, int x2, int y);
+	void gen1_fwd   (int x, int y);
+	void minus_fwd  (int x, int y);
+	void minus_V_fwd(int x, int y);
+	void minus_M_fwd(int x, int y);
+	void trans_V_fwd(int x, int y);
+	void trans_M_fwd(int x, int y);
+	void sign_fwd   (int x, int y);
+	void abs_fwd    (int x, int y);
+	void power_fwd  (int x, int y, int p);
+	void sqr_fwd    (int x, int y);
+	void sqrt_fwd   (int x, int y);
+	void exp_fwd    (int x, int y);
+	void log_fwd    (int x, int y);
+	void cos_fwd    (int x, int y);
+	void sin_fwd    (int x, int y);
+	void tan_fwd    (int x, int y);
+	void cosh_fwd   (int x, int y);
+	void sinh_fwd   (int x, int y);
+	void tanh_fwd   (int x, int y);
+	void acos_fwd   (int x, int y);
+	void asin_fwd   (int x, int y);
+	void atan_fwd   (int x, int y);
+	void acosh_fwd  (int x, int y);
+	void asinh_fwd  (int x, int y);
+	void atanh_fwd  (int x, int y);
+	void floor_fwd  (int x, int y);
+	void ceil_fwd   (int x, int y);
+	void saw_fwd    (int x, int y);
+	void add_V_fwd  (int x1, int x2, int y);
+	void add_M_fwd  (int x1, int x2, int y);
+	void mul_SV_fwd (int x1, int x2, int y);
+	void mul_SM_fwd (int x1, int x2, int y);
+	void mul_VV_fwd (int x1, int x2, int y);
+	void mul_MV_fwd (int x1, int x2, int y);
+	void mul_VM_fwd (int x1, int x2, int y);
+	void mul_MM_fwd (int x1, int x2, int y);
+	void sub_V_fwd  (int x1, int x2, int y);
+	void sub_M_fwd  (int x1, int x2, int y);
+
+	/* ====================================== Backward =================================== */
+
+	void idx_bwd    (int, int) { /* nothing to do */ }
+	void idx_cp_bwd (int x, int y);
+	void vector_bwd (int* x, int y);
+	void symbol_bwd (int) { /* nothing to do */ }
+	void cst_bwd    (int) { /* nothing to do */ }
+	void apply_bwd  (int* x, int y);
+	void chi_bwd    (int x1, int x2, int x3, int y);
+	void gen2_bwd   (int x1, int x2, int y);
+	void add_bwd    (int x1, int x2, int y);
+	void mul_bwd    (int x1, int x2, int y);
+	void sub_bwd    (int x1, int x2, int y);
+	void div_bwd    (int x1, int x2, int y);
+	void max_bwd    (int x1, int x2, int y);
+	void min_bwd    (int x1, int x2, int y);
+	void atan2_bwd  (int x1, int x2, int y);
+	void gen1_bwd   (int x, int y);
+	void minus_bwd  (int x, int y);
+	void minus_V_bwd(int x, int y);
+	void minus_M_bwd(int x, int y);
+	void trans_V_bwd(int, int) { /* nothing to do: g[x] and h[x] are references to g[y] and h[y] */ }
+	void trans_M_bwd(int x, int y);
+	void sign_bwd   (int x, int y);
+	void abs_bwd    (int x, int y);
+	void power_bwd  (int x, int y, int p);
+	void sqr_bwd    (int x, int y);
+	void sqrt_bwd   (int x, int y);
+	void exp_bwd    (int x, int y);
+	void log_bwd    (int x, int y);
+	void cos_bwd    (int x, int y);
+	void sin_bwd    (int x, int y);
+	void tan_bwd    (int x, int y);
+	void cosh_bwd   (int x, int y);
+	void sinh_bwd   (int x, int y);
+	void tanh_bwd   (int x, int y);
+	void acos_bwd   (int x, int y);
+	void asin_bwd   (int x, int y);
+	void atan_bwd   (int x, int y);
+	void acosh_bwd  (int x, int y);
+	void asinh_bwd  (int x, int y);
+	void atanh_bwd  (int x, int y);
+	void floor_bwd  (int x, int y);
+	void ceil_bwd   (int x, int y);
+	void saw_bwd    (int x, int y);
+	void add_V_bwd  (int x1, int x2, int y);
+	void add_M_bwd  (int x1, int x2, int y);
+	void mul_SV_bwd (int x1, int x2, int y);
+	void mul_SM_bwd (int x1, int x2, int y);
+	void mul_VV_bwd (int x1, int x2, int y);
+	void mul_MV_bwd (int x1, int x2, int y);
+	void mul_VM_bwd (int x1, int x2, int y);
+	void mul_MM_bwd (int x1, int x2, int y);
+	void sub_V_bwd  (int x1, int x2, int y);
+	void sub_M_bwd  (int x1, int x2, int y);
+
+	Function& f;
+	Eval& _eval;
+
+	/** Domains (shared with the evaluator). */
+	ExprDomain& d;
+
+	/** Tangents (directional derivatives). */
+	ExprDomain t;
+
+	/** Adjoints (partial derivatives of the Lagrangian). */
+	ExprDomain g;
+
+	/** Tangents of the adjoints. */
+	ExprDomain h;
+
+protected:
+
+	/*
+	 * Hessian-vector product (f must be evaluated before).
+	 * The Jacobian-vector product is stored in "t.top".
+	 */
+	void hessian_vector(const IntervalVector& lambda, const IntervalVector& u, IntervalVector& Hu);
+
+	/*
+	 * Hessian of lambda^T*f (and Jacobian of f if J!=NULL).
+	 */
+	void calc_hessian(const IntervalVector& box, const IntervalVector& lambda, IntervalMatrix& H, IntervalMatrix* J, int v);
+
+	/* Reset the adjoints of a node (forward phase). */
+	void clear(int y);
+
+	/* Backward phase of y=phi(x), with phi' and phi'' enclosed by d1 and d2. */
+	void unary_bwd(int x, int y, const Interval& d1, const Interval& d2);
+
+	/* Backward phase of y=phi(x1,x2), with first and second-order derivatives enclosed by d1,d2 and d11,d12,d22. */
+	void binary_bwd(int x1, int x2, int y, const Interval& d1, const Interval& d2, const Interval& d11, const Interval& d12, const Interval& d22);
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void Hessian::hessian(const IntervalVector& box, IntervalMatrix& H, int v) {
+	hessian(box, IntervalVector(1,Interval::one()), H, v);
+}
+
+inline void Hessian::hessian(const IntervalVector& box, const IntervalVector& lambda, IntervalMatrix& H, int v) {
+	calc_hessian(box, lambda, H, NULL, v);
+}
+
+inline void Hessian::hessian(const IntervalVector& box, const IntervalVector& lambda, IntervalMatrix& H, IntervalMatrix& J, int v) {
+	calc_hessian(box, lambda, H, &J, v);
+}
+
+} // namespace ibex
+
+#endif // __IBEX_HESSIAN_H__
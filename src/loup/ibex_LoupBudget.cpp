@@ -0,0 +1,138 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LoupBudget.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_LoupBudget.h"
+
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// number of halvings of an empty or degenerated domain
+const double max_halvings = 128;
+
+}
+
+LoupBudget::LoupBudget(int nb_methods, double fraction) : nb_methods(nb_methods), _fraction(fraction),
+		stats(nb_methods*nb_levels*NB_REGIONS), total(nb_methods), spent(0) {
+
+}
+
+void LoupBudget::set_fraction(double fraction) {
+	_fraction = fraction;
+}
+
+void LoupBudget::reset(const IntervalVector& init_box) {
+	stats.assign(nb_methods*nb_levels*NB_REGIONS, Stat());
+	total.assign(nb_methods, Stat());
+
+	init_diam.resize(init_box.size());
+	for (int i=0; i<init_box.size(); i++)
+		init_diam[i]=init_box[i].diam();
+
+	spent = 0;
+	clock.restart();
+}
+
+int LoupBudget::level(const IntervalVector& box) const {
+
+	if (box.size()!=(int) init_diam.size()) return 0;
+
+	double h=0;
+	int n=0;
+
+	for (int i=0; i<box.size(); i++) {
+		// unbounded, degenerated or empty initial domains are ignored
+		if (init_diam[i]==POS_INFINITY || init_diam[i]<=0) continue;
+		double d=box[i].diam();
+		if (d<=0) h += max_halvings;
+		else if (d<init_diam[i]) h += std::min(max_halvings, ::log2(init_diam[i]/d));
+		n++;
+	}
+
+	if (n==0) return 0;
+
+	int l=(int) ::log2(1+h/n);
+
+	return l<nb_levels ? l : nb_levels-1;
+}
+
+LoupBudget::Region LoupBudget::region(const Interval& goal, double loup) {
+	if (loup==POS_INFINITY) return IMPROVING;
+	if (goal.is_empty() || goal.lb()>=loup) return FAR;
+	if (goal.ub()<loup) return IMPROVING;
+	return loup>=goal.mid() ? CLOSE : FAR;
+}
+
+bool LoupBudget::allow(int method, int level, Region region) {
+
+	if (!enabled()) return true;
+
+	Stat& s=stat(method,level,region);
+
+	if (region==IMPROVING || s.trials<min_trials)
+		return true;
+
+	if (_fraction>0 && spent<=_fraction*clock.get_time())
+		return true;
+
+	// Estimated success rate (Laplace rule: never 0).
+	double p=(s.successes+1.0)/(s.trials+2.0);
+
+	// The rate is decreased for a method more expensive
+	// than the average (over all the methods).
+	const Stat& m=total[method];
+	int all_trials=0;
+	double all_time=0;
+	for (int i=0; i<nb_methods; i++) {
+		all_trials += total[i].trials;
+		all_time += total[i].time;
+	}
+	if (m.time>0)
+		p *= std::min(1.0, (all_time/all_trials) / (m.time/m.trials));
+
+	// The method is run once every 1/p calls
+	s.credit += p;
+	if (s.credit>=1) {
+		s.credit -= 1;
+		return true;
+	} else {
+		s.skipped++;
+		total[method].skipped++;
+		return false;
+	}
+}
+
+void LoupBudget::start() {
+	if (enabled()) attempt.restart();
+}
+
+void LoupBudget::stop(int method, int level, Region region, bool success) {
+
+	if (!enabled()) return;
+
+	attempt.stop();
+	double t=attempt.get_time();
+
+	Stat& s=stat(method,level,region);
+	s.trials++;
+	total[method].trials++;
+	if (success) {
+		s.successes++;
+		total[method].successes++;
+	}
+	s.time += t;
+	total[method].time += t;
+	spent += t;
+}
+
+} /* namespace ibex */
@@ -0,0 +1,231 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LoupBudget.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_LOUP_BUDGET_H__
+#define __IBEX_LOUP_BUDGET_H__
+
+#include "ibex_IntervalVector.h"
+#include "ibex_Timer.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup optim
+ *
+ * \brief Adaptive time budget for upper-bounding.
+ *
+ * A loup finder is called on every cell of the search tree, but
+ * deep in the tree most attempts fail. This object records, for each
+ * upper-bounding method of a loup finder, the number of attempts, the
+ * number of successes and the time spent. The statistics are split
+ * by "slot", that is, by depth level and region (see #level() and
+ * #region()).
+ *
+ * As long as the time spent in upper-bounding is less than a given
+ * fraction of the total time, all attempts are allowed. Beyond this
+ * fraction, a method is only run in a slot with a frequency given by its
+ * (estimated) success rate in this slot, weighted by its relative cost.
+ * The method is always run when the box is likely to contain an
+ * improving point (region #IMPROVING) or when no loup is known yet.
+ *
+ * With a fraction of 1 (the default), nothing is throttled and no
+ * statistics are recorded.
+ */
+class LoupBudget {
+public:
+
+	/**
+	 * \brief Regions.
+	 *
+	 * Let [f] be the range of the objective over the box:
+	 * - IMPROVING: [f].ub < loup (any feasible point of the box is an improvement).
+	 * - CLOSE:     the loup is in the upper half of [f].
+	 * - FAR:       the loup is in the lower half of [f].
+	 */
+	typedef enum { IMPROVING, CLOSE, FAR, NB_REGIONS } Region;
+
+	/**
+	 * \brief Number of depth levels.
+	 */
+	static const int nb_levels = 8;
+
+	/**
+	 * \brief Number of attempts in a slot before throttling.
+	 */
+	static const int min_trials = 10;
+
+	/**
+	 * \brief Create a budget for a given number of methods.
+	 *
+	 * \param nb_methods - number of upper-bounding methods
+	 * \param fraction   - see #set_fraction(double).
+	 */
+	LoupBudget(int nb_methods, double fraction=1.0);
+
+	/**
+	 * \brief Set the fraction of time granted to upper-bounding.
+	 *
+	 * The fraction is the maximal ratio between the time spent by the
+	 * methods and the total time (since the last #reset()) under which
+	 * no attempt is refused. With 0, methods are always run at the
+	 * frequency given by their success rate. With 1 or more, nothing
+	 * is throttled.
+	 */
+	void set_fraction(double fraction);
+
+	/**
+	 * \brief The fraction of time granted to upper-bounding.
+	 */
+	double fraction() const;
+
+	/**
+	 * \brief True if attempts can be throttled.
+	 */
+	bool enabled() const;
+
+	/**
+	 * \brief Reset statistics and timers.
+	 *
+	 * Called once at the beginning of a search (see LoupFinder::start(const IntervalVector&)).
+	 *
+	 * \param init_box - the initial box of the search (n-sized box); used to
+	 *                   calculate depth levels.
+	 */
+	void reset(const IntervalVector& init_box);
+
+	/**
+	 * \brief Depth level of a box.
+	 *
+	 * The depth is estimated by the average number of halvings of the
+	 * (bounded) domains w.r.t. the initial box, h. The level is
+	 * floor(log2(1+h)), bounded by nb_levels-1.
+	 */
+	int level(const IntervalVector& box) const;
+
+	/**
+	 * \brief Region of a box.
+	 *
+	 * \param goal - range of the objective over the box
+	 * \param loup - the current loup
+	 */
+	static Region region(const Interval& goal, double loup);
+
+	/**
+	 * \brief Whether a method can be run in a slot.
+	 *
+	 * If true, the caller must run the method between #start()
+	 * and #stop(int,int,Region,bool).
+	 */
+	bool allow(int method, int level, Region region);
+
+	/**
+	 * \brief Start the timer of an attempt.
+	 */
+	void start();
+
+	/**
+	 * \brief Stop the timer of an attempt and record its result.
+	 */
+	void stop(int method, int level, Region region, bool success);
+
+	/**
+	 * \brief Number of attempts of a method (all slots).
+	 */
+	int nb_trials(int method) const;
+
+	/**
+	 * \brief Number of successful attempts of a method (all slots).
+	 */
+	int nb_successes(int method) const;
+
+	/**
+	 * \brief Number of attempts of a method refused (all slots).
+	 */
+	int nb_skipped(int method) const;
+
+	/**
+	 * \brief Time spent in a method (all slots).
+	 */
+	double time(int method) const;
+
+protected:
+
+	/*
+	 * Statistics of one method in one slot
+	 * (or in all slots).
+	 */
+	struct Stat {
+		Stat() : trials(0), successes(0), skipped(0), time(0), credit(0) { }
+		int trials;
+		int successes;
+		int skipped;
+		double time;
+		double credit;
+	};
+
+	Stat& stat(int method, int level, Region region);
+
+	const int nb_methods;
+
+	double _fraction;
+
+	/* per method and per slot */
+	std::vector<Stat> stats;
+
+	/* per method */
+	std::vector<Stat> total;
+
+	/* diameters of the initial box */
+	std::vector<double> init_diam;
+
+	/* total time since the last reset */
+	Timer clock;
+
+	/* time of the current attempt */
+	Timer attempt;
+
+	/* time spent in all methods */
+	double spent;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline double LoupBudget::fraction() const {
+	return _fraction;
+}
+
+inline bool LoupBudget::enabled() const {
+	return _fraction<1;
+}
+
+inline LoupBudget::Stat& LoupBudget::stat(int method, int level, Region region) {
+	return stats[(method*nb_levels+level)*NB_REGIONS+region];
+}
+
+inline int LoupBudget::nb_trials(int method) const {
+	return total[method].trials;
+}
+
+inline int LoupBudget::nb_successes(int method) const {
+	return total[method].successes;
+}
+
+inline int LoupBudget::nb_skipped(int method) const {
+	return total[method].skipped;
+}
+
+inline double LoupBudget::time(int method) const {
+	return total[method].time;
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_LOUP_BUDGET_H__ */
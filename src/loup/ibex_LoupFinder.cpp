@@ -5,6 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 09, 2017
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_LoupFinder.h"
@@ -21,6 +22,10 @@ void LoupFinder::add_property(const IntervalVector& init_box, BoxProperties& pro
 
 }
 
+void LoupFinder::start(const IntervalVector& init_box) {
+
+}
+
 bool LoupFinder::check(const System& sys, const Vector& pt, double& loup, bool _is_inner) {
 
 	// "res" will contain an upper bound of the criterion
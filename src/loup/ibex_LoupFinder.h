@@ -5,6 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 09, 2017
+// Last update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_LOUP_FINDER__
@@ -81,6 +82,19 @@ public:
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop);
 
+	/**
+	 * \brief Start a new search.
+	 *
+	 * Called once by the optimizer before the first call to find(...),
+	 * whereas #add_property(...) is called for every initial cell
+	 * (several ones when the search is resumed from a COV file).
+	 *
+	 * \param init_box - the initial box of the search (n-sized box).
+	 *
+	 * By default: do nothing.
+	 */
+	virtual void start(const IntervalVector& init_box);
+
 	/**
 	 * \brief Delete this.
 	 */
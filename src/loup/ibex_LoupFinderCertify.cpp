@@ -5,6 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 20, 2017
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_PdcHansenFeasibility.h"
@@ -16,7 +17,7 @@ namespace ibex {
 
 using namespace std;
 
-LoupFinderCertify::LoupFinderCertify(const System& sys, LoupFinder& finder) : sys(sys), has_equality(false), finder(finder) {
+LoupFinderCertify::LoupFinderCertify(const System& sys, LoupFinder& finder) : budget(NB_METHODS), sys(sys), has_equality(false), finder(finder) {
 
 	if (sys.nb_ctr>0)
 		// ==== check if the system contains equalities ====
@@ -28,15 +29,25 @@ LoupFinderCertify::LoupFinderCertify(const System& sys, LoupFinder& finder) : sy
 		}
 }
 
+void LoupFinderCertify::add_property(const IntervalVector& init_box, BoxProperties& prop) {
+	finder.add_property(init_box,prop);
+}
+
+void LoupFinderCertify::start(const IntervalVector& init_box) {
+	finder.start(init_box);
+
+	budget.reset(init_box);
+}
+
 //pair<IntervalVector, double> LoupCorrection::find(double loup, const Vector& loup_point, double pseudo_loup) {
-std::pair<IntervalVector, double> LoupFinderCertify::find(const IntervalVector& box, const IntervalVector& loup_point, double loup) {
+std::pair<IntervalVector, double> LoupFinderCertify::find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop) {
 
 	IntervalVector epsbox(box.size());
 	bool pseudo_loup_found=true;
 	pair<IntervalVector,double> p;
 
 	try {
-		p=finder.find(box,loup_point,loup);
+		p=finder.find(box,loup_point,loup,prop);
 		epsbox = p.first;
 	} catch(NotFound&) {
 		pseudo_loup_found=false;
@@ -46,6 +57,33 @@ std::pair<IntervalVector, double> LoupFinderCertify::find(const IntervalVector&
 	if (pseudo_loup_found && !has_equality)
 		return p;
 
+	// A pseudo-loup is likely to be close to an improving point:
+	// the certification is only throttled when there is none.
+	int level=0;
+	LoupBudget::Region region=LoupBudget::IMPROVING;
+
+	if (budget.enabled()) {
+		level=budget.level(box);
+		if (!pseudo_loup_found)
+			region=LoupBudget::region(sys.goal->eval(box),loup);
+	}
+
+	if (!budget.allow(INFLATING_NEWTON,level,region))
+		throw NotFound();
+
+	budget.start();
+	try {
+		p=certify(epsbox,loup,pseudo_loup_found,p);
+	} catch(NotFound&) {
+		budget.stop(INFLATING_NEWTON,level,region,false);
+		throw;
+	}
+	budget.stop(INFLATING_NEWTON,level,region,true);
+	return p;
+}
+
+std::pair<IntervalVector, double> LoupFinderCertify::certify(const IntervalVector& epsbox, double loup, bool pseudo_loup_found, const std::pair<IntervalVector, double>& p) {
+
 	// Loop while the number of active constraints is less
 	// than the number of variables (we cannot make proofs
 	// with overconstrained sytems)
@@ -5,6 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 20, 2017
+// Last update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_LOUP_FINDER_CERTIFY_H__
@@ -12,6 +13,7 @@
 
 #include "ibex_LoupFinder.h"
 #include "ibex_Exception.h"
+#include "ibex_LoupBudget.h"
 
 #include <utility>
 
@@ -28,10 +30,19 @@ namespace ibex {
  *
  * This results in a box that rigorously includes a feasible
  * point.
+ *
+ * The Newton-inflation is also tried from the midpoint of the box
+ * when no pseudo-loup is found. The time spent in these attempts
+ * can be bounded adaptively (see #budget).
  */
 class LoupFinderCertify : public LoupFinder {
 public:
 
+	/**
+	 * \brief Certification technique (for #budget).
+	 */
+	typedef enum { INFLATING_NEWTON, NB_METHODS } Method;
+
 	/**
 	 * \param sys    - The real system (that is, without relaxation).
 	 * \param finder - A loup finder for the relaxed system.
@@ -45,6 +56,23 @@ public:
 	 */
 	virtual std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup);
 
+	/**
+	 * \brief Find a new loup in a given box.
+	 *
+	 * \see comments in LoupFinder.
+	 */
+	virtual std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup, BoxProperties& prop);
+
+	/**
+	 * \brief Add properties required by the finder of the relaxed system.
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop);
+
+	/**
+	 * \brief Start a new search (reset the budget).
+	 */
+	virtual void start(const IntervalVector& init_box);
+
 	/**
 	 * \brief Return true.
 	 */
@@ -58,8 +86,26 @@ public:
 	 */
 	const double min_activity_thershold = 1e-20;
 
+	/**
+	 * Time budget of the certification (see #Method).
+	 *
+	 * Disabled by default (see LoupBudget::set_fraction(double)).
+	 */
+	LoupBudget budget;
+
 protected:
 
+	/**
+	 * \brief Run the Newton-inflation from a (pseudo-)loup box.
+	 *
+	 * \param epsbox            - the pseudo-loup box or the midpoint of the box
+	 * \param loup              - the current loup
+	 * \param pseudo_loup_found - true if epsbox is a pseudo-loup box
+	 * \param p                 - the pseudo-loup (if found)
+	 * \throws NotFound in case of failure.
+	 */
+	std::pair<IntervalVector, double> certify(const IntervalVector& epsbox, double loup, bool pseudo_loup_found, const std::pair<IntervalVector, double>& p);
+
 	/**
 	 * \brief The NLP problem.
 	 */
@@ -76,6 +122,13 @@ protected:
 	LoupFinder& finder;
 };
 
+/*================================== inline implementations ========================================*/
+
+inline std::pair<IntervalVector, double> LoupFinderCertify::find(const IntervalVector& box, const IntervalVector& loup_point, double loup) {
+	BoxProperties prop(box);
+	return find(box, loup_point, loup, prop);
+}
+
 } /* namespace ibex */
 
 #endif /* __IBEX_LOUP_FINDER_CERTIFY_H__ */
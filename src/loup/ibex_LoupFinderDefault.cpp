@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 09, 2017
-// Last update : Aug 01, 2018
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_LoupFinderDefault.h"
@@ -20,7 +20,7 @@ namespace ibex {
 
 LoupFinderDefault::LoupFinderDefault(const System& sys, bool inHC4) :
 	finder_probing(inHC4? (LoupFinder&) *new LoupFinderInHC4(sys) : (LoupFinder&) *new LoupFinderFwdBwd(sys)),
-	finder_x_taylor(sys) {
+	finder_x_taylor(sys), budget(NB_METHODS) {
 
 }
 
@@ -37,23 +37,49 @@ void LoupFinderDefault::add_property(const IntervalVector& init_box, BoxProperti
 
 }
 
+void LoupFinderDefault::start(const IntervalVector& init_box) {
+	finder_probing.start(init_box);
+	finder_x_taylor.start(init_box);
+
+	budget.reset(init_box);
+}
+
 std::pair<IntervalVector, double> LoupFinderDefault::find(const IntervalVector& box, const IntervalVector& old_loup_point, double old_loup, BoxProperties& prop) {
 
 	pair<IntervalVector,double> p=make_pair(old_loup_point, old_loup);
 
 	bool found=false;
 
-	try {
-		p=finder_probing.find(box,p.first,p.second,prop);
-		found=true;
-	} catch(NotFound&) { }
-
-	try {
-		// TODO
-		// in_x_taylor.set_inactive_ctr(entailed->norm_entailed);
-		p=finder_x_taylor.find(box,p.first,p.second,prop);
-		found=true;
-	} catch(NotFound&) { }
+	int level=0;
+	LoupBudget::Region region=LoupBudget::IMPROVING;
+
+	if (budget.enabled()) {
+		const System& sys=finder_x_taylor.sys;
+		level=budget.level(box);
+		if (sys.goal) region=LoupBudget::region(sys.goal->eval(box),old_loup);
+	}
+
+	if (budget.allow(PROBING,level,region)) {
+		bool success=false;
+		budget.start();
+		try {
+			p=finder_probing.find(box,p.first,p.second,prop);
+			found=success=true;
+		} catch(NotFound&) { }
+		budget.stop(PROBING,level,region,success);
+	}
+
+	if (budget.allow(X_TAYLOR,level,region)) {
+		bool success=false;
+		budget.start();
+		try {
+			// TODO
+			// in_x_taylor.set_inactive_ctr(entailed->norm_entailed);
+			p=finder_x_taylor.find(box,p.first,p.second,prop);
+			found=success=true;
+		} catch(NotFound&) { }
+		budget.stop(X_TAYLOR,level,region,success);
+	}
 
 	if (found) {
 		//--------------------------------------------------------------------------
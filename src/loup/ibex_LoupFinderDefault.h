@@ -5,6 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 09, 2017
+// Last update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_LOUP_FINDER_DEFAULT_H__
@@ -13,6 +14,7 @@
 #include "ibex_LoupFinder.h"
 #include "ibex_System.h"
 #include "ibex_LoupFinderXTaylor.h"
+#include "ibex_LoupBudget.h"
 
 namespace ibex {
 
@@ -31,10 +33,18 @@ namespace ibex {
  * a constraint-free NLP problem (a simple sampling is done
  * otherwise).
  *
+ * The time spent in each technique can be bounded adaptively
+ * (see #budget).
+ *
  * \note Only works with inequality constraints.
  */
 class LoupFinderDefault : public LoupFinder {
 public:
+
+	/**
+	 * \brief Upper-bounding techniques (for #budget).
+	 */
+	typedef enum { PROBING, X_TAYLOR, NB_METHODS } Method;
 	/**
 	 * \brief Create the algorithm for a given system.
 	 *
@@ -71,6 +81,11 @@ public:
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop);
 
+	/**
+	 * \brief Start a new search (reset the budget).
+	 */
+	virtual void start(const IntervalVector& init_box);
+
 	/*
 	 * Loup finder using inner boxes.
 	 *
@@ -82,6 +97,13 @@ public:
 	 * Loup finder using inner polytopes.
 	 */
 	LoupFinderXTaylor finder_x_taylor;
+
+	/**
+	 * Time budget of the two techniques (see #Method).
+	 *
+	 * Disabled by default (see LoupBudget::set_fraction(double)).
+	 */
+	LoupBudget budget;
 };
 
 inline std::pair<IntervalVector, double> LoupFinderDefault::find(const IntervalVector& box, const IntervalVector& loup_point, double loup) {
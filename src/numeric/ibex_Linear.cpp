@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 18, 2012
-// Last Update : Aug 29, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_Linear.h"
@@ -22,12 +22,35 @@ using namespace std;
 
 namespace ibex {
 
+int default_mid_rad_dim=16;
+
+double default_precond_reuse_dist=0.1;
+
 namespace {
 double _mig(double x)          { return fabs(x); }
 double _mig(const Interval& x) { return x.mig(); }
 bool _zero(double x)           { return x==0; }
 bool _zero(const Interval& x)  { return x.contains(0); }
 
+// C*A with the midpoint-radius product for large matrices
+IntervalMatrix precond_mul(const Matrix& C, const IntervalMatrix& A) {
+	if (A.nb_rows()>=default_mid_rad_dim)
+		return mid_rad_mul(C,A);
+	else
+		return C*A;
+}
+
+// Inverse of either Mid(A), Inf(A) or Sup(A) (in priority)
+void precond_matrix(const IntervalMatrix& A, Matrix& C) {
+	try { real_inverse(A.mid(), C); }
+	catch (SingularMatrixException&) {
+		try { real_inverse(A.lb(), C); }
+		catch (SingularMatrixException&) {
+			real_inverse(A.ub(), C);
+		}
+	}
+}
+
 // S=scalar (double or Interval)
 // M=matrix (Matrix or IntervalMatrix)
 template<typename S, class M>
@@ -244,7 +267,7 @@ void neumaier_inverse(const IntervalMatrix& A, IntervalMatrix& invA) {
     Vector u(n, 1);
     Matrix C(n, n);
     real_inverse(A.mid(), C); // throw SingularMatrixException
-    double beta = infinite_norm(C * A - Matrix::eye(n));
+    double beta = infinite_norm(precond_mul(C, A) - Matrix::eye(n));
     if (beta >= 1)
         throw SingularMatrixException();
     Vector w(n);
@@ -306,15 +329,9 @@ void precond(IntervalMatrix& A) {
 	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
 
 	Matrix C(n,n);
-	try { real_inverse(A.mid(), C); }
-	catch (SingularMatrixException&) {
-		try { real_inverse(A.lb(), C); }
-		catch (SingularMatrixException&) {
-			real_inverse(A.ub(), C);
-		}
-	}
+	precond_matrix(A, C);
 
-	A = C*A;
+	A = precond_mul(C,A);
 }
 
 void precond(IntervalMatrix& A, IntervalVector& b) {
@@ -323,19 +340,44 @@ void precond(IntervalMatrix& A, IntervalVector& b) {
 	assert(n == b.size());
 
 	Matrix C(n,n);
-	try { real_inverse(A.mid(), C); }
-	catch (SingularMatrixException&) {
-		try { real_inverse(A.lb(), C); }
-		catch (SingularMatrixException&) {
-			real_inverse(A.ub(), C);
-		}
-	}
+	precond_matrix(A, C);
 
 	//   cout << "A=" << (A.nb_cols()) << "x" << (A.nb_rows()) << "  " << "b=" << (b.size()) << "  " << "C="
 	//        << (C.nb_cols()) << "x" << (C.nb_rows()) << endl;
 	//cout << "C=" << C << endl;
-	A = C*A;
+	A = precond_mul(C,A);
+	b = C*b;
+}
+
+bool precond(IntervalMatrix& A, IntervalVector& b, Matrix& C, bool reuse, double max_dist) {
+	int n=(A.nb_rows());
+	assert(n == A.nb_cols());
+	assert(n == b.size());
+	assert(n == C.nb_rows() && n == C.nb_cols());
+
+	if (reuse && reuse_precond(A, b, C, max_dist))
+		return false;
+
+	precond_matrix(A, C);
+
+	A = precond_mul(C,A);
 	b = C*b;
+	return true;
+}
+
+bool reuse_precond(IntervalMatrix& A, IntervalVector& b, const Matrix& C, double max_dist) {
+	int n=(A.nb_rows());
+	assert(n == A.nb_cols());
+	assert(n == b.size());
+	assert(n == C.nb_rows() && n == C.nb_cols());
+
+	IntervalMatrix CA=precond_mul(C,A);
+	if (!CA.is_unbounded() && infinite_norm(CA.mid()-Matrix::eye(n)) <= max_dist) {
+		A = CA;
+		b = C*b;
+		return true;
+	} else
+		return false;
 }
 
 void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
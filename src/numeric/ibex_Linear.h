@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 17, 2012
-// Last Update : Aug 29, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_LINEAR_H__
@@ -121,6 +121,20 @@ void real_inverse(const Matrix& A, Matrix& invA);
  */
 Matrix real_inverse(const Matrix& A);
 
+/**
+ * \brief Default minimal dimension for the midpoint-radius product.
+ *
+ * The products of a real matrix by an interval matrix performed by
+ * #precond(IntervalMatrix&, IntervalVector&), #precond(IntervalMatrix&) and
+ * #neumaier_inverse(const IntervalMatrix&, IntervalMatrix&) (hence, by the
+ * interval Newton operators) are calculated in midpoint-radius arithmetic
+ * (see #mid_rad_mul(const Matrix&, const IntervalMatrix&)) if the matrix has
+ * at least this number of rows. Otherwise, the naive interval product is used.
+ *
+ * Set this variable to INT_MAX to always use the naive product.
+ */
+extern int default_mid_rad_dim;
+
 /**
  * \brief Computes an enclosure of the inverse of an interval matrix.
  * See "Interval Methods for Systems of Equations", A. Neumaier, 1990, p 123, theorem 4.1.11.
@@ -178,6 +192,51 @@ void precond(IntervalMatrix& A, IntervalVector& b);
  */
 void precond(IntervalMatrix& A);
 
+/**
+ * \brief Default maximal distance for reusing a preconditioning matrix.
+ *
+ * See #precond(IntervalMatrix&, IntervalVector&, Matrix&, bool, double).
+ */
+extern double default_precond_reuse_dist;
+
+/**
+ * \brief Preconditions system \f$[A]x=[b]\f$ with a previous matrix if still effective.
+ *
+ * <br> If \a reuse is true, [A] and [b] are multiplied by the matrix C
+ * given in argument, provided that C is still a good approximation of
+ * the inverse of [A], i.e.:
+ *
+ *     \f$\|Mid(C*[A])-I\|_\infty \le \f$ \a max_dist.
+ *
+ * This test requires O(n^2) operations (the product C*[A] being calculated anyway).
+ * Otherwise, C is recalculated as in #precond(IntervalMatrix&, IntervalVector&),
+ * which requires an LU factorization and an inversion (O(n^3) operations).
+ *
+ * \param A (in/output)- The interval matrix [A] to be replaced by \f$C*[A]\f$.
+ * \param b (in/output)- The interval vector [b] to be replaced by \f$C*[b]\f$.
+ * \param C (in/output)- The preconditioning matrix.
+ * \param reuse        - Whether C can be reused (otherwise, C is recalculated).
+ * \param max_dist     - See above.
+ *
+ * \return true if C has been recalculated.
+ *
+ * \throw SingularMatrixException if C has to be recalculated and no real matrix extracted
+ *                                from [A] could be inversed successfully.
+ *                                In this case, A and b are not modified but C is undefined.
+ */
+bool precond(IntervalMatrix& A, IntervalVector& b, Matrix& C, bool reuse, double max_dist=default_precond_reuse_dist);
+
+/**
+ * \brief Preconditions system \f$[A]x=[b]\f$ with a previous matrix, only if still effective.
+ *
+ * Same as #precond(IntervalMatrix&, IntervalVector&, Matrix&, bool, double)
+ * with \a reuse set to true except that C is never recalculated (so it can be
+ * a read-only matrix shared with other boxes).
+ *
+ * \return true if [A] and [b] have been preconditioned. Otherwise, they are not modified.
+ */
+bool reuse_precond(IntervalMatrix& A, IntervalVector& b, const Matrix& C, double max_dist=default_precond_reuse_dist);
+
 /**
  * \brief Gauss-Seidel algorithm.
  *
@@ -5,6 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 29, 2019
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_LinearizerDuality.h"
@@ -77,7 +78,7 @@ int LinearizerDuality::linearize(const IntervalVector& box, LPSolver& lp_solver,
 		int i=0; // counter of active constraints
 		for (BitSet::iterator c=active->begin(); c!=active->end(); ++c, i++)  {
 
-			if (!sys.f_ctrs.deriv_calculator().is_linear[c]) {
+			if (!sys.f_ctrs.deriv_calculator().linear(c)) {
 				for (size_t j=0; j<n; j++) {
 					Vector row(n_total,0.0);
 					row[j]=1;
@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert, Ignacio Araya, Bertrand Neveu
  * Created     : July 01th, 2012
- * Updated     : July 18th, 2017
+ * Updated     : Oct 19th, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "ibex_LinearizerXTaylor.h"
@@ -149,7 +149,7 @@ int LinearizerXTaylor::linear_relax(const IntervalVector& box, const BitSet& act
 				//cout << " add ctr n°" << c << endl;
 
 				// only one corner for a linear constraint
-				if (k>0 && sys.f_ctrs.deriv_calculator().is_linear[c]) {
+				if (k>0 && sys.f_ctrs.deriv_calculator().linear(c)) {
 					//cout << "ctr " << c << " is linear!\n";
 					continue;
 				}
@@ -5,12 +5,13 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 24, 2012
-// Last Update : May 24, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_Newton.h"
 #include "ibex_Linear.h"
 #include "ibex_LinearException.h"
+#include "ibex_BxpPrecond.h"
 
 #include <cassert>
 
@@ -34,7 +35,7 @@ namespace {
 //
 }
 
-bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double prec, double ratio_gauss_seidel) {
+bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, BoxProperties* prop, long precond_id, double prec, double ratio_gauss_seidel) {
 	int n=vars? vars->nb_var : f.nb_var();
 	int m=f.image_dim();
 	assert(full_box.size()==f.nb_var());
@@ -61,6 +62,15 @@ bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double p
 	IntervalVector& box = vars ? *new IntervalVector(vars->var_box(full_box)) : full_box;
 	IntervalVector& full_mid = vars ? *new IntervalVector(full_box) : mid;
 
+	// The preconditioning matrix (reused from one iteration to the other).
+	// The matrix inherited from the properties is shared with other boxes:
+	// it is read through a const reference and the property is only unshared
+	// when the matrix has to be recalculated.
+	const BxpPrecond* pc = prop ? (const BxpPrecond*) ((const BoxProperties&) *prop)[precond_id] : NULL;
+	const Matrix* C = pc && pc->valid ? &pc->C : NULL;
+	BxpPrecond* pcw = NULL;  // private property (once unshared)
+	Matrix* Cw = NULL;       // matrix that can be recalculated
+
 	y1 = box.mid();
 
 	do {
@@ -96,7 +106,21 @@ bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double p
 		y1=y;
 
 		try {
-			precond(J, Fmid);
+			if (!C || !reuse_precond(J, Fmid, *C)) {
+				if (!Cw) {
+					if (pc) {
+						pcw = (BxpPrecond*) (*prop)[precond_id];
+						Cw = &pcw->C;
+						Cw->resize(n,n); // allocated on first calculation
+					} else
+						Cw = new Matrix(n,n);
+				}
+				C=NULL;
+				if (pcw) pcw->valid=false; // C is undefined if an exception is raised
+				precond(J, Fmid, *Cw, false);
+				if (pcw) pcw->valid=true;
+				C=Cw;
+			}
 
 			gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
 
@@ -138,15 +162,25 @@ bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double p
 		delete &full_mid;
 	}
 
+	if (Cw && !pcw) delete Cw;
+
 	return reducted;
 }
 
 bool newton(const Fnc& f, IntervalVector& box, double prec, double ratio_gauss_seidel) {
-	return newton(f,NULL,box,prec,ratio_gauss_seidel);
+	return newton(f,NULL,box,NULL,-1,prec,ratio_gauss_seidel);
 }
 
 bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, double prec, double ratio_gauss_seidel) {
-	return newton(f,&vars,full_box,prec,ratio_gauss_seidel);
+	return newton(f,&vars,full_box,NULL,-1,prec,ratio_gauss_seidel);
+}
+
+bool newton(const Fnc& f, IntervalVector& box, BoxProperties& prop, long precond_id, double prec, double ratio_gauss_seidel) {
+	return newton(f,NULL,box,&prop,precond_id,prec,ratio_gauss_seidel);
+}
+
+bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, BoxProperties& prop, long precond_id, double prec, double ratio_gauss_seidel) {
+	return newton(f,&vars,full_box,&prop,precond_id,prec,ratio_gauss_seidel);
 }
 
 bool inflating_newton(const Fnc& f, const VarSet* vars, const IntervalVector& full_box, IntervalVector& box_existence, IntervalVector& box_unicity, int k_max, double mu_max, double delta, double chi) {
@@ -166,6 +200,8 @@ bool inflating_newton(const Fnc& f, const VarSet* vars, const IntervalVector& fu
 	IntervalVector mid(n);       // Midpoint of the current box
 	IntervalVector Fmid(n);      // Evaluation of f at the midpoint
 	IntervalMatrix J(n, n);	     // Hansen matrix of f % variables
+	Matrix C(n, n);              // Preconditioning matrix (reused from one iteration to the other)
+	bool valid=false;            // Whether C is calculated
 
 	// Following variables are introduced just to use a
 	// centered-form on parameters when evaluating Fmid
@@ -229,7 +265,10 @@ bool inflating_newton(const Fnc& f, const VarSet* vars, const IntervalVector& fu
 		y1=y;
 
 		try {
-			precond(J, Fmid);
+			bool reuse=valid;
+			valid=false; // C is undefined if an exception is raised
+			precond(J, Fmid, C, reuse);
+			valid=true;
 		} catch(LinearException&) {
 			break; // should be false
 		}
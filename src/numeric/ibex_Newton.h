@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 24, 2012
-// Last Update : May 24, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_NEWTON_H__
@@ -13,6 +13,7 @@
 
 #include "ibex_Fnc.h"
 #include "ibex_VarSet.h"
+#include "ibex_BoxProperties.h"
 
 namespace ibex {
 
@@ -51,6 +52,24 @@ bool newton(const Fnc& f, IntervalVector& box, double prec=default_newton_prec,
  */
 bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
 
+/**
+ * \brief Newton with a preconditioning matrix inherited from a previous call.
+ *
+ * The preconditioning matrix stored in the property \a precond_id of \a prop
+ * (a #ibex::BxpPrecond, if valid) is reused as long as it is effective
+ * (see #ibex::precond(IntervalMatrix&, IntervalVector&, Matrix&, bool, double)).
+ * The property is only unshared (see #ibex::BoxProperties) if the matrix has to
+ * be recalculated. In return, the property contains the last matrix used.
+ *
+ * If the property does not exist, this is the same as #ibex::newton(const Fnc&, IntervalVector&, double, double).
+ */
+bool newton(const Fnc& f, IntervalVector& box, BoxProperties& prop, long precond_id, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
+
+/**
+ * \brief Newton on a subset of variables with a preconditioning matrix inherited from a previous call.
+ */
+bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, BoxProperties& prop, long precond_id, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
+
 /**
  * \ingroup numeric
  *
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Oct 18, 2014
-// Last Update : Jul 05, 2018
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_BXP_OPTIM_DATA_H__
@@ -46,6 +46,18 @@ public:
 	 */
 	void update(const BoxEvent& event, const BoxProperties& prop);
 
+	/**
+	 * \brief Return true.
+	 *
+	 * This is safe because update(...) does nothing: the
+	 * values #pf and #pu are only set by the cost functions
+	 * (see CellCostFunc::set_optim_data(...)), through the
+	 * non-const access BoxProperties::operator[], which
+	 * replaces a shared value by a private copy first.
+	 * So a value is only copied when it is written.
+	 */
+	bool unchanged(const BoxEvent& event, const BoxProperties& prop) const;
+
 	/**
 	 * \brief Initialize the value of "pf"
 	 *
@@ -107,6 +119,9 @@ inline void BxpOptimData::update(const BoxEvent& event, const BoxProperties& pro
 	// and makes no problem so far as this property is not used elsewhere.
 }
 
+inline bool BxpOptimData::unchanged(const BoxEvent& event, const BoxProperties& prop) const {
+	return true;
+}
 
 } // end namespace ibex
 
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Dec 11, 2014
-// Last Update : Oct 14, 2019
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_DefaultOptimizerConfig.h"
@@ -14,7 +14,9 @@
 #include "ibex_CtcAcid.h"
 #include "ibex_CtcCompo.h"
 #include "ibex_CtcFixPoint.h"
+#include "ibex_CtcFwdBwd.h"
 #include "ibex_CtcLinearRelax.h"
+#include "ibex_CtcMohc.h"
 #include "ibex_CellDoubleHeap.h"
 #include "ibex_SmearFunction.h"
 #include "ibex_LSmear.h"
@@ -48,6 +50,9 @@ DefaultOptimizerConfig::DefaultOptimizerConfig(const System& sys) : sys(sys), kk
 	set_inHC4(default_inHC4);
 	// by defaut, we apply KKT for unconstrained problems
 	set_kkt(sys.nb_ctr==0);
+	set_affine(default_affine);
+	set_mohc(default_mohc);
+	set_loup_budget(default_loup_budget);
 	set_random_seed(default_random_seed);
 }
 
@@ -62,6 +67,9 @@ DefaultOptimizerConfig::DefaultOptimizerConfig(const System& sys, double rel_eps
 	set_rigor(rigor);
 	set_inHC4(inHC4);
 	set_kkt(kkt);
+	set_affine(default_affine);
+	set_mohc(default_mohc);
+	set_loup_budget(default_loup_budget);
 	set_random_seed(random_seed);
 	set_eps_x(eps_x);
 }
@@ -115,6 +123,18 @@ void DefaultOptimizerConfig::set_kkt(bool _kkt) {
 	}
 }
 
+void DefaultOptimizerConfig::set_affine(bool _affine) {
+	affine = _affine;
+}
+
+void DefaultOptimizerConfig::set_mohc(bool _mohc) {
+	mohc = _mohc;
+}
+
+void DefaultOptimizerConfig::set_loup_budget(double fraction) {
+	loup_budget = fraction;
+}
+
 void DefaultOptimizerConfig::set_random_seed(double _random_seed) {
 	random_seed = _random_seed;
 	RNG::srand(random_seed);
@@ -151,25 +171,49 @@ Ctc& DefaultOptimizerConfig::get_ctc() {
 
 	const ExtendedSystem& ext_sys = get_ext_sys();
 
-	Array<Ctc> ctc_list(kkt? 4 : 3);
+	Array<Ctc> ctc_list(3 + (kkt? 1 : 0) + (affine? 1 : 0) + (mohc? 1 : 0));
+
+	int i=0;
 
 	// first contractor on ext_sys : incremental HC4 (propag ratio=0.01)
-	ctc_list.set_ref(0, rec(new CtcHC4 (ext_sys,0.01,true)));
+	ctc_list.set_ref(i++, rec(new CtcHC4 (ext_sys,0.01,true)));
+
+	if (affine) {
+		// affine forward-backward on each constraint (including the goal)
+		Array<Ctc> affine_list(ext_sys.nb_ctr);
+		for (int j=0; j<ext_sys.nb_ctr; j++) {
+			CtcFwdBwd& c=rec(new CtcFwdBwd(ext_sys,j));
+			c.set_affine(true);
+			affine_list.set_ref(j,c);
+		}
+		ctc_list.set_ref(i++, rec(new CtcCompo(affine_list)));
+	}
+
+	if (mohc) {
+		// monotonicity-based contractors on each constraint (including the goal).
+		// Note: inside a CtcCompo, the impact is all the variables, so that the
+		// "incremental" mode only changes the initial order of the agenda.
+		Array<Ctc> mohc_list(ext_sys.nb_ctr);
+		for (int j=0; j<ext_sys.nb_ctr; j++)
+			mohc_list.set_ref(j, rec(new CtcMohc(ext_sys,j)));
+		ctc_list.set_ref(i++, rec(new CtcPropag(mohc_list,0.01,true)));
+	}
+
 	// second contractor on ext_sys : "Acid" with incremental HC4 (propag ratio=0.1)
-	ctc_list.set_ref(1, rec(new CtcAcid (ext_sys,rec(new CtcHC4 (ext_sys,0.1,true)),true)));
+	ctc_list.set_ref(i++, rec(new CtcAcid (ext_sys,rec(new CtcHC4 (ext_sys,0.1,true)),true)));
 	// the last contractor is "XNewton"
 
 	if (ext_sys.nb_ctr > 1) {
-		ctc_list.set_ref(2,rec(new CtcFixPoint
+		ctc_list.set_ref(i++,rec(new CtcFixPoint
 				(rec(new CtcCompo(
 						rec(new CtcLinearRelax(ext_sys)),
 						rec(new CtcHC4(ext_sys,0.01)))), default_relax_ratio)));
 	} else {
-		ctc_list.set_ref(2,rec(new CtcLinearRelax(ext_sys)));
+		ctc_list.set_ref(i++,rec(new CtcLinearRelax(ext_sys)));
 	}
 
 	if (kkt) {
-		ctc_list.set_ref(3, rec(new CtcKuhnTucker(get_norm_sys(),true)));
+		ctc_list.set_ref(i++, rec(new CtcKuhnTucker(get_norm_sys(),true)));
 		//ctc_list.set_ref(3, rec(new CtcKuhnTuckerLP(get_norm_sys(sys,eps_h),true)));
 	}
 	return rec(new CtcCompo(ctc_list), CTC_TAG);
@@ -192,8 +236,15 @@ LoupFinder& DefaultOptimizerConfig::get_loup_finder() {
 
 	const NormalizedSystem& norm_sys = get_norm_sys();
 
-	return rec(rigor? (LoupFinder*) new LoupFinderCertify(sys,rec(new LoupFinderDefault(norm_sys, inHC4))) :
-			(LoupFinder*) new LoupFinderDefault(norm_sys, inHC4), LOUP_FINDER_TAG);
+	LoupFinderDefault* finder = new LoupFinderDefault(norm_sys, inHC4);
+	finder->budget.set_fraction(loup_budget);
+
+	if (rigor) {
+		LoupFinderCertify* certify = new LoupFinderCertify(sys,rec(finder));
+		certify->budget.set_fraction(loup_budget);
+		return rec((LoupFinder*) certify, LOUP_FINDER_TAG);
+	} else
+		return rec((LoupFinder*) finder, LOUP_FINDER_TAG);
 }
 
 CellBufferOptim& DefaultOptimizerConfig::get_cell_buffer() {
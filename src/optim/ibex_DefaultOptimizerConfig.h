@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Dec 11, 2014
-// Last Update : Oct 14, 2019
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_DEFAULT_OPTIMIZER_CONFIG_H__
@@ -87,6 +87,44 @@ public:
 	 */
 	void set_kkt(bool kkt);
 
+	/**
+	 * \brief Activate/deactivate affine forward-backward contractors.
+	 *
+	 * If activated, each constraint of the extended system (including
+	 * the goal constraint y=f(x), which yields the lower bound) is
+	 * additionally contracted with forward-backward in affine arithmetic
+	 * (see CtcFwdBwd::set_affine(bool)).
+	 *
+	 * Set by default to #default_affine.
+	 */
+	void set_affine(bool affine);
+
+	/**
+	 * \brief Activate/deactivate monotonicity-based contractors.
+	 *
+	 * If activated, the constraints of the extended system (including
+	 * the goal constraint) are additionally propagated with
+	 * monotonicity-based contractors (see CtcMohc), which are more
+	 * effective than forward-backward with multiple occurrences of
+	 * variables.
+	 *
+	 * Set by default to #default_mohc.
+	 */
+	void set_mohc(bool mohc);
+
+	/**
+	 * \brief Set the time budget of upper-bounding.
+	 *
+	 * Fraction of the time under which all the upper-bounding techniques
+	 * are tried on every cell. Beyond this fraction, each technique is
+	 * run with a frequency adapted to its success rate and cost, observed
+	 * per depth level and region of the search tree (see LoupBudget).
+	 * A value of 1 disables this mechanism.
+	 *
+	 * Set by default to #default_loup_budget.
+	 */
+	void set_loup_budget(double fraction);
+
 	/**
 	 * \brief Set random seed
 	 *
@@ -110,6 +148,15 @@ public:
 	/** \see #set_kkt(). */
 	bool with_kkt();
 
+	/** \see #set_affine(). */
+	bool with_affine();
+
+	/** \see #set_mohc(). */
+	bool with_mohc();
+
+	/** \see #set_loup_budget(). */
+	double get_loup_budget();
+
 	/** \see #set_random_seed(). */
 	double get_random_seed();
 
@@ -122,6 +169,15 @@ public:
 	/** Default inHC4 mode: true (enabled). */
 	static constexpr bool default_inHC4 = true;
 
+	/** Default affine mode: false (disabled). */
+	static constexpr bool default_affine = false;
+
+	/** Default mohc mode: false (disabled). */
+	static constexpr bool default_mohc = false;
+
+	/** Default upper-bounding budget: 1 (no limit). */
+	static constexpr double default_loup_budget = 1.0;
+
 	/** Default fix-point ratio for contraction based on linear relaxation. */
 	static constexpr double default_relax_ratio = 0.2;
 
@@ -162,6 +218,9 @@ protected:
 	bool rigor;
 	bool inHC4;
 	bool kkt;
+	bool affine;
+	bool mohc;
+	double loup_budget;
 	double random_seed;
 };
 
@@ -174,6 +233,12 @@ inline bool DefaultOptimizerConfig::with_inHC4() { return inHC4; }
 
 inline bool DefaultOptimizerConfig::with_kkt() { return kkt; }
 
+inline bool DefaultOptimizerConfig::with_affine() { return affine; }
+
+inline bool DefaultOptimizerConfig::with_mohc() { return mohc; }
+
+inline double DefaultOptimizerConfig::get_loup_budget() { return loup_budget; }
+
 inline double DefaultOptimizerConfig::get_random_seed() { return random_seed; }
 
 } /* namespace ibex */
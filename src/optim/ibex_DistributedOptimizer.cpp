@@ -0,0 +1,537 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_DistributedOptimizer.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_DistributedOptimizer.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+
+using namespace std;
+
+namespace ibex {
+
+const double DistributedOptimizer::default_slice_time = 1.0;
+const size_t DistributedOptimizer::default_max_fragment_size = 1000;
+
+namespace {
+
+/*
+ * Messages exchanged between the coordinator and the workers.
+ *
+ * FRAGMENT (coordinator->worker):
+ *   initial loup, loup, loup-point, extended flag, boxes.
+ *   If the loup-point is not empty, it is also the first box
+ *   (see CovOptimData).
+ *
+ * RESULT (worker->coordinator):
+ *   status, loup, uplo of eps-boxes, loup-point, time, nb of cells,
+ *   boxes remaining in the buffer (in the extended space).
+ */
+enum { FRAGMENT=1, RESULT=2 };
+
+class MsgWriter {
+public:
+	void put_uint(uint32_t x)     { buf.append((const char*) &x, sizeof(x)); }
+
+	void put_ulong(uint64_t x)    { buf.append((const char*) &x, sizeof(x)); }
+
+	void put_double(double x)     { buf.append((const char*) &x, sizeof(x)); }
+
+	void put_box(const IntervalVector& x) {
+		put_uint(x.size());
+		put_uint(x.is_empty());
+		if (!x.is_empty())
+			for (int i=0; i<x.size(); i++) {
+				put_double(x[i].lb());
+				put_double(x[i].ub());
+			}
+	}
+
+	string buf;
+};
+
+class MsgReader {
+public:
+	MsgReader(const string& buf) : buf(buf), pos(0) { }
+
+	uint32_t get_uint()   { uint32_t x; get((char*) &x, sizeof(x)); return x; }
+
+	uint64_t get_ulong()  { uint64_t x; get((char*) &x, sizeof(x)); return x; }
+
+	double get_double()   { double x; get((char*) &x, sizeof(x)); return x; }
+
+	IntervalVector get_box() {
+		int n=get_uint();
+		if (get_uint()) return IntervalVector::empty(n);
+		IntervalVector x(n);
+		for (int i=0; i<n; i++) {
+			double lb=get_double();
+			double ub=get_double();
+			x[i]=Interval(lb,ub);
+		}
+		return x;
+	}
+
+private:
+	void get(char* x, size_t size) {
+		if (pos+size>buf.size()) ibex_error("[DistributedOptimizer] corrupted message");
+		memcpy(x, buf.data()+pos, size);
+		pos+=size;
+	}
+
+	const string& buf;
+	size_t pos;
+};
+
+} // end anonymous namespace
+
+DistributedOptimizer::DistributedOptimizer(Optimizer& optim, OptimTransport& transport) :
+		optim(optim), transport(transport),
+		slice_time(default_slice_time), max_fragment_size(default_max_fragment_size),
+		trace(0), timeout(-1),
+		nb_busy(0), time_out(false), status(Optimizer::SUCCESS),
+		uplo(NEG_INFINITY), uplo_of_epsboxes(POS_INFINITY), loup(POS_INFINITY),
+		loup_point(IntervalVector::empty(optim.n)), initial_loup(POS_INFINITY),
+		time(0), nb_cells(0), cov(NULL) {
+
+}
+
+DistributedOptimizer::~DistributedOptimizer() {
+	if (cov) delete cov;
+}
+
+void DistributedOptimizer::run(OptimChannel& channel) {
+	const int n=optim.n;
+	const int goal_var=optim.goal_var;
+
+	// the worker always works in the extended space
+	optim.extended_COV=true;
+	optim.trace=0;
+	optim.timeout=slice_time;
+
+	string msg;
+
+	while (channel.recv(msg)) {
+		MsgReader in(msg);
+		if (in.get_uint()!=FRAGMENT) ibex_error("[DistributedOptimizer] unexpected message");
+
+		double obj_init_bound=in.get_double();
+		double frag_loup=in.get_double();
+		IntervalVector frag_loup_point=in.get_box();
+		bool extended=in.get_uint();
+		size_t nb_boxes=in.get_uint();
+
+		CovOptimData data(extended? n+1 : n, extended);
+		data.data->_optim_loup = frag_loup;
+		data.data->_optim_uplo = NEG_INFINITY; // safe: the uplo can only increase
+		data.data->_optim_loup_point = frag_loup_point;
+		data.data->_optim_time = 0;
+		data.data->_optim_nb_cells = 0;
+
+		for (size_t i=0; i<nb_boxes; i++)
+			data.add(in.get_box());
+
+		optim.optimize(data, obj_init_bound);
+
+		const CovOptimData& res=optim.get_data();
+
+		MsgWriter out;
+		out.put_uint(RESULT);
+		out.put_uint(res.optimizer_status());
+		out.put_double(res.loup());
+		out.put_double(res.uplo_of_epsboxes());
+		out.put_box(res.loup_point());
+		out.put_double(res.time());
+		out.put_ulong(res.nb_cells());
+		// by convention, the first box is the loup-point
+		out.put_uint(res.size()-1);
+		for (size_t i=1; i<res.size(); i++) {
+			assert(res[i].size()==n+1);
+			if (!res[i].is_empty() && res[i][goal_var].lb()<=res.loup())
+				out.put_box(res[i]);
+			else
+				// keep the count consistent (an empty box is discarded by the coordinator)
+				out.put_box(IntervalVector::empty(n+1));
+		}
+		channel.send(out.buf);
+	}
+}
+
+Optimizer::Status DistributedOptimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
+	pool.clear();
+	raw_pool.clear();
+
+	loup=obj_init_bound;
+	initial_loup=obj_init_bound;
+	uplo=NEG_INFINITY;
+	uplo_of_epsboxes=POS_INFINITY;
+	loup_point=IntervalVector::empty(optim.n);
+
+	raw_pool.push_back(init_box);
+
+	if (cov) delete cov;
+	cov = new CovOptimData(optim.n+1, true);
+	cov->data->_optim_time = 0;
+	cov->data->_optim_nb_cells = 0;
+
+	return optimize();
+}
+
+Optimizer::Status DistributedOptimizer::optimize(const CovOptimData& data, double obj_init_bound) {
+	pool.clear();
+	raw_pool.clear();
+
+	initial_loup=obj_init_bound;
+	uplo=data.uplo();
+	loup=data.loup();
+	loup_point=data.loup_point();
+	uplo_of_epsboxes=POS_INFINITY;
+
+	for (size_t i=loup_point.is_empty()? 0 : 1; i<data.size(); i++) {
+		if (data.is_extended_space())
+			pool.insert(make_pair(data[i][optim.goal_var].lb(), data[i]));
+		else
+			raw_pool.push_back(data[i]);
+	}
+
+	if (cov) delete cov;
+	cov = new CovOptimData(optim.n+1, true);
+	cov->data->_optim_time = data.time();
+	cov->data->_optim_nb_cells = data.nb_cells();
+
+	return optimize();
+}
+
+Optimizer::Status DistributedOptimizer::optimize(const char* cov_file, double obj_init_bound) {
+	CovOptimData data(cov_file);
+	return optimize(data, obj_init_bound);
+}
+
+double DistributedOptimizer::compute_ymax() const {
+	// same as Optimizer::compute_ymax()
+	if (optim.anticipated_upper_bounding) {
+		double ymax = loup>0 ?
+				1/(1+optim.rel_eps_f)*loup
+		:
+				1/(1-optim.rel_eps_f)*loup;
+
+		if (loup - optim.abs_eps_f < ymax)
+			ymax = loup - optim.abs_eps_f;
+		return next_float(ymax);
+	} else
+		return loup;
+}
+
+double DistributedOptimizer::get_obj_rel_prec() const {
+	// same as Optimizer::get_obj_rel_prec()
+	if (loup==POS_INFINITY)
+		return POS_INFINITY;
+	else if (loup==0)
+		if (uplo<0) return POS_INFINITY;
+		else return 0;
+	else
+		return (loup-uplo)/(fabs(uplo));
+}
+
+void DistributedOptimizer::contract_pool() {
+	if (loup==POS_INFINITY) return;
+	// remove all the boxes with a lower bound greater than ymax
+	pool.erase(pool.upper_bound(compute_ymax()), pool.end());
+}
+
+void DistributedOptimizer::update_uplo() {
+	double new_uplo;
+
+	if (pool.empty() && raw_pool.empty() && nb_busy==0) {
+		// search is over
+		if (loup==POS_INFINITY) return;
+		// not new_uplo=loup, because constraint y <= ymax was enforced
+		new_uplo=compute_ymax();
+	} else {
+		new_uplo=raw_pool.empty() ? POS_INFINITY : NEG_INFINITY;
+		if (!pool.empty() && pool.begin()->first < new_uplo)
+			new_uplo=pool.begin()->first;
+		for (size_t w=0; w<busy.size(); w++)
+			if (busy[w] && busy_uplo[w] < new_uplo)
+				new_uplo=busy_uplo[w];
+	}
+
+	if (uplo_of_epsboxes < new_uplo) new_uplo=uplo_of_epsboxes;
+
+	if (new_uplo > uplo) {
+		uplo = new_uplo;
+		if (trace)
+			cout << "\033[33m uplo= " << uplo << "\033[0m" << endl;
+	}
+}
+
+void DistributedOptimizer::dispatch() {
+
+	contract_pool();
+
+	vector<int> idle;
+	for (int w=0; w<transport.nb_workers(); w++)
+		if (!busy[w]) idle.push_back(w);
+
+	if (idle.empty()) return;
+
+	vector<MsgWriter> frag(idle.size());
+	vector<bool> extended(idle.size(),true);
+	vector<vector<IntervalVector> > boxes(idle.size());
+	vector<double> frag_uplo(idle.size(),POS_INFINITY);
+
+	// Boxes of the original space are sent first (one by worker)
+	size_t k=0;
+	while (k<idle.size() && !raw_pool.empty()) {
+		boxes[k].push_back(raw_pool.back());
+		raw_pool.pop_back();
+		extended[k]=false;
+		frag_uplo[k]=NEG_INFINITY;
+		k++;
+	}
+
+	// The pool is split among the remaining idle workers.
+	// Boxes are distributed in a round-robin fashion so that
+	// each worker gets a share of the most promising ones.
+	size_t nb_idle=idle.size()-k;
+	if (nb_idle>0 && !pool.empty()) {
+		size_t frag_size=(pool.size()+nb_idle-1)/nb_idle;
+		if (frag_size>max_fragment_size) frag_size=max_fragment_size;
+
+		size_t j=0;
+		multimap<double,IntervalVector>::iterator it=pool.begin();
+		while (it!=pool.end() && j<frag_size*nb_idle) {
+			size_t i=k+(j%nb_idle);
+			boxes[i].push_back(it->second);
+			if (it->first < frag_uplo[i]) frag_uplo[i]=it->first;
+			pool.erase(it++);
+			j++;
+		}
+	}
+
+	for (size_t i=0; i<idle.size(); i++) {
+		if (boxes[i].empty()) continue;
+
+		MsgWriter out;
+		out.put_uint(FRAGMENT);
+		out.put_double(initial_loup);
+		out.put_double(loup);
+		out.put_box(loup_point);
+		out.put_uint(extended[i]);
+		out.put_uint(boxes[i].size() + (loup_point.is_empty() ? 0 : 1));
+
+		if (!loup_point.is_empty()) {
+			// by convention, the first box is the loup-point
+			if (extended[i]) {
+				IntervalVector ext_loup_point(optim.n+1);
+				for (int j=0, j2=0; j<optim.n; j++, j2++) {
+					if (j2==optim.goal_var) j2++; // skip goal variable
+					ext_loup_point[j2]=loup_point[j];
+				}
+				ext_loup_point[optim.goal_var]=Interval(NEG_INFINITY,loup);
+				out.put_box(ext_loup_point);
+			} else
+				out.put_box(loup_point);
+		}
+
+		for (vector<IntervalVector>::const_iterator it=boxes[i].begin(); it!=boxes[i].end(); ++it)
+			out.put_box(*it);
+
+		int w=idle[i];
+		transport.send(w, out.buf);
+		busy[w]=true;
+		busy_uplo[w]=frag_uplo[i];
+		nb_busy++;
+
+		if (trace >= 2)
+			cout << " worker " << w << " <- " << boxes[i].size() << " box(es)" << endl;
+	}
+}
+
+void DistributedOptimizer::merge(int w, const string& msg) {
+	MsgReader in(msg);
+	if (in.get_uint()!=RESULT) ibex_error("[DistributedOptimizer] unexpected message");
+
+	busy[w]=false;
+	nb_busy--;
+
+	in.get_uint(); // status of the worker (not used)
+	double res_loup=in.get_double();
+	double res_uplo_of_epsboxes=in.get_double();
+	IntervalVector res_loup_point=in.get_box();
+	time += in.get_double();
+	nb_cells += in.get_ulong();
+
+	if (res_uplo_of_epsboxes < uplo_of_epsboxes)
+		uplo_of_epsboxes = res_uplo_of_epsboxes;
+
+	if (res_loup < loup && !res_loup_point.is_empty()) {
+		loup = res_loup;
+		loup_point = res_loup_point;
+		if (trace)
+			cout << "                    \033[32m loup= " << loup << "\033[0m (worker " << w << ")" << endl;
+	}
+
+	size_t nb_boxes=in.get_uint();
+	for (size_t i=0; i<nb_boxes; i++) {
+		IntervalVector box=in.get_box();
+		if (!box.is_empty())
+			pool.insert(make_pair(box[optim.goal_var].lb(), box));
+	}
+
+	if (trace >= 2)
+		cout << " worker " << w << " -> " << nb_boxes << " box(es), pool size=" << pool.size() << endl;
+}
+
+Optimizer::Status DistributedOptimizer::optimize() {
+
+	int nb_workers=transport.nb_workers();
+
+	busy.assign(nb_workers, false);
+	busy_uplo.assign(nb_workers, POS_INFINITY);
+	nb_busy=0;
+	time_out=false;
+	time=0;
+	nb_cells=0;
+
+	chrono::steady_clock::time_point start=chrono::steady_clock::now();
+
+	transport.start(*this);
+
+	bool stop=false;
+
+	try {
+		while (true) {
+
+			if (!stop) dispatch();
+
+			if (nb_busy==0) break;
+
+			string msg;
+			int w=transport.recv(msg);
+
+			merge(w, msg);
+
+			contract_pool();
+
+			update_uplo();
+
+			if (uplo_of_epsboxes == NEG_INFINITY)
+				stop=true;
+
+			if (!optim.anticipated_upper_bounding) // useless to check precision on objective if 'true'
+				if (get_obj_rel_prec()<optim.rel_eps_f || loup-uplo<optim.abs_eps_f)
+					stop=true;
+
+			if (timeout>0 && chrono::duration<double>(chrono::steady_clock::now()-start).count() >= timeout) {
+				time_out=true;
+				stop=true;
+			}
+		}
+	} catch(OptimTransport::Failure&) {
+		transport.stop();
+		ibex_error("[DistributedOptimizer] a worker terminated abnormally");
+	}
+
+	transport.stop();
+
+	if (time_out)
+		status = Optimizer::TIME_OUT;
+	else if (uplo_of_epsboxes == NEG_INFINITY)
+		status = Optimizer::UNBOUNDED_OBJ;
+	else if (uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && optim.abs_eps_f==0 && optim.rel_eps_f==0)))
+		status = Optimizer::INFEASIBLE;
+	else if (loup==initial_loup)
+		status = Optimizer::NO_FEASIBLE_FOUND;
+	else if (get_obj_rel_prec()>optim.rel_eps_f && loup-uplo>optim.abs_eps_f)
+		status = Optimizer::UNREACHED_PREC;
+	else
+		status = Optimizer::SUCCESS;
+
+	int n=optim.n;
+	int goal_var=optim.goal_var;
+
+	for (int i=0; i<n+1; i++)
+		cov->data->_optim_var_names.push_back(string(""));
+
+	cov->data->_optim_optimizer_status = (unsigned int) status;
+	cov->data->_optim_uplo = uplo;
+	cov->data->_optim_uplo_of_epsboxes = uplo_of_epsboxes;
+	cov->data->_optim_loup = loup;
+	cov->data->_optim_time += time;
+	cov->data->_optim_nb_cells += nb_cells;
+	cov->data->_optim_loup_point = loup_point;
+
+	// by convention, the first box has to be the loup-point.
+	IntervalVector tmp(n+1);
+	for (int i=0, i2=0; i<n; i++, i2++) {
+		if (i2==goal_var) i2++; // skip goal variable
+		tmp[i2]=loup_point.is_empty() ? Interval::empty_set() : loup_point[i];
+	}
+	tmp[goal_var] = Interval(uplo,loup);
+	cov->add(tmp);
+
+	for (multimap<double,IntervalVector>::const_iterator it=pool.begin(); it!=pool.end(); ++it)
+		cov->add(it->second);
+
+	for (vector<IntervalVector>::const_iterator it=raw_pool.begin(); it!=raw_pool.end(); ++it) {
+		for (int i=0, i2=0; i<n; i++, i2++) {
+			if (i2==goal_var) i2++;
+			tmp[i2]=(*it)[i];
+		}
+		tmp[goal_var] = Interval(uplo,loup);
+		cov->add(tmp);
+	}
+
+	pool.clear();
+	raw_pool.clear();
+
+	return status;
+}
+
+void DistributedOptimizer::report() {
+
+	if (!cov) {
+		cout << " not started." << endl;
+		return;
+	}
+
+	switch(status) {
+	case Optimizer::SUCCESS:           cout << " optimization successful!" << endl; break;
+	case Optimizer::INFEASIBLE:        cout << " infeasible problem" << endl; break;
+	case Optimizer::NO_FEASIBLE_FOUND: cout << " no feasible point found (the problem may be infeasible)" << endl; break;
+	case Optimizer::UNBOUNDED_OBJ:     cout << " possibly unbounded objective (f*=-oo)" << endl; break;
+	case Optimizer::TIME_OUT:          cout << " time limit " << timeout << "s. reached " << endl; break;
+	case Optimizer::UNREACHED_PREC:    cout << " unreached precision" << endl; break;
+	}
+	cout << endl;
+
+	if (status!=Optimizer::INFEASIBLE) {
+		cout << " f* in\t[" << uplo << "," << loup << "]" << endl;
+		cout << "\t(best bound)" << endl << endl;
+
+		if (loup==initial_loup)
+			cout << " x* =\t--\n\t(no feasible point found)" << endl;
+		else {
+			if (optim.loup_finder.rigorous())
+				cout << " x* in\t" << loup_point << endl;
+			else
+				cout << " x* =\t" << loup_point.lb() << endl;
+			cout << "\t(best feasible point)" << endl;
+		}
+		cout << endl;
+	}
+
+	cout << " number of workers:\t\t" << transport.nb_workers() << endl;
+	cout << " cpu time used (all workers):\t" << time << "s" << endl;
+	cout << " number of cells:\t\t" << nb_cells << endl << endl;
+}
+
+} // end namespace ibex
@@ -0,0 +1,275 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_DistributedOptimizer.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_DISTRIBUTED_OPTIMIZER_H__
+#define __IBEX_DISTRIBUTED_OPTIMIZER_H__
+
+#include "ibex_Optimizer.h"
+#include "ibex_OptimTransport.h"
+
+#include <map>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup optim
+ *
+ * \brief Distributed global optimizer.
+ *
+ * The search is distributed over several workers, each running its own
+ * copy of an #Optimizer. The coordinator (this object) maintains a pool
+ * of pending (extended) boxes and hands out fragments of this pool to idle
+ * workers. A fragment is sent as a #CovOptimData structure, from which the
+ * worker restarts its optimizer (see Optimizer::optimize(const CovOptimData&,...))
+ * for a limited amount of time (#slice_time).
+ *
+ * When the slice is over (or the buffer of the worker runs dry), the worker sends
+ * back its loup and the boxes remaining in its buffer. The coordinator merges them
+ * into the pool, removes the boxes that cannot contain a point better than the loup,
+ * and redistributes the pool among idle workers. Each fragment carries the best loup
+ * found so far, which is how improved loups are broadcast.
+ *
+ * The communication is delegated to an #OptimTransport, so that workers
+ * can be processes on the same machine (see #OptimSocketTransport) or
+ * on remote nodes.
+ */
+class DistributedOptimizer : protected OptimWorkerTask {
+
+public:
+	/**
+	 * \brief Create a distributed optimizer.
+	 *
+	 * \param optim     - the optimizer run by each worker. With a transport
+	 *                    that forks processes, each worker gets its own copy.
+	 * \param transport - the transport layer.
+	 */
+	DistributedOptimizer(Optimizer& optim, OptimTransport& transport);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~DistributedOptimizer();
+
+	/**
+	 * \brief Run the optimization.
+	 *
+	 * See Optimizer::optimize(const IntervalVector&,double) for
+	 * the return values.
+	 */
+	Optimizer::Status optimize(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
+
+	/**
+	 * \brief Continue optimization from a COV structure.
+	 */
+	Optimizer::Status optimize(const CovOptimData& cov, double obj_init_bound=POS_INFINITY);
+
+	/**
+	 * \brief Continue optimization from a COV file.
+	 */
+	Optimizer::Status optimize(const char* cov_file, double obj_init_bound=POS_INFINITY);
+
+	/**
+	 * \brief Displays on standard output a report of the last call to optimize(...).
+	 */
+	void report();
+
+	/**
+	 * \brief Get the status of the last call to optimize(...).
+	 */
+	Optimizer::Status get_status() const;
+
+	/**
+	 * \brief Get the "uplo" (<= f*).
+	 */
+	double get_uplo() const;
+
+	/**
+	 * \brief Get the "loup" (>= f*).
+	 */
+	double get_loup() const;
+
+	/**
+	 * \brief Get x* (== argmin).
+	 */
+	const IntervalVector& get_loup_point() const;
+
+	/**
+	 * \brief Get the cumulated CPU time of all the workers.
+	 */
+	double get_time() const;
+
+	/**
+	 * \brief Get the number of cells generated by all the workers.
+	 */
+	size_t get_nb_cells() const;
+
+	/**
+	 * \brief Get all optimization data.
+	 *
+	 * The structure is always in the extended space.
+	 */
+	const CovOptimData& get_data() const;
+
+	/** Default slice time: 1s. */
+	static const double default_slice_time;
+
+	/** Default maximal number of boxes in a fragment: 1000. */
+	static const size_t default_max_fragment_size;
+
+	/**
+	 * \brief The optimizer run by each worker.
+	 */
+	Optimizer& optim;
+
+	/**
+	 * \brief The transport layer.
+	 */
+	OptimTransport& transport;
+
+	/**
+	 * \brief Maximal CPU time of a worker before it sends back its buffer.
+	 *
+	 * A short slice means faster loup broadcast and better load balancing
+	 * but more communication.
+	 */
+	double slice_time;
+
+	/**
+	 * \brief Maximal number of boxes sent in a fragment.
+	 */
+	size_t max_fragment_size;
+
+	/**
+	 * \brief Trace activation flag (see Optimizer::trace).
+	 */
+	int trace;
+
+	/**
+	 * \brief Time limit (wall-clock time, in seconds).
+	 *
+	 * -1 means no limit.
+	 */
+	double timeout;
+
+protected:
+
+	/**
+	 * \brief Worker main loop.
+	 *
+	 * Receive fragments, run the optimizer on each of them and send back the result.
+	 */
+	void run(OptimChannel& channel);
+
+	/**
+	 * \brief Run the coordinator loop (once the pool is initialized).
+	 */
+	Optimizer::Status optimize();
+
+	/**
+	 * \brief Send a fragment to every idle worker.
+	 */
+	void dispatch();
+
+	/**
+	 * \brief Merge the result sent back by a worker.
+	 */
+	void merge(int worker, const std::string& msg);
+
+	/**
+	 * \brief Remove boxes from the pool that cannot improve the loup.
+	 */
+	void contract_pool();
+
+	/**
+	 * \brief Update the uplo.
+	 */
+	void update_uplo();
+
+	/**
+	 * \brief Loup decreased with the precision (see Optimizer::compute_ymax()).
+	 */
+	double compute_ymax() const;
+
+	/**
+	 * \brief Relative precision on the objective (see Optimizer::get_obj_rel_prec()).
+	 */
+	double get_obj_rel_prec() const;
+
+	/* Pending extended boxes, sorted by lower bound of the objective. */
+	std::multimap<double,IntervalVector> pool;
+
+	/* Pending boxes in the original space (not contracted yet). */
+	std::vector<IntervalVector> raw_pool;
+
+	/* Whether each worker is currently processing a fragment. */
+	std::vector<bool> busy;
+
+	/* Lower bound of the objective in the fragment of each busy worker. */
+	std::vector<double> busy_uplo;
+
+	/* Number of busy workers. */
+	int nb_busy;
+
+	/* Whether the time limit has been reached. */
+	bool time_out;
+
+	/* Status of the last optimization. */
+	Optimizer::Status status;
+
+	/* The current uplo. */
+	double uplo;
+
+	/* Lower bound of the small boxes taken by the precision. */
+	double uplo_of_epsboxes;
+
+	/* The current loup. */
+	double loup;
+
+	/* The loup-point. */
+	IntervalVector loup_point;
+
+	/* The bound on the objective given by the user. */
+	double initial_loup;
+
+	/* Cumulated CPU time of the workers. */
+	double time;
+
+	/* Number of cells handled by the workers. */
+	size_t nb_cells;
+
+	/* Result. */
+	CovOptimData* cov;
+
+private:
+	DistributedOptimizer(const DistributedOptimizer&); // forbidden
+};
+
+/*================================== inline implementations ========================================*/
+
+inline Optimizer::Status DistributedOptimizer::get_status() const { return status; }
+
+inline double DistributedOptimizer::get_uplo() const { return uplo; }
+
+inline double DistributedOptimizer::get_loup() const { return loup; }
+
+inline const IntervalVector& DistributedOptimizer::get_loup_point() const { return loup_point; }
+
+inline double DistributedOptimizer::get_time() const { return time; }
+
+inline size_t DistributedOptimizer::get_nb_cells() const { return nb_cells; }
+
+inline const CovOptimData& DistributedOptimizer::get_data() const {
+	if (!cov) ibex_error("[DistributedOptimizer] no data (run optimizer first)");
+	return *cov;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_DISTRIBUTED_OPTIMIZER_H__
@@ -0,0 +1,200 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_OptimSocketTransport.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_OptimSocketTransport.h"
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdint.h>
+
+#ifndef MSG_NOSIGNAL // e.g., macOS
+#define MSG_NOSIGNAL 0
+#endif
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+#ifndef _WIN32
+
+namespace {
+
+// write exactly "size" bytes (return false on failure)
+// note: MSG_NOSIGNAL avoids SIGPIPE if the peer has terminated.
+bool write_all(int fd, const char* buf, size_t size) {
+	while (size>0) {
+		ssize_t k=::send(fd, buf, size, MSG_NOSIGNAL);
+		if (k<0) {
+			if (errno==EINTR) continue;
+			return false;
+		}
+		buf+=k;
+		size-=k;
+	}
+	return true;
+}
+
+// read exactly "size" bytes (return false on failure or end of stream)
+bool read_all(int fd, char* buf, size_t size) {
+	while (size>0) {
+		ssize_t k=::read(fd, buf, size);
+		if (k<0) {
+			if (errno==EINTR) continue;
+			return false;
+		}
+		if (k==0) return false;
+		buf+=k;
+		size-=k;
+	}
+	return true;
+}
+
+bool send_msg(int fd, const string& msg) {
+	uint64_t size=msg.size();
+	return write_all(fd, (const char*) &size, sizeof(size)) && write_all(fd, msg.data(), msg.size());
+}
+
+bool recv_msg(int fd, string& msg) {
+	uint64_t size;
+	if (!read_all(fd, (char*) &size, sizeof(size))) return false;
+	msg.resize(size);
+	return size==0 || read_all(fd, &msg[0], size);
+}
+
+class SocketChannel : public OptimChannel {
+public:
+	SocketChannel(int fd) : fd(fd) { }
+
+	void send(const string& msg) {
+		if (!send_msg(fd, msg)) _exit(1); // the coordinator is gone
+	}
+
+	bool recv(string& msg) {
+		return recv_msg(fd, msg);
+	}
+
+	int fd;
+};
+
+} // end anonymous namespace
+
+OptimSocketTransport::OptimSocketTransport(int nb_workers) : n(nb_workers), fd(nb_workers,-1), pid(nb_workers,-1), next(0) {
+	if (n<1) ibex_error("[OptimSocketTransport] at least one worker is required");
+}
+
+OptimSocketTransport::~OptimSocketTransport() {
+	stop();
+}
+
+void OptimSocketTransport::start(OptimWorkerTask& task) {
+
+	for (int w=0; w<n; w++) {
+		int sv[2];
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv)!=0)
+			ibex_error("[OptimSocketTransport] cannot create socket");
+
+		pid[w]=fork();
+
+		if (pid[w]<0)
+			ibex_error("[OptimSocketTransport] cannot fork worker");
+
+		if (pid[w]==0) {
+			// worker process: close the coordinator sides
+			// (including those of the previous workers)
+			::close(sv[0]);
+			for (int w2=0; w2<w; w2++) ::close(fd[w2]);
+
+			SocketChannel channel(sv[1]);
+			int ret=0;
+			try {
+				task.run(channel);
+			} catch(...) {
+				ret=1; // the coordinator will detect the closed channel
+			}
+			::close(sv[1]);
+			// do not run the destructors/atexit of the coordinator
+			_exit(ret);
+		}
+
+		::close(sv[1]);
+		fd[w]=sv[0];
+	}
+}
+
+void OptimSocketTransport::send(int worker, const string& msg) {
+	if (fd[worker]<0 || !send_msg(fd[worker], msg))
+		throw Failure();
+}
+
+int OptimSocketTransport::recv(string& msg) {
+	vector<struct pollfd> pfd(n);
+	for (int w=0; w<n; w++) {
+		pfd[w].fd=fd[w];  // negative fd are ignored by poll
+		pfd[w].events=POLLIN;
+		pfd[w].revents=0;
+	}
+
+	while (poll(&pfd[0], n, -1)<0) {
+		if (errno!=EINTR) throw Failure();
+	}
+
+	for (int i=0; i<n; i++) {
+		int w=(next+i)%n;
+		if (pfd[w].revents & (POLLIN | POLLHUP | POLLERR)) {
+			next=(w+1)%n;
+			if (!recv_msg(fd[w], msg)) {
+				::close(fd[w]);
+				fd[w]=-1;
+				throw Failure();
+			}
+			return w;
+		}
+	}
+	throw Failure();
+}
+
+void OptimSocketTransport::stop() {
+	for (int w=0; w<n; w++) {
+		if (fd[w]>=0) {
+			::close(fd[w]); // the worker receives an end of stream
+			fd[w]=-1;
+		}
+		if (pid[w]>0) {
+			int status;
+			waitpid(pid[w], &status, 0);
+			pid[w]=-1;
+		}
+	}
+}
+
+#else
+
+OptimSocketTransport::OptimSocketTransport(int nb_workers) : n(nb_workers), next(0) {
+	not_implemented("OptimSocketTransport on Windows");
+}
+
+OptimSocketTransport::~OptimSocketTransport() { }
+
+void OptimSocketTransport::start(OptimWorkerTask&) { }
+
+void OptimSocketTransport::send(int, const string&) { }
+
+int OptimSocketTransport::recv(string&) { return 0; }
+
+void OptimSocketTransport::stop() { }
+
+#endif // _WIN32
+
+} // end namespace ibex
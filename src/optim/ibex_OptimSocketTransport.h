@@ -0,0 +1,94 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_OptimSocketTransport.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_OPTIM_SOCKET_TRANSPORT_H__
+#define __IBEX_OPTIM_SOCKET_TRANSPORT_H__
+
+#include "ibex_OptimTransport.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup optim
+ *
+ * \brief Transport based on Unix-domain sockets.
+ *
+ * Each worker is a child process created by fork() and connected
+ * to the coordinator by a pair of Unix-domain sockets. Since a worker
+ * is a copy of the coordinator process, it inherits all the objects
+ * (system, contractors, optimizer, etc.) built before #start(...).
+ *
+ * Messages are framed by their length so that boundaries are preserved.
+ *
+ * \note Only available on POSIX platforms.
+ */
+class OptimSocketTransport : public OptimTransport {
+public:
+	/**
+	 * \brief Create a transport for \a nb_workers workers.
+	 */
+	OptimSocketTransport(int nb_workers);
+
+	/**
+	 * \brief Delete this.
+	 *
+	 * Workers still running are stopped.
+	 */
+	~OptimSocketTransport();
+
+	/**
+	 * \brief Number of workers.
+	 */
+	int nb_workers() const;
+
+	/**
+	 * \brief Fork the workers.
+	 */
+	void start(OptimWorkerTask& task);
+
+	/**
+	 * \brief Send a message to a worker.
+	 */
+	void send(int worker, const std::string& msg);
+
+	/**
+	 * \brief Wait for the next message from any worker.
+	 */
+	int recv(std::string& msg);
+
+	/**
+	 * \brief Close all the sockets and wait for the workers.
+	 */
+	void stop();
+
+protected:
+	/** Number of workers. */
+	const int n;
+
+	/** Coordinator side socket of each worker (-1 if closed). */
+	std::vector<int> fd;
+
+	/** Process id of each worker. */
+	std::vector<int> pid;
+
+	/** Worker polled first by the next call to recv (fairness). */
+	int next;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int OptimSocketTransport::nb_workers() const {
+	return n;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_OPTIM_SOCKET_TRANSPORT_H__
@@ -0,0 +1,126 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_OptimTransport.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_OPTIM_TRANSPORT_H__
+#define __IBEX_OPTIM_TRANSPORT_H__
+
+#include "ibex_Exception.h"
+
+#include <string>
+
+namespace ibex {
+
+/**
+ * \ingroup optim
+ *
+ * \brief Communication channel of a worker (worker side).
+ *
+ * A channel conveys messages (raw sequences of bytes) between
+ * a worker and the coordinator. Message boundaries are preserved.
+ */
+class OptimChannel {
+public:
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~OptimChannel() { }
+
+	/**
+	 * \brief Send a message to the coordinator.
+	 */
+	virtual void send(const std::string& msg)=0;
+
+	/**
+	 * \brief Wait for the next message from the coordinator.
+	 *
+	 * \return false if the coordinator has closed the channel.
+	 */
+	virtual bool recv(std::string& msg)=0;
+};
+
+/**
+ * \ingroup optim
+ *
+ * \brief Task executed by each worker.
+ */
+class OptimWorkerTask {
+public:
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~OptimWorkerTask() { }
+
+	/**
+	 * \brief Worker main loop.
+	 *
+	 * The worker returns when the channel is closed.
+	 */
+	virtual void run(OptimChannel& channel)=0;
+};
+
+/**
+ * \ingroup optim
+ *
+ * \brief Transport layer of the distributed optimizer (coordinator side).
+ *
+ * A transport spawns a fixed number of workers and conveys messages
+ * between the coordinator and each of them. Workers are numbered
+ * from 0 to nb_workers()-1.
+ *
+ * This class is abstract. See #OptimSocketTransport for an implementation
+ * based on Unix-domain sockets (one process per worker on a single machine).
+ *
+ * \see #DistributedOptimizer.
+ */
+class OptimTransport {
+public:
+	/**
+	 * \brief Thrown when communication with a worker fails.
+	 */
+	class Failure : public Exception { };
+
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~OptimTransport() { }
+
+	/**
+	 * \brief Number of workers.
+	 */
+	virtual int nb_workers() const=0;
+
+	/**
+	 * \brief Spawn the workers.
+	 *
+	 * Each worker executes task.run(...) with its own channel.
+	 */
+	virtual void start(OptimWorkerTask& task)=0;
+
+	/**
+	 * \brief Send a message to a worker.
+	 */
+	virtual void send(int worker, const std::string& msg)=0;
+
+	/**
+	 * \brief Wait for the next message from any worker.
+	 *
+	 * \return the number of the sending worker.
+	 * \throw Failure if a worker has terminated abnormally.
+	 */
+	virtual int recv(std::string& msg)=0;
+
+	/**
+	 * \brief Close all the channels and wait for workers termination.
+	 */
+	virtual void stop()=0;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_OPTIM_TRANSPORT_H__
@@ -4,7 +4,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 14, 2012
-// Last Update : Apr 08, 2019
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_Optimizer.h"
@@ -47,7 +47,7 @@ Optimizer::Optimizer(int n, Ctc& ctc, Bsc& bsc, LoupFinder& finder,
                 						n(n), goal_var(goal_var),
 										ctc(ctc), bsc(bsc), loup_finder(finder), buffer(buffer),
 										eps_x(eps_x), rel_eps_f(rel_eps_f), abs_eps_f(abs_eps_f),
-										trace(0), timeout(-1), extended_COV(true), anticipated_upper_bounding(true),
+										trace(0), timeout(-1), extended_COV(true), anticipated_upper_bounding(true), telemetry(NULL),
 										status(SUCCESS),
 										uplo(NEG_INFINITY), uplo_of_epsboxes(POS_INFINITY), loup(POS_INFINITY),
 										loup_point(IntervalVector::empty(n)), initial_loup(POS_INFINITY), loup_changed(false),
@@ -71,6 +71,7 @@ Optimizer::Optimizer(OptimizerConfig& config) :
 		timeout     (config.get_timeout()),
 		extended_COV(config.with_extended_cov()),
 		anticipated_upper_bounding(config.with_anticipated_upper_bounding()),
+		telemetry(NULL),
 		status(SUCCESS),
 		uplo(NEG_INFINITY), uplo_of_epsboxes(POS_INFINITY), loup(POS_INFINITY),
 		loup_point(IntervalVector::empty(n)), initial_loup(POS_INFINITY), loup_changed(false),
@@ -194,6 +195,8 @@ void Optimizer::update_uplo_of_epsboxes(double ymin) {
 
 void Optimizer::handle_cell(Cell& c) {
 
+	if (telemetry) telemetry->cell(c.depth);
+
 	contract_and_bound(c);
 
 	if (c.box.is_empty()) {
@@ -217,6 +220,7 @@ void Optimizer::contract_and_bound(Cell& c) {
 	y &= Interval(NEG_INFINITY,ymax);
 
 	if (y.is_empty()) {
+		if (telemetry) telemetry->closed(c.depth, SearchTelemetry::LOUP);
 		c.box.set_empty();
 		return;
 	} else {
@@ -236,7 +240,10 @@ void Optimizer::contract_and_bound(Cell& c) {
 
 	ctc.contract(c.box, context);
 	//cout << c.prop << endl;
-	if (c.box.is_empty()) return;
+	if (c.box.is_empty()) {
+		if (telemetry) telemetry->emptied(c.depth, context.emptied_by? *context.emptied_by : ctc);
+		return;
+	}
 
 	//cout << " [contract]  x after=" << c.box << endl;
 	//cout << " [contract]  y after=" << y << endl;
@@ -262,6 +269,7 @@ void Optimizer::contract_and_bound(Cell& c) {
 	loup_changed |= loup_ch;
 
 	if (y.is_empty()) { // fix issue #44
+		if (telemetry) telemetry->closed(c.depth, SearchTelemetry::LOUP);
 		c.box.set_empty();
 		return;
 	}
@@ -274,6 +282,7 @@ void Optimizer::contract_and_bound(Cell& c) {
 	//   and "goal_abs_prec" for the goal variable)
 	// - the extended box has no bisectable domains (if prec=0 or <1 ulp)
 	if ((tmp_box.max_diam()<=eps_x && y.diam() <=abs_eps_f) || !c.box.is_bisectable()) {
+		if (telemetry) telemetry->closed(c.depth, SearchTelemetry::EPS_BOX);
 		update_uplo_of_epsboxes(y.lb());
 		c.box.set_empty();
 		return;
@@ -283,6 +292,7 @@ void Optimizer::contract_and_bound(Cell& c) {
 	//kkt.contract(tmp_box);
 
 	if (tmp_box.is_empty()) {
+		if (telemetry) telemetry->closed(c.depth, SearchTelemetry::CONTRACTOR);
 		c.box.set_empty();
 	} else {
 		// the current extended box in the cell is updated
@@ -338,6 +348,8 @@ void Optimizer::start(const IntervalVector& init_box, double obj_init_bound) {
 	// add data required by the loup finder
 	loup_finder.add_property(init_box, root->prop);
 
+	loup_finder.start(init_box);
+
 	//cout << "**** Properties ****\n" << root->prop << endl;
 
 	loup_changed=false;
@@ -351,6 +363,8 @@ void Optimizer::start(const IntervalVector& init_box, double obj_init_bound) {
 	cov->data->_optim_time = 0;
 	cov->data->_optim_nb_cells = 0;
 
+	if (telemetry) telemetry->start();
+
 	handle_cell(*root);
 }
 
@@ -371,6 +385,9 @@ void Optimizer::start(const CovOptimData& data, double obj_init_bound) {
 
 	buffer.flush();
 
+	// hull of the initial boxes (for the loup finder)
+	IntervalVector init_box=IntervalVector::empty(n);
+
 	for (size_t i=loup_point.is_empty()? 0 : 1; i<data.size(); i++) {
 
 		IntervalVector box(n+1);
@@ -399,8 +416,14 @@ void Optimizer::start(const CovOptimData& data, double obj_init_bound) {
 		loup_finder.add_property(box, cell->prop);
 
 		buffer.push(cell);
+
+		IntervalVector orig_box(n);
+		read_ext_box(box, orig_box);
+		init_box |= orig_box;
 	}
 
+	loup_finder.start(init_box);
+
 	loup_changed=false;
 	initial_loup=obj_init_bound;
 
@@ -410,6 +433,8 @@ void Optimizer::start(const CovOptimData& data, double obj_init_bound) {
 	cov = new CovOptimData(extended_COV? n+1 : n, extended_COV);
 	cov->data->_optim_time = data.time();
 	cov->data->_optim_nb_cells = data.nb_cells();
+
+	if (telemetry) telemetry->start();
 }
 
 Optimizer::Status Optimizer::optimize() {
@@ -449,7 +474,12 @@ Optimizer::Status Optimizer::optimize() {
 
 					double ymax=compute_ymax();
 
-					buffer.contract(ymax);
+					if (telemetry) {
+						unsigned int size=buffer.size();
+						buffer.contract(ymax);
+						telemetry->pruned(size-buffer.size());
+					} else
+						buffer.contract(ymax);
 
 					//cout << " now buffer is contracted and min=" << buffer.minimum() << endl;
 
@@ -461,6 +491,11 @@ Optimizer::Status Optimizer::optimize() {
 				}
 				update_uplo();
 
+				if (telemetry) {
+					telemetry->bounds(uplo, loup);
+					telemetry->node(buffer.size());
+				}
+
 				if (!anticipated_upper_bounding) // useless to check precision on objective if 'true'
 					if (get_obj_rel_prec()<rel_eps_f || get_obj_abs_prec()<abs_eps_f)
 						break;
@@ -470,6 +505,7 @@ Optimizer::Status Optimizer::optimize() {
 
 			}
 			catch (NoBisectableVariableException& ) {
+				if (telemetry) telemetry->closed(c->depth, SearchTelemetry::EPS_BOX);
 				update_uplo_of_epsboxes((c->box)[goal_var].lb());
 				buffer.pop();
 				delete c; // deletes the cell.
@@ -511,6 +547,11 @@ Optimizer::Status Optimizer::optimize() {
 	cov->data->_optim_nb_cells += nb_cells;
 	cov->data->_optim_loup_point = loup_point;
 
+	if (telemetry) {
+		telemetry->bounds(uplo, loup);
+		telemetry->end();
+	}
+
 	// for conversion between original/extended boxes
 	IntervalVector tmp(extended_COV ? n+1 : n);
 
@@ -13,6 +13,7 @@
 
 #include "ibex_OptimizerConfig.h"
 #include "ibex_CovOptimData.h"
+#include "ibex_SearchTelemetry.h"
 
 namespace ibex {
 
@@ -312,6 +313,15 @@ public:
 	 */
 	bool anticipated_upper_bounding; // TODO: should be set in OptimizerConfig
 
+	/**
+	 * \brief Search-tree statistics (NULL if none).
+	 *
+	 * Not owned by the optimizer.
+	 *
+	 * Default value: NULL.
+	 */
+	SearchTelemetry* telemetry;
+
 protected:
 	/*
 	 * \brief Initialize the optimizer from a single box.
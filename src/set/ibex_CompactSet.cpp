@@ -0,0 +1,302 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CompactSet.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CompactSet.h"
+#include "ibex_SetBisect.h"
+#include "ibex_SetLeaf.h"
+
+#include <stack>
+#include <fstream>
+#include <cstring>
+#include <climits>
+#include <stdint.h>
+#include <cmath>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+const char* CompactSet::SIGNATURE = "IBEX COMPACT SET FILE  ";
+
+const size_t CompactSet::SIGNATURE_LENGTH = 24;
+
+const unsigned int CompactSet::FORMAT_VERSION = 1;
+
+namespace {
+
+/*
+ * File header. The size is a multiple of 8 so that the
+ * array of bisection points that follows is aligned.
+ */
+struct Header {
+	char signature[24];
+	uint32_t version;
+	uint32_t n;
+	uint64_t size;
+	uint64_t nb_bisect;
+};
+
+}
+
+CompactSet::CompactSet(const Set& set) : n(set.Rn.size()), mapping(NULL), mapping_size(0) {
+
+	// the second field is the number of the father if the node
+	// is a right subnode, -1 otherwise.
+	std::stack<pair<const SetNode*,int> > s;
+
+	s.push(pair<const SetNode*,int>(set.root,-1));
+
+	while (!s.empty()) {
+		const SetNode* node=s.top().first;
+		int father=s.top().second;
+		s.pop();
+
+		if (father!=-1) _right[father]=_code.size();
+
+		if (node->is_leaf()) {
+			_code.push_back(-1-((const SetLeaf*) node)->status);
+		} else {
+			const SetBisect* b=(const SetBisect*) node;
+			int j=_var.size();
+			_code.push_back(j);
+			_var.push_back(b->var);
+			_pt.push_back(b->pt);
+			_right.push_back(-1); // set later
+			s.push(pair<const SetNode*,int>(b->right,j));
+			s.push(pair<const SetNode*,int>(b->left,-1));
+		}
+	}
+
+	size=_code.size();
+	nb_bisect=_var.size();
+	code=&_code[0];
+	var=nb_bisect>0? &_var[0] : NULL;
+	pt=nb_bisect>0? &_pt[0] : NULL;
+	right=nb_bisect>0? &_right[0] : NULL;
+}
+
+CompactSet::CompactSet(const char* filename, bool map) : n(0), size(0), nb_bisect(0),
+		code(NULL), var(NULL), pt(NULL), right(NULL), mapping(NULL), mapping_size(0) {
+	if (!map || !this->map(filename))
+		read(filename);
+}
+
+CompactSet::~CompactSet() {
+#ifndef _WIN32
+	if (mapping) munmap(mapping, mapping_size);
+#endif
+}
+
+void CompactSet::read(const char* filename) {
+	ifstream is;
+	is.open(filename, ios::in | ios::binary);
+
+	if (is.fail()) ibex_error("[CompactSet]: cannot open input file.\n");
+
+	Header h;
+	is.read((char*) &h, sizeof(Header));
+
+	if (is.eof()) ibex_error("[CompactSet]: unexpected end of file.");
+
+	if (strncmp(h.signature,SIGNATURE,SIGNATURE_LENGTH)!=0)
+		ibex_error("[CompactSet]: not an Ibex \"compact set\" file.");
+
+	if (h.version>FORMAT_VERSION)
+		ibex_error("[CompactSet] unsupported format version");
+
+	if (h.size==0 || h.size>INT_MAX || h.nb_bisect>=h.size)
+		ibex_error("[CompactSet]: corrupted file.");
+
+	n=h.n;
+	size=h.size;
+	nb_bisect=h.nb_bisect;
+
+	_pt.resize(nb_bisect);
+	_code.resize(size);
+	_var.resize(nb_bisect);
+	_right.resize(nb_bisect);
+
+	if (nb_bisect>0) is.read((char*) &_pt[0], nb_bisect*sizeof(double));
+	is.read((char*) &_code[0], size*sizeof(int));
+	if (nb_bisect>0) {
+		is.read((char*) &_var[0], nb_bisect*sizeof(int));
+		is.read((char*) &_right[0], nb_bisect*sizeof(int));
+	}
+
+	if (is.fail()) ibex_error("[CompactSet]: unexpected end of file.");
+
+	is.close();
+
+	code=&_code[0];
+	var=nb_bisect>0? &_var[0] : NULL;
+	pt=nb_bisect>0? &_pt[0] : NULL;
+	right=nb_bisect>0? &_right[0] : NULL;
+
+	if (!well_formed())
+		ibex_error("[CompactSet]: corrupted file.");
+}
+
+bool CompactSet::map(const char* filename) {
+#ifndef _WIN32
+	int fd=open(filename, O_RDONLY);
+	if (fd==-1) return false;
+
+	struct stat st;
+	if (fstat(fd,&st)==-1 || (size_t) st.st_size<sizeof(Header)) {
+		close(fd);
+		return false;
+	}
+
+	void* addr=mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); // the mapping remains valid
+
+	if (addr==MAP_FAILED) return false;
+
+	const Header* h=(const Header*) addr;
+
+	if (strncmp(h->signature,SIGNATURE,SIGNATURE_LENGTH)!=0 || h->version>FORMAT_VERSION
+			|| h->size==0 || h->size>INT_MAX || h->nb_bisect>=h->size
+			|| (size_t) st.st_size!=sizeof(Header)+h->nb_bisect*sizeof(double)+(h->size+2*h->nb_bisect)*sizeof(int)) {
+		// let read() report the error
+		munmap(addr, st.st_size);
+		return false;
+	}
+
+	mapping=addr;
+	mapping_size=st.st_size;
+
+	n=h->n;
+	size=h->size;
+	nb_bisect=h->nb_bisect;
+
+	pt=(const double*) (h+1);
+	code=(const int*) (pt+nb_bisect);
+	var=code+size;
+	right=var+nb_bisect;
+
+	if (!well_formed()) {
+		// let read() report the error
+		munmap(mapping, mapping_size);
+		mapping=NULL;
+		mapping_size=0;
+		code=var=right=NULL;
+		pt=NULL;
+		return false;
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool CompactSet::well_formed() const {
+	if (n<1) return false;
+
+	// Visit the nodes in preorder: the kth node
+	// visited must be the kth in the arrays.
+	std::stack<int> s;
+	s.push(0);
+	int k=0; // next node expected
+	int j=0; // next bisection node expected
+
+	while (!s.empty()) {
+		if (k>=size || s.top()!=k) return false;
+		s.pop();
+
+		if (is_leaf(k)) {
+			if (code[k]<-1-MAYBE) return false;
+		} else {
+			if (j>=nb_bisect || code[k]!=j) return false;
+			if (var[j]<0 || var[j]>=n) return false;
+			if (right[j]<=k+1 || right[j]>=size) return false;
+			if (!std::isfinite(pt[j])) return false;
+			s.push(right[j]);
+			s.push(k+1);
+			j++;
+		}
+		k++;
+	}
+
+	return k==size && j==nb_bisect;
+}
+
+void CompactSet::save(const char* filename) const {
+	ofstream os;
+	os.open(filename, ios::out | ios::trunc | ios::binary);
+
+	if (os.fail())
+		ibex_error("[CompactSet]: cannot create output file.\n");
+
+	Header h;
+	memset(&h, 0, sizeof(Header));
+	strncpy(h.signature, SIGNATURE, SIGNATURE_LENGTH);
+	h.version=FORMAT_VERSION;
+	h.n=n;
+	h.size=size;
+	h.nb_bisect=nb_bisect;
+
+	os.write((const char*) &h, sizeof(Header));
+	os.write((const char*) pt, nb_bisect*sizeof(double));
+	os.write((const char*) code, size*sizeof(int));
+	os.write((const char*) var, nb_bisect*sizeof(int));
+	os.write((const char*) right, nb_bisect*sizeof(int));
+
+	os.close();
+}
+
+void CompactSet::visit(SetVisitor& visitor) const {
+	IntervalVector nodebox(n);
+	visit(0, nodebox, visitor);
+}
+
+void CompactSet::visit(int k, IntervalVector& nodebox, SetVisitor& visitor) const {
+	if (is_leaf(k)) {
+		visitor.visit_leaf(nodebox, status(k));
+	} else if (visitor.visit_node(nodebox)) {
+		int j=code[k];
+		Interval save=nodebox[var[j]];
+		nodebox[var[j]]=Interval(save.lb(),pt[j]);
+		visit(k+1, nodebox, visitor);
+		nodebox[var[j]]=Interval(pt[j],save.ub());
+		visit(right[j], nodebox, visitor);
+		nodebox[var[j]]=save;
+	}
+}
+
+BoolInterval CompactSet::is_superset(const IntervalVector& box) const {
+	IntervalVector nodebox(n);
+	return is_superset(0, nodebox, box);
+}
+
+BoolInterval CompactSet::is_superset(int k, IntervalVector& nodebox, const IntervalVector& box) const {
+	if (!nodebox.intersects(box)) return YES;
+	else if (is_leaf(k)) return status(k);
+	else {
+		int j=code[k];
+		Interval save=nodebox[var[j]];
+		nodebox[var[j]]=Interval(save.lb(),pt[j]);
+		BoolInterval res=is_superset(k+1, nodebox, box);
+		if (res!=NO) {
+			nodebox[var[j]]=Interval(pt[j],save.ub());
+			res = res & is_superset(right[j], nodebox, box);
+		}
+		nodebox[var[j]]=save;
+		return res;
+	}
+}
+
+} // namespace ibex
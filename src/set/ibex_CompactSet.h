@@ -0,0 +1,189 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CompactSet.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_COMPACT_SET_H__
+#define __IBEX_COMPACT_SET_H__
+
+#include "ibex_Set.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup iset
+ * \brief Compact (read-only) representation of a set.
+ *
+ * The paving of a #Set is a tree of nodes, each allocated separately.
+ * This class stores the same paving in a few flat arrays (the nodes
+ * being numbered in depth-first order):
+ *
+ * - for each node, a code (the index of the bisection if the node is a
+ *   bisection node, the status otherwise);
+ * - for each bisection node, the bisected variable, the bisection point
+ *   and the number of the right subnode (the left subnode immediately
+ *   follows its father).
+ *
+ * The boxes of the nodes are not stored but recalculated on the fly
+ * when the paving is traversed.
+ *
+ * The arrays are saved in a file as is, so that a file can be loaded
+ * either by a few bulk reads or by mapping it directly in memory.
+ */
+class CompactSet {
+public:
+
+	/**
+	 * \brief Build the compact representation of a set.
+	 */
+	CompactSet(const Set& set);
+
+	/**
+	 * \brief Load a compact set from a file.
+	 *
+	 * \param map - if true, the file is mapped in memory instead of being read
+	 *              (only on platforms supporting mmap, otherwise the file is read).
+	 *              The file must not be modified while this set exists.
+	 *
+	 * The content of the file is checked (the tree structure, the
+	 * variable and node indices). A corrupted file raises an error.
+	 *
+	 * \see #save().
+	 */
+	CompactSet(const char* filename, bool map=false);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~CompactSet();
+
+	/**
+	 * \brief Dimension of the set.
+	 */
+	int nb_var() const;
+
+	/**
+	 * \brief Number of nodes of the paving.
+	 */
+	int nb_nodes() const;
+
+	/**
+	 * \brief True if this set is empty.
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief YES only if this set is a superset of the box.
+	 */
+	BoolInterval is_superset(const IntervalVector& box) const;
+
+	/**
+	 * \brief Visit the set.
+	 *
+	 * The nodes are visited in the same order as with Set::visit(...).
+	 */
+	void visit(SetVisitor& visitor) const;
+
+	/**
+	 * \brief Save the set into a file.
+	 */
+	void save(const char* filename) const;
+
+protected:
+	friend class Set;
+
+	/** Signature of the file format */
+	static const char* SIGNATURE;
+
+	/** Length of the signature (including the final '\0') */
+	static const size_t SIGNATURE_LENGTH;
+
+	/** File format version */
+	static const unsigned int FORMAT_VERSION;
+
+	/* True if the kth node is a leaf */
+	bool is_leaf(int k) const;
+
+	/* Status of the kth node (a leaf) */
+	BoolInterval status(int k) const;
+
+	/*
+	 * True if the arrays encode a valid tree, i.e., all the indices are
+	 * in range and the nodes are in preorder (checked when a file is loaded).
+	 */
+	bool well_formed() const;
+
+	void visit(int k, IntervalVector& nodebox, SetVisitor& visitor) const;
+
+	BoolInterval is_superset(int k, IntervalVector& nodebox, const IntervalVector& box) const;
+
+	/** Dimension. */
+	int n;
+
+	/** Number of nodes. */
+	int size;
+
+	/** Number of bisection nodes. */
+	int nb_bisect;
+
+	/** Code of each node. */
+	const int* code;
+
+	/** Variable of each bisection node. */
+	const int* var;
+
+	/** Bisection point of each bisection node. */
+	const double* pt;
+
+	/** Number of the right subnode of each bisection node. */
+	const int* right;
+
+private:
+	CompactSet(const CompactSet&); // forbidden
+
+	/* Set the arrays with the content of a file */
+	void read(const char* filename);
+	bool map(const char* filename);
+
+	/* Storage (when the file is not mapped) */
+	std::vector<int> _code;
+	std::vector<int> _var;
+	std::vector<double> _pt;
+	std::vector<int> _right;
+
+	/* Mapped file (NULL if none) */
+	void* mapping;
+	size_t mapping_size;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int CompactSet::nb_var() const {
+	return n;
+}
+
+inline int CompactSet::nb_nodes() const {
+	return size;
+}
+
+inline bool CompactSet::is_leaf(int k) const {
+	return code[k]<0;
+}
+
+inline BoolInterval CompactSet::status(int k) const {
+	return (BoolInterval) (-1-code[k]);
+}
+
+inline bool CompactSet::is_empty() const {
+	return is_leaf(0) && status(0)==NO;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_COMPACT_SET_H__
@@ -5,19 +5,220 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Jun 12, 2015
+// Last Update : Oct 19, 2026
 //============================================================================
 
 
 #include "ibex_Sep.h"
+#include "ibex_SetBisect.h"
+#include "ibex_Threads.h"
+
+#include <algorithm>
+#include <deque>
+#include <exception>
 
 using namespace std;
 
 namespace ibex {
 
+const double Sep::min_task_ratio = 64;
+
+namespace {
+
+/*
+ * Left subtree of a bisection node, handed over to another thread.
+ */
+class Task {
+public:
+	Task(bool iset, SetBisect& node, const IntervalVector& box, double eps) :
+		iset(iset), node(node), box(box), eps(eps), state(PENDING) { }
+
+	void run(Sep& sep) {
+		try {
+			node.left = node.left->inter(iset, box, sep, eps);
+		} catch(...) {
+			error = std::current_exception();
+		}
+	}
+
+	bool iset;
+	SetBisect& node;
+	IntervalVector box;
+	double eps;
+	enum { PENDING, RUNNING, DONE } state;
+	std::exception_ptr error;
+};
+
+}
+
+/*
+ * Tasks shared by a fixed set of threads, created once
+ * by contract(set,eps,clones).
+ *
+ * A task is submitted only if a thread is idle. The thread
+ * that has submitted a task waits for it before merging the
+ * subtrees and, if no thread has taken the task in the
+ * meantime, runs it itself.
+ */
+class Sep::Pool {
+public:
+	Pool() : idle(0), closed(false) { }
+
+	/*
+	 * Submit a task (return false if no thread is idle or
+	 * if the subtree is too small).
+	 */
+	bool submit(Task& task, const IntervalVector& nodebox, double eps) {
+		if (nodebox.max_diam()<=min_task_ratio*eps) return false;
+		{
+			Lock lock(mutex);
+			if (idle<=(int) tasks.size()) return false;
+			tasks.push_back(&task);
+		}
+#ifndef _WIN32
+		cond.notify_all();
+#endif
+		return true;
+	}
+
+	/*
+	 * Wait for a task submitted by the caller.
+	 *
+	 * Return false if the task was still pending (it is
+	 * removed and has to be run by the caller).
+	 */
+	bool join(Task& task) {
+#ifndef _WIN32
+		std::unique_lock<std::mutex> lock(mutex.m);
+#else
+		Lock lock(mutex);
+#endif
+		if (task.state==Task::PENDING) {
+			tasks.erase(std::find(tasks.begin(), tasks.end(), &task));
+			return false;
+		}
+#ifndef _WIN32
+		cond.wait(lock, [&task] { return task.state==Task::DONE; });
+#endif
+		return true;
+	}
+
+	/*
+	 * Run the tasks with sep until the pool is closed.
+	 */
+	void work(Sep& sep) {
+		while (true) {
+			Task* task;
+			{
+#ifndef _WIN32
+				std::unique_lock<std::mutex> lock(mutex.m);
+				idle++;
+				cond.wait(lock, [this] { return closed || !tasks.empty(); });
+				idle--;
+#else
+				Lock lock(mutex);
+#endif
+				if (tasks.empty()) return;
+				task=tasks.front();
+				tasks.pop_front();
+				task->state=Task::RUNNING;
+			}
+			task->run(sep);
+			{
+				Lock lock(mutex);
+				task->state=Task::DONE;
+			}
+#ifndef _WIN32
+			cond.notify_all();
+#endif
+		}
+	}
+
+	/*
+	 * Make all the threads leave work().
+	 */
+	void close() {
+		{
+			Lock lock(mutex);
+			closed=true;
+		}
+#ifndef _WIN32
+		cond.notify_all();
+#endif
+	}
+
+	Mutex mutex;
+#ifndef _WIN32
+	std::condition_variable_any cond;
+#endif
+	std::deque<Task*> tasks;
+	int idle;
+	bool closed;
+};
+
 void Sep::contract(Set& set, double eps) {
 	set.root = set.root->inter(false, set.Rn, *this, eps);
 }
 
+void Sep::contract(Set& set, double eps, Array<Sep>& clones) {
+	Pool p;
+	for (int i=0; i<clones.size(); i++) {
+		assert(clones[i].nb_var==nb_var);
+		clones[i].pool = &p;
+	}
+	pool = &p;
+
+	try {
+		// the threads are created once for all
+		run_threads(1+clones.size(), [&](int w) {
+			if (w==0) {
+				try {
+					contract(set, eps);
+				} catch(...) {
+					p.close();
+					throw;
+				}
+				p.close();
+			} else
+				p.work(clones[w-1]);
+		});
+	} catch(...) {
+		pool = NULL;
+		for (int i=0; i<clones.size(); i++) clones[i].pool = NULL;
+		throw;
+	}
+
+	pool = NULL;
+	for (int i=0; i<clones.size(); i++) clones[i].pool = NULL;
+}
+
+void Sep::inter_subnodes(bool iset, SetBisect& node, const IntervalVector& nodebox, double eps) {
+
+	IntervalVector left_box=node.left_box(nodebox);
+	IntervalVector right_box=node.right_box(nodebox);
+
+	Task task(iset, node, left_box, eps);
+
+	if (pool && pool->submit(task, nodebox, eps)) {
+		// the two subtrees are built independently, without any lock
+		try {
+			node.right = node.right->inter(iset, right_box, *this, eps);
+		} catch(...) {
+			pool->join(task); // the task refers to this stack frame
+			throw;
+		}
+		if (!pool->join(task))
+			task.run(*this);
+		if (task.error) std::rethrow_exception(task.error);
+	} else {
+		node.left = node.left->inter(iset, left_box, *this, eps);
+		node.right = node.right->inter(iset, right_box, *this, eps);
+	}
+
+	node.left->father = &node;
+	node.right->father = &node;
+}
+
 void Sep::contract(SetInterval& iset, double eps, BoolInterval status1, BoolInterval status2) {
 	_status1=status1;
 	_status2=status2;
@@ -18,6 +18,7 @@
 #include "ibex_IntervalVector.h"
 #include "ibex_Set.h"
 #include "ibex_SetInterval.h"
+#include "ibex_Array.h"
 
 namespace ibex {
 
@@ -87,6 +88,20 @@ public:
 	 */
 	void contract(Set& set, double eps);
 
+	/**
+	 * \brief Contract a set with this separator, using several threads.
+	 *
+	 * Same as contract(set,eps) but independent subtrees of the paving
+	 * are processed in parallel by 1+clones.size() threads.
+	 *
+	 * A separator is not thread-safe, so each additional thread
+	 * works with its own separator in \a clones. The clones must all be
+	 * equivalent to this separator (e.g., built from copies of the same function,
+	 * see Function::COPY). The resulting paving is then identical to
+	 * the one obtained with contract(set,eps).
+	 */
+	void contract(Set& set, double eps, Array<Sep>& clones);
+
 	/**
 	 * \brief Contract an i-set with this separator.
 	 *
@@ -120,7 +135,27 @@ public:
   // (Used by SetBisect & SetLeaf)
   BoolInterval status2() const;
 
+  // Intersect the two subnodes of a bisection node with this separator,
+  // possibly in parallel with another thread.
+  // (Used by SetBisect & SetLeaf)
+  void inter_subnodes(bool iset, SetBisect& node, const IntervalVector& nodebox, double eps);
+
+  /**
+   * \brief Minimal size of subtrees processed by another thread.
+   *
+   * A subtree is handed over to an idle thread only if the
+   * diameter of its box is greater than min_task_ratio*eps
+   * (otherwise, the work is too small to compensate the cost
+   * of the synchronization).
+   */
+  static const double min_task_ratio;
+
 private:
+    class Pool;
+
+    // Tasks shared by the threads (NULL if this
+    // separator is not used in parallel)
+    Pool* pool;
 
     BoolInterval _status1;
     BoolInterval _status2;
@@ -130,7 +165,7 @@ private:
  	 	 	 	 	 	 	 inline implementation
   ============================================================================*/
 
-inline Sep::Sep(int n) : nb_var(n), _status1(YES), _status2(NO) { }
+inline Sep::Sep(int n) : nb_var(n), pool(NULL), _status1(YES), _status2(NO) { }
 
 inline Sep::~Sep() { }
 
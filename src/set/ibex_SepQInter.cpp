@@ -5,11 +5,10 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Mar 3, 2015
-// Last Update : Jul 05, 2016
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_SepQInter.h"
-#include "ibex_QInter.h"
 
 namespace ibex {
 
@@ -36,8 +35,8 @@ void SepQInter::separate(IntervalVector& xin, IntervalVector& xout) {
 		refs_out.set_ref(i,boxes_out[i]);
 	}
 
-	xin &= qinter(refs_in,q+1);
-  xout &= qinter(refs_out, list.size() - q);
+	xin &= qinter_in.qinter(refs_in,q+1);
+  xout &= qinter_out.qinter(refs_out, list.size() - q);
 
 }
 
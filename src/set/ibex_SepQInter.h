@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 22, 2015
-// Last Update : Jul 05, 2016
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_SEP_QINTER_H__
@@ -14,6 +14,7 @@
 #include "ibex_Sep.h"
 #include "ibex_Array.h"
 #include "ibex_IntervalMatrix.h"
+#include "ibex_QInter.h"
 
 namespace ibex {
 /**
@@ -69,6 +70,11 @@ protected:
     */
   IntervalMatrix boxes_out;
 
+	/**
+	 * \brief q-intersection algorithms (for in and out boxes)
+	 */
+	QInter qinter_in, qinter_out;
+
 	/**
 	 * The number of contractors we have to intersect the
 	 * result.
@@ -5,11 +5,13 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : 13 juil. 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_Set.h"
 #include "ibex_SetLeaf.h"
 #include "ibex_SetBisect.h"
+#include "ibex_CompactSet.h"
 #include "ibex_Heap.h"
 #include "ibex_CellStack.h"
 #include "ibex_SepFwdBwd.h"
@@ -79,6 +81,37 @@ Set::Set(const char* filename) : root(NULL), Rn(1) {
 	load(filename);
 }
 
+Set::Set(const CompactSet& set) : root(NULL), Rn(set.nb_var()) {
+
+	std::stack<pair<SetBisect*,int> > s; // a bisection node and the number of its right subnode
+
+	for (int k=0; k<set.nb_nodes(); k++) {
+		SetNode* node;
+		if (set.is_leaf(k))
+			node = new SetLeaf(set.status(k));
+		else {
+			int j=set.code[k];
+			node = new SetBisect(set.var[j], set.pt[j]); // left and right are both set to NULL temporarily
+		}
+
+		if (k==0)
+			root = node;
+		else {
+			// the father is the deepest bisection node whose right subnode is not set.
+			SetBisect* father = s.top().first;
+			if (s.top().second==k) {
+				father->right = node;
+				s.pop();
+			} else
+				father->left = node;
+			node->father = father;
+		}
+
+		if (!set.is_leaf(k))
+			s.push(pair<SetBisect*,int>((SetBisect*) node, set.right[set.code[k]]));
+	}
+}
+
 bool Set::is_empty() const {
 	return root->is_leaf() && ((SetLeaf*) root)->status==NO;
 }
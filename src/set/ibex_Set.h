@@ -5,6 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : 13 juil. 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_SET_H__
@@ -18,6 +19,8 @@
 
 namespace ibex {
 
+class CompactSet;
+
 /**
  * \defgroup iset Set
  */
@@ -47,6 +50,13 @@ public:
 	 */
 	Set(const char* filename);
 
+	/**
+	 * \brief Creates a set from its compact representation.
+	 *
+	 * \see #CompactSet.
+	 */
+	Set(const CompactSet& set);
+
 	/**
 	 * \brief Build the set (f(x) op 0).
 	 */
@@ -136,6 +146,7 @@ public:
 
 protected:
 	friend class Sep;
+	friend class CompactSet;
 
 	/**
 	 * \brief Inflate a box by one float.
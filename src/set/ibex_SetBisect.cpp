@@ -5,6 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : 13 juil. 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_SetBisect.h"
@@ -123,10 +124,7 @@ SetNode* SetBisect::inter(bool iset, const IntervalVector& nodebox, Sep& sep, do
 
 	SetBisect* bis = (SetBisect*) this2;
 
-	bis->left = bis->left->inter(iset, left_box(nodebox), sep, eps);
-	bis->left->father = bis;
-	bis->right = bis->right->inter(iset,right_box(nodebox), sep, eps);
-	bis->right->father = bis;
+	sep.inter_subnodes(iset, *bis, nodebox, eps);
 
 	// status of children may have changed --> try merge or update status
 	return bis->try_merge();
@@ -5,6 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : 13 juil. 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include <stdlib.h>
@@ -262,10 +263,9 @@ SetNode* SetLeaf::inter(bool iset, const IntervalVector& nodebox, Sep& sep, doub
 				SetNode* right = new SetLeaf(status);
 
 				SetBisect* bis = new SetBisect(var, pt);
-				bis->left = left->inter(iset, p.first, sep, eps);
-				bis->left->father = bis;
-				bis->right = right->inter(iset, p.second, sep, eps);
-				bis->right->father = bis;
+				bis->left = left;
+				bis->right = right;
+				sep.inter_subnodes(iset, *bis, box, eps);
 				root4=bis->try_merge();
 			} else {
 				root4=new SetLeaf(status);
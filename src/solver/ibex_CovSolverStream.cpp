@@ -0,0 +1,290 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CovSolverStream.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CovSolverStream.h"
+#include "ibex_Solver.h"
+
+#include <cstring>
+#include <stdint.h>
+
+using namespace std;
+
+namespace ibex {
+
+const unsigned int CovSolverStream::FORMAT_VERSION = 1;
+
+namespace {
+
+const size_t SIGNATURE_LENGTH = 20;
+const char*  SIGNATURE = "IBEX SOLVER STREAM ";
+
+enum { INNER_TAG, SOLUTION_TAG, BOUNDARY_TAG, UNKNOWN_TAG, PENDING_TAG, END_TAG };
+
+void write_pos_int(ofstream& f, uint32_t x) {
+	f.write((char*) &x, sizeof(uint32_t));
+}
+
+void write_double(ofstream& f, double x) {
+	f.write((char*) &x, sizeof(x));
+}
+
+void write_box(ofstream& f, const IntervalVector& box) {
+	for (int i=0; i<box.size(); i++) {
+		write_double(f,box[i].lb());
+		write_double(f,box[i].ub());
+	}
+}
+
+void write_varset(ofstream& f, const VarSet& varset) {
+	write_pos_int(f, varset.nb_param);
+	for (int i=0; i<varset.nb_param; i++)
+		write_pos_int(f, varset.param(i));
+}
+
+// The read functions return false if the end of file is reached
+// (the last record may be incomplete if the solver has been killed).
+
+bool read_pos_int(ifstream& f, uint32_t& x) {
+	f.read((char*) &x, sizeof(x));
+	return !f.eof() && !f.fail();
+}
+
+bool read_double(ifstream& f, double& x) {
+	f.read((char*) &x, sizeof(x));
+	return !f.eof() && !f.fail();
+}
+
+bool read_box(ifstream& f, IntervalVector& box) {
+	double lb,ub;
+	for (int j=0; j<box.size(); j++) {
+		if (!read_double(f,lb) || !read_double(f,ub)) return false;
+		box[j]=Interval(lb,ub);
+	}
+	return true;
+}
+
+bool read_varset(ifstream& f, size_t n, BitSet& params) {
+	uint32_t nb_param, v;
+	if (!read_pos_int(f, nb_param)) return false;
+	if (nb_param>n)
+		ibex_error("[CovSolverStream]: bad input file (bad number of parameters)");
+	params.clear();
+	for (uint32_t i=0; i<nb_param; i++) {
+		if (!read_pos_int(f, v)) return false;
+		if (v>=n) ibex_error("[CovSolverStream]: bad input file (bad parameter index)");
+		params.add(v);
+	}
+	return true;
+}
+
+} // end anonymous namespace
+
+CovSolverStream::CovSolverStream(const char* filename) : flush_period(100), flush_time(1.0),
+		header(false), n(0), nb_unflushed(0), last_flush(chrono::steady_clock::now()) {
+
+	f.open(filename, ios::out | ios::binary | ios::trunc);
+
+	if (f.fail())
+		ibex_error("[CovSolverStream]: cannot create output file.\n");
+}
+
+CovSolverStream::~CovSolverStream() {
+	f.close();
+}
+
+void CovSolverStream::write_header(const CovSolverData& data) {
+	if (header) {
+		if (data.n!=n) ibex_error("[CovSolverStream]: number of variables mismatch");
+		return;
+	}
+
+	f.write(SIGNATURE, SIGNATURE_LENGTH*sizeof(char));
+	write_pos_int(f, FORMAT_VERSION);
+	write_pos_int(f, data.n);
+	write_pos_int(f, data.nb_eq());
+	write_pos_int(f, data.nb_ineq());
+
+	const vector<string>& var_names=((CovSolverData&) data).var_names();
+	write_pos_int(f, var_names.size());
+	for (vector<string>::const_iterator it=var_names.begin(); it!=var_names.end(); it++) {
+		f.write(it->c_str(),it->size()*sizeof(char));
+		f.put('\0');
+	}
+
+	header=true;
+	n=data.n;
+}
+
+bool CovSolverStream::output(const CovSolverData& data) {
+
+	write_header(data);
+
+	size_t i=data.size()-1;
+	size_t m=data.nb_eq();
+	bool varset=m>0 && m<n;
+
+	switch (data.status(i)) {
+	case CovSolverData::SOLUTION:
+		if (m==0) {
+			write_pos_int(f, INNER_TAG);
+			write_box(f, data[i]);
+		} else {
+			size_t j=data.nb_solution()-1;
+			write_pos_int(f, SOLUTION_TAG);
+			write_box(f, data.solution(j));
+			write_box(f, data.unicity(j));
+			if (varset) write_varset(f, data.solution_varset(j));
+		}
+		break;
+	case CovSolverData::BOUNDARY:
+		write_pos_int(f, BOUNDARY_TAG);
+		write_box(f, data[i]);
+		if (varset) write_varset(f, data.boundary_varset(data.nb_boundary()-1));
+		break;
+	case CovSolverData::UNKNOWN:
+		write_pos_int(f, UNKNOWN_TAG);
+		write_box(f, data[i]);
+		break;
+	default:
+		write_pos_int(f, PENDING_TAG);
+		write_box(f, data[i]);
+	}
+
+	record_written();
+
+	return true;
+}
+
+void CovSolverStream::end(const CovSolverData& data) {
+	write_header(data);
+	write_pos_int(f, END_TAG);
+	write_pos_int(f, data.solver_status());
+	write_double(f, data.time());
+	write_pos_int(f, data.nb_cells());
+	flush();
+}
+
+void CovSolverStream::record_written() {
+	if (++nb_unflushed>=flush_period ||
+		chrono::duration<double>(chrono::steady_clock::now()-last_flush).count() >= flush_time)
+		flush();
+}
+
+void CovSolverStream::flush() {
+	f.flush();
+	nb_unflushed=0;
+	last_flush=chrono::steady_clock::now();
+}
+
+CovSolverData* CovSolverStream::read(const char* filename) {
+
+	ifstream f;
+
+	f.open(filename, ios::in | ios::binary);
+
+	if (f.fail()) ibex_error("[CovSolverStream]: cannot open input file.\n");
+
+	char sig[SIGNATURE_LENGTH];
+	f.read(sig, SIGNATURE_LENGTH*sizeof(char));
+	if (f.eof() || memcmp(sig,SIGNATURE,SIGNATURE_LENGTH)!=0)
+		ibex_error("[CovSolverStream]: not an Ibex solver stream file.");
+
+	uint32_t version, n, m, nb_ineq, nb_names;
+
+	if (!read_pos_int(f, version) || !read_pos_int(f, n) || !read_pos_int(f, m) ||
+		!read_pos_int(f, nb_ineq) || !read_pos_int(f, nb_names))
+		ibex_error("[CovSolverStream]: unexpected end of file.");
+
+	if (version>FORMAT_VERSION)
+		ibex_error("[CovSolverStream]: unsupported format version");
+
+	if (nb_names!=0 && nb_names!=n)
+		ibex_error("[CovSolverStream]: bad number of variable names");
+
+	vector<string> var_names;
+	char x;
+	for (uint32_t i=0; i<nb_names; i++) {
+		string name;
+		do {
+			f.read(&x, sizeof(char));
+			if (f.eof()) ibex_error("[CovSolverStream]: unexpected end of file.");
+			if (x!='\0') name+=x;
+		} while(x!='\0');
+		var_names.push_back(name);
+	}
+
+	CovSolverData* data = new CovSolverData(n, m, nb_ineq, CovManifold::EQU_ONLY, var_names);
+
+	bool varset=m>0 && m<n;
+	bool complete=false;
+	uint32_t tag;
+	IntervalVector box(n), unicity(n);
+	BitSet params(n);
+
+	while (read_pos_int(f, tag)) {
+		bool ok;
+		switch (tag) {
+		case INNER_TAG:
+			if ((ok=read_box(f, box))) data->add_inner(box);
+			break;
+		case SOLUTION_TAG:
+			ok=read_box(f, box) && read_box(f, unicity) && (!varset || read_varset(f, n, params));
+			if (ok) {
+				if (varset)
+					data->add_solution(box, unicity, VarSet(n,params,false));
+				else
+					data->add_solution(box, unicity);
+			}
+			break;
+		case BOUNDARY_TAG:
+			ok=read_box(f, box) && (!varset || read_varset(f, n, params));
+			if (ok) {
+				if (varset)
+					data->add_boundary(box, VarSet(n,params,false));
+				else
+					data->add_boundary(box);
+			}
+			break;
+		case UNKNOWN_TAG:
+			if ((ok=read_box(f, box))) data->add_unknown(box);
+			break;
+		case PENDING_TAG:
+			if ((ok=read_box(f, box))) data->add_pending(box);
+			break;
+		case END_TAG: {
+			uint32_t status, nb_cells;
+			double time;
+			ok=read_pos_int(f, status) && read_double(f, time) && read_pos_int(f, nb_cells);
+			if (ok) {
+				if (status>(uint32_t) Solver::USER_BREAK)
+					ibex_error("[CovSolverStream]: invalid solver status.");
+				data->set_solver_status(status);
+				data->set_time(time);
+				data->set_nb_cells(nb_cells);
+			}
+			break;
+		}
+		default:
+			delete data;
+			ibex_error("[CovSolverStream]: bad record identifier.");
+			return NULL;
+		}
+		if (!ok) break;
+		complete = (tag==END_TAG);
+	}
+
+	if (!complete) // the search has been interrupted
+		data->set_solver_status(Solver::USER_BREAK);
+
+	f.close();
+
+	return data;
+}
+
+} // end namespace ibex
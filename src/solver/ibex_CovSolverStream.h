@@ -0,0 +1,146 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CovSolverStream.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_COV_SOLVER_STREAM_H__
+#define __IBEX_COV_SOLVER_STREAM_H__
+
+#include "ibex_SolverListener.h"
+
+#include <fstream>
+#include <chrono>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Append-only solver output file.
+ *
+ * This listener writes every box found by the solver into a file, as
+ * soon as it is found. Contrary to a COV file (see CovSolverData::save(...)),
+ * where the number of boxes of each kind precede the boxes, the file is a
+ * sequence of independent records, so that it can be appended to during the
+ * search. The file is flushed periodically (see #flush_period and #flush_time)
+ * so that it can be read by another process while the solver is running.
+ *
+ * The file can be converted back to a regular #CovSolverData structure by
+ * #read(...). If the search was not terminated properly (crash, kill), the
+ * last incomplete record is ignored and the solver status is USER_BREAK.
+ *
+ * Combined with Solver::keep_output=false, the memory used by the solver to
+ * store its output boxes remains bounded.
+ *
+ * Format:
+ * <pre>
+ * +-------------------+------------------------------------------------------------
+ * | 20 bytes          | signature "IBEX SOLVER STREAM " (null-terminated)
+ * | 1 uint32          | format version
+ * | 3 uint32          | n, m, nb_ineq
+ * | 1 uint32          | number of variable names (0 or n)
+ * | null-terminated   | variable names
+ * +-------------------+------------------------------------------------------------
+ * | then a sequence of records, each starting with a uint32 tag:
+ * | 0 (inner)         | box (2n doubles)
+ * | 1 (solution)      | existence box, unicity box, [varset] if 0<m<n
+ * | 2 (boundary)      | box, [varset] if 0<m<n
+ * | 3 (unknown)       | box
+ * | 4 (pending)       | box
+ * | 5 (end)           | solver status (uint32), time (double), number of cells (uint32)
+ * | where varset is the number of parameters followed by their indices (uint32).
+ * +-------------------+------------------------------------------------------------
+ * </pre>
+ */
+class CovSolverStream : public SolverListener {
+public:
+	/**
+	 * \brief Create a stream writing into a file.
+	 *
+	 * The file is created (or truncated).
+	 */
+	CovSolverStream(const char* filename);
+
+	/**
+	 * \brief Close the file.
+	 */
+	~CovSolverStream();
+
+	/**
+	 * \brief Write the last box of \a data.
+	 */
+	bool output(const CovSolverData& data);
+
+	/**
+	 * \brief Write the final status, time and number of cells and flush.
+	 */
+	void end(const CovSolverData& data);
+
+	/**
+	 * \brief Flush the file.
+	 */
+	void flush();
+
+	/**
+	 * \brief Read a stream file.
+	 *
+	 * \return a new CovSolverData (to be deleted by the caller).
+	 */
+	static CovSolverData* read(const char* filename);
+
+	/**
+	 * \brief Maximal number of records written between two flushes.
+	 *
+	 * By default: 100.
+	 */
+	unsigned int flush_period;
+
+	/**
+	 * \brief Maximal time (wall-clock, in seconds) between two flushes.
+	 *
+	 * Checked each time a record is written. By default: 1.
+	 */
+	double flush_time;
+
+	/**
+	 * \brief Stream format version.
+	 */
+	static const unsigned int FORMAT_VERSION;
+
+protected:
+	/**
+	 * \brief Write the header (first call only).
+	 */
+	void write_header(const CovSolverData& data);
+
+	/**
+	 * \brief Flush if needed (see #flush_period and #flush_time).
+	 */
+	void record_written();
+
+	/** The output file. */
+	std::ofstream f;
+
+	/** Whether the header has been written. */
+	bool header;
+
+	/** Number of variables (set with the header). */
+	size_t n;
+
+	/** Number of records written since last flush. */
+	unsigned int nb_unflushed;
+
+	/** Time of the last flush. */
+	std::chrono::steady_clock::time_point last_flush;
+
+private:
+	CovSolverStream(const CovSolverStream&); // forbidden
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_COV_SOLVER_STREAM_H__
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Aug 27, 2012
-// Last Update : Nov 21, 2017
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_DefaultSolver.h"
@@ -13,6 +13,7 @@
 #include "ibex_LinearizerXTaylor.h"
 #include "ibex_SmearFunction.h"
 #include "ibex_CtcHC4.h"
+#include "ibex_CtcMohc.h"
 #include "ibex_CtcAcid.h"
 #include "ibex_CtcNewton.h"
 #include "ibex_CtcPolytopeHull.h"
@@ -67,16 +68,25 @@ System* get_square_eq_sys(Memory& memory, const System& sys) {
 	return x;
 }*/
 
-Ctc* DefaultSolver::ctc (const System& sys, double prec) {
+Ctc* DefaultSolver::ctc (const System& sys, double prec, bool mohc) {
 
 	if (sys.nb_ctr==0) return new CtcIdentity(sys.nb_var);
 
-	Array<Ctc> ctc_list(4); // 4 is the maximum of sub contractors
+	Array<Ctc> ctc_list(5); // 5 is the maximum of sub contractors
 
 	int index=0;
 
 	// first contractor : non incremental hc4
 	ctc_list.set_ref(index++, rec(new CtcHC4 (sys.ctrs,0.01)));
+
+	if (mohc) {
+		// propagation of monotonicity-based contractors
+		// (same as in DefaultOptimizerConfig)
+		Array<Ctc> mohc_list(sys.nb_ctr);
+		for (int i=0; i<sys.nb_ctr; i++)
+			mohc_list.set_ref(i, rec(new CtcMohc(sys.ctrs[i])));
+		ctc_list.set_ref(index++, rec(new CtcPropag(mohc_list,0.01,true)));
+	}
 	// second contractor : acid (hc4)
 	ctc_list.set_ref(index++, rec(new CtcAcid (sys, rec(new CtcHC4 (sys.ctrs,0.1,true)))));
 
@@ -92,18 +102,18 @@ Ctc* DefaultSolver::ctc (const System& sys, double prec) {
 				rec(new CtcPolytopeHull(rec(new LinearizerXTaylor(sys)))),
 				rec(new CtcHC4 (sys.ctrs,0.01)))))));
 	// in case the system is not square, or if no LP solver is
-	// available, there may be only 2 or 3 sub-contractors.
+	// available, or without mohc, there may be only 2, 3 or 4 sub-contractors.
 	ctc_list.resize(index);
 
 	return new CtcCompo (ctc_list);
 }
 
 DefaultSolver::DefaultSolver(const System& sys, double eps_x_min, double eps_x_max,
-		bool dfs, double random_seed) : Solver(sys, rec(ctc(sys,eps_x_min)),
+		bool dfs, double random_seed, bool mohc, bool compact) : Solver(sys, rec(ctc(sys,eps_x_min,mohc)),
 		get_square_eq_sys(*this, sys)!=NULL?
 				(Bsc&) rec(new SmearSumRelative(*get_square_eq_sys(*this, sys), eps_x_min)) :
 				(Bsc&) rec(new RoundRobin(eps_x_min)),
-				rec(dfs? (CellBuffer*) new CellStack() : (CellBuffer*) new CellList()),
+				rec(dfs? (CellBuffer*) new CellStack(compact) : (CellBuffer*) new CellList(compact)),
 				Vector(sys.nb_var,eps_x_min), Vector(sys.nb_var,eps_x_max)),
 		sys(sys) {
 
@@ -113,11 +123,11 @@ DefaultSolver::DefaultSolver(const System& sys, double eps_x_min, double eps_x_m
 
 // Note: we set the precision for Newton to the minimum of the precisions.
 DefaultSolver::DefaultSolver(const System& sys, const Vector& eps_x_min, double eps_x_max,
-		bool dfs, double random_seed) : Solver(sys, rec(ctc(sys,eps_x_min.min())),
+		bool dfs, double random_seed, bool mohc, bool compact) : Solver(sys, rec(ctc(sys,eps_x_min.min(),mohc)),
 		get_square_eq_sys(*this, sys)!=NULL?
 				(Bsc&) rec(new SmearSumRelative(*get_square_eq_sys(*this, sys), eps_x_min)) :
 				(Bsc&) rec(new RoundRobin(eps_x_min)),
-		rec(dfs? (CellBuffer*) new CellStack() : (CellBuffer*) new CellList()),
+		rec(dfs? (CellBuffer*) new CellStack(compact) : (CellBuffer*) new CellList(compact)),
 		eps_x_min, Vector(sys.nb_var,eps_x_max)),
 		sys(sys) {
 
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Sep 27, 2012
-// Last Update : Jul 06, 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_DEFAULT_SOLVER_H__
@@ -33,8 +33,10 @@ public:
 	 * \param eps_x_min - Criterion for stopping bisection (absolute precision)
 	 * \param eps_x_max - Criterion for forcing bisection  (absolute precision)
 	 * \param dfs       - true: depth-first search. false: breadth-first search
+	 * \param mohc      - true: add a propagation of monotonicity-based contractors (see #ibex::CtcMohc)
+	 * \param compact   - true: store the pending boxes in a compact form (see #ibex::CellCompactor)
 	 */
-    DefaultSolver(const System& sys, double eps_x_min=default_eps_x_min, double eps_x_max=default_eps_x_max, bool dfs=true, double random_seed=default_random_seed);
+    DefaultSolver(const System& sys, double eps_x_min=default_eps_x_min, double eps_x_max=default_eps_x_max, bool dfs=true, double random_seed=default_random_seed, bool mohc=false, bool compact=false);
 
     /**
 	 * \brief Create a default solver.
@@ -44,8 +46,10 @@ public:
 	 *                    precisions, one for each variable)
 	 * \param eps_x_max - Criterion for forcing bisection  (absolute precision)
 	 * \param dfs       - true: depth-first search. false: breadth-first search
+	 * \param mohc      - true: add a propagation of monotonicity-based contractors (see #ibex::CtcMohc)
+	 * \param compact   - true: store the pending boxes in a compact form (see #ibex::CellCompactor)
 	 */
-    DefaultSolver(const System& sys, const Vector& eps_x_min, double eps_x_max=default_eps_x_max, bool dfs=true, double random_seed=default_random_seed);
+    DefaultSolver(const System& sys, const Vector& eps_x_min, double eps_x_max=default_eps_x_max, bool dfs=true, double random_seed=default_random_seed, bool mohc=false, bool compact=false);
 
 	/**
 	 * \brief Default minimal width: 1e-6.
@@ -71,9 +75,9 @@ public:
 private:
 
 	/**
-	 * The contractor: hc4 + acid(hc4) + newton (if the system is square) + xnewton
+	 * The contractor: hc4 + mohc (optional) + acid(hc4) + newton (if the system is square) + xnewton
 	 */
-	Ctc* ctc(const System& sys, double prec);
+	Ctc* ctc(const System& sys, double prec, bool mohc);
 
 //	std::vector<CtcXNewton::corner_point>* default_corners ();
 
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 13, 2012
-// Last Update : Oct 01, 2017
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_Solver.h"
@@ -13,8 +13,10 @@
 #include "ibex_NoBisectableVariableException.h"
 #include "ibex_LinearException.h"
 #include "ibex_CovSolverData.h"
+#include "ibex_Threads.h"
 
 #include <cassert>
+#include <exception>
 
 using namespace std;
 
@@ -22,15 +24,202 @@ namespace ibex {
 
 namespace {
 	class EmptyBoxException : Exception { };
+
+	SearchTelemetry::Cause telemetry_cause(CovSolverData::BoxStatus status) {
+		switch (status) {
+		case CovSolverData::SOLUTION: return SearchTelemetry::SOLUTION;
+		case CovSolverData::BOUNDARY: return SearchTelemetry::BOUNDARY;
+		default:                      return SearchTelemetry::UNKNOWN;
+		}
+	}
+}
+
+/*
+ * A cell sent to the certification threads, with the result.
+ */
+struct Solver::Certification {
+	Certification(Cell* cell, bool leaf, int n) : cell(cell), leaf(leaf), rejected(false),
+			status(CovSolverData::UNKNOWN), existence(cell->box), unicity(n), varset(n,BitSet::empty(n)) { }
+
+	Cell* cell;
+
+	/* True if the cell cannot be bisected anymore */
+	bool leaf;
+
+	/* True if the box contains no solution */
+	bool rejected;
+
+	CovSolverData::BoxStatus status;
+	IntervalVector existence;
+	IntervalVector unicity;
+	VarSet varset;
+
+	/* Exception thrown by the certification (if any) */
+	std::exception_ptr error;
+};
+
+/*
+ * Pool of certification threads.
+ *
+ * The cells are submitted by the search thread and the results are
+ * retrieved (in any order) by the search thread. Each thread works
+ * with its own copy of the equalities/inequalities (the evaluation of
+ * a function is not thread-safe).
+ */
+class Solver::Pipeline {
+public:
+	Pipeline(Solver& solver, int nb_threads);
+
+	/* Cancel all the certifications and wait for the threads. */
+	~Pipeline();
+
+	/* Submit a cell (the cell is owned by the pipeline until retrieved) */
+	void submit(Cell* cell, bool leaf);
+
+	/* Retrieve a certified cell, if any (does not block) */
+	bool try_pop(Certification*& cert);
+
+	/* Retrieve a certified cell (blocks). Return false if no cell is submitted. */
+	bool pop(Certification*& cert);
+
+	/*
+	 * Retrieve a submitted cell, certified or not (does not wait for the
+	 * certifications not started yet). Return false if no cell is submitted.
+	 */
+	bool cancel(Certification*& cert);
+
+	/* Number of cells submitted and not retrieved yet */
+	int size() const;
+
+private:
+	void run(int w);
+
+	void certify(int w, Certification& cert);
+
+	Solver& solver;
+
+	int nb_threads;
+
+	/* Copies of the systems (one per thread) */
+	std::vector<System*> eqs;
+	std::vector<System*> ineqs;
+
+	SharedQueue<Certification*> tasks;
+	SharedQueue<Certification*> results;
+
+	int nb_submitted;
+
+#ifndef _WIN32
+	std::vector<std::thread> threads;
+
+	/* Floating-point environment of the search thread */
+	std::fenv_t env;
+#endif
+};
+
+Solver::Pipeline::Pipeline(Solver& solver, int nb_threads) : solver(solver),
+#ifndef _WIN32
+		nb_threads(nb_threads),
+#else
+		nb_threads(0), // certification by the search thread
+#endif
+		nb_submitted(0) {
+
+	for (int w=0; w<(this->nb_threads>0? this->nb_threads : 1); w++) {
+		eqs.push_back(solver.eqs? new System(*solver.eqs, System::COPY) : NULL);
+		ineqs.push_back(solver.ineqs? new System(*solver.ineqs, System::COPY) : NULL);
+	}
+
+#ifndef _WIN32
+	std::fegetenv(&env);
+
+	for (int w=0; w<this->nb_threads; w++)
+		threads.push_back(std::thread(&Pipeline::run, this, w));
+#endif
+}
+
+Solver::Pipeline::~Pipeline() {
+	tasks.close();
+
+#ifndef _WIN32
+	for (std::vector<std::thread>::iterator it=threads.begin(); it!=threads.end(); ++it)
+		it->join();
+#endif
+
+	Certification* cert;
+	while (cancel(cert)) {
+		delete cert->cell;
+		delete cert;
+	}
+
+	for (size_t w=0; w<eqs.size(); w++) {
+		if (eqs[w]) delete eqs[w];
+		if (ineqs[w]) delete ineqs[w];
+	}
+}
+
+void Solver::Pipeline::run(int w) {
+#ifndef _WIN32
+	std::fesetenv(&env);
+#endif
+	Certification* cert;
+	while (tasks.pop(cert)) {
+		certify(w,*cert);
+		results.push(cert);
+	}
+}
+
+void Solver::Pipeline::certify(int w, Certification& cert) {
+	try {
+		cert.status=solver.certify(eqs[w], ineqs[w], cert.cell->box, cert.existence, cert.unicity, cert.varset);
+	} catch(EmptyBoxException&) {
+		cert.rejected=true;
+	} catch(...) {
+		cert.error=std::current_exception();
+	}
+}
+
+void Solver::Pipeline::submit(Cell* cell, bool leaf) {
+	Certification* cert=new Certification(cell, leaf, solver.n);
+	nb_submitted++;
+	if (nb_threads>0)
+		tasks.push(cert);
+	else {
+		certify(0,*cert);
+		results.push(cert);
+	}
+}
+
+bool Solver::Pipeline::try_pop(Certification*& cert) {
+	if (!results.try_pop(cert)) return false;
+	nb_submitted--;
+	return true;
+}
+
+bool Solver::Pipeline::pop(Certification*& cert) {
+	if (nb_submitted==0 || !results.pop(cert)) return false;
+	nb_submitted--;
+	return true;
+}
+
+bool Solver::Pipeline::cancel(Certification*& cert) {
+	if (nb_submitted==0) return false;
+	if (!tasks.try_pop(cert) && !results.pop(cert)) return false;
+	nb_submitted--;
+	return true;
+}
+
+inline int Solver::Pipeline::size() const {
+	return nb_submitted;
 }
 
 Solver::Solver(const System& sys, Ctc& ctc, Bsc& bsc, CellBuffer& buffer,
 		const Vector& eps_x_min, const Vector& eps_x_max) :
 		  ctc(ctc), bsc(bsc), buffer(buffer), eps_x_min(eps_x_min), eps_x_max(eps_x_max),
-		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0),
+		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0), keep_output(true), telemetry(NULL), certif_threads(0),
 		  solve_init_box(sys.box), eqs(NULL), ineqs(NULL),
 		  params(sys.nb_var,BitSet::empty(sys.nb_var),false) /* no forced parameter by default */,
-		  manif(NULL), time(0), old_time(0), nb_cells(0), old_nb_cells(0) {
+		  manif(NULL), time(0), old_time(0), nb_cells(0), old_nb_cells(0), pipeline(NULL) {
 
 	assert(sys.box.size()==ctc.nb_var);
 
@@ -68,6 +257,8 @@ void Solver::set_params(const VarSet& _params) {
 }
 
 Solver::~Solver() {
+	if (pipeline) delete pipeline;
+
 	if (ineqs) {
 		delete ineqs;
 		if (eqs) {
@@ -82,6 +273,8 @@ void Solver::start(const IntervalVector& init_box) {
 
 	buffer.flush();
 
+	start_pipeline();
+
 	if (manif) delete manif;
 
 	manif = new CovSolverData(n, m, nb_ineq, CovManifold::EQU_ONLY, eqs? eqs->var_names() : ineqs->var_names());
@@ -98,6 +291,11 @@ void Solver::start(const IntervalVector& init_box) {
 
 	buffer.push(root);
 
+	if (telemetry) {
+		telemetry->start();
+		telemetry->cell(0);
+	}
+
 	time = 0;
 	manif->set_time(0);
 
@@ -110,6 +308,8 @@ void Solver::start(const IntervalVector& init_box) {
 void Solver::start(const CovSolverData& data) {
 	buffer.flush();
 
+	start_pipeline();
+
 	if (manif) delete manif;
 	manif = new CovSolverData(n, m, nb_ineq);
 
@@ -135,6 +335,9 @@ void Solver::start(const CovSolverData& data) {
 
 		const IntervalVector& box=data.CovManifold::unknown(i);
 
+		// skip boxes that cannot contain a new solution
+		if (eqs && m==n && manif->find_unicity(box)!=-1) continue;
+
 		Cell* cell=new Cell(box);
 
 		// add data required by the cell buffer
@@ -150,6 +353,8 @@ void Solver::start(const CovSolverData& data) {
 
 	}
 
+	if (telemetry) telemetry->start();
+
 	time = 0;
 	manif->set_time(data.time());
 
@@ -164,9 +369,30 @@ void Solver::start(const char* input_paving) {
 	start(data);
 }
 
+void Solver::start_pipeline() {
+	if (pipeline) {
+		delete pipeline; // cancel the certifications of the previous search
+		pipeline=NULL;
+	}
+	if (certif_threads>0)
+		pipeline=new Pipeline(*this, certif_threads);
+}
+
 bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol) {
 
-	while (!buffer.empty()) {
+	while (true) {
+
+		if (pipeline) {
+			Certification* cert;
+			// commit the boxes already certified or, if there is
+			// nothing else to do, wait for a certification.
+			if (pipeline->try_pop(cert) || (buffer.empty() && pipeline->pop(cert))) {
+				if (commit(cert, status, sol)) return true;
+				else continue;
+			}
+		}
+
+		if (buffer.empty()) break;
 
 		if (time_limit >0) {
 			try {
@@ -181,6 +407,8 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 
 		if (trace==2) cout << buffer << endl;
 
+		if (telemetry) telemetry->node(buffer.size());
+
 		Cell* c=buffer.top();
 
 		ContractContext context(c->prop);
@@ -196,12 +424,22 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 
 			if (c->box.is_empty()) throw EmptyBoxException();
 
+			// The box cannot contain a new solution if it is included in the
+			// unicity box of a solution already found.
+			if (eqs && m==n && manif->find_unicity(c->box)!=-1) throw EmptyBoxException();
+
 			// 2nd condition: certification is performed at
 			// each intermediate step only if the system is under constrained
 			if (m==0 || (m<n && !is_too_large(c->box))) {
+				if (pipeline) {
+					// the cell will be bisected (if necessary) once certified
+					pipeline->submit(buffer.pop(), false);
+					continue;
+				}
 				// note: cannot return PENDING status
 				status=check_sol(c->box);
 				if (status!=CovSolverData::UNKNOWN) { // <=> solution or boundary
+					if (telemetry) telemetry->closed(c->depth, telemetry_cause(status));
 					delete buffer.pop();
 					if (sol) *sol=&(*manif)[manif->size()-1];
 					return true;
@@ -216,30 +454,33 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 				pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
 
 				delete buffer.pop();
-				// note: more natural to push first the second, so that
-				// solutions in a 1-dimensional problem come in increasing order
-				buffer.push(new_cells.second);
-				buffer.push(new_cells.first);
-				nb_cells+=2;
-				if (cell_limit >=0 && nb_cells>=cell_limit) {
-					flush();
-					if (sol) *sol=NULL;
-					throw CellLimitException();
-				}
+
+				push_subcells(new_cells, sol);
 			}
 
 			catch (NoBisectableVariableException&) {
+				if (pipeline) {
+					pipeline->submit(buffer.pop(), true);
+					continue;
+				}
 				status=check_sol(c->box);
 				if (status==CovSolverData::UNKNOWN) {
 					if (trace >=1) cout << " [unknown] " << c->box << endl;
 					manif->add_unknown(c->box);
 				}
+				if (telemetry) telemetry->closed(c->depth, telemetry_cause(status));
 				delete buffer.pop();
 				if (sol) *sol=&(*manif)[manif->size()-1];
 				return true;
 			}
 		}
 		catch (EmptyBoxException&) {
+			if (telemetry) {
+				if (c->box.is_empty())
+					telemetry->emptied(c->depth, context.emptied_by? *context.emptied_by : ctc);
+				else // thrown by check_sol(...)
+					telemetry->closed(c->depth, SearchTelemetry::REJECTED);
+			}
 			delete buffer.pop();
 			//impact.remove(v); // note: in case of the root node, we should clear the bitset
 			// instead but since the search is over, the impact is not used anymore.
@@ -253,6 +494,72 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 	return false;
 }
 
+void Solver::push_subcells(const pair<Cell*,Cell*>& new_cells, const IntervalVector** sol) {
+	// note: more natural to push first the second, so that
+	// solutions in a 1-dimensional problem come in increasing order
+	buffer.push(new_cells.second);
+	buffer.push(new_cells.first);
+	nb_cells+=2;
+	if (telemetry) {
+		telemetry->cell(new_cells.first->depth);
+		telemetry->cell(new_cells.second->depth);
+	}
+	if (cell_limit >=0 && nb_cells>=cell_limit) {
+		flush();
+		if (sol) *sol=NULL;
+		throw CellLimitException();
+	}
+}
+
+bool Solver::commit(Certification* cert, CovSolverData::BoxStatus& status, const IntervalVector** sol) {
+	Cell* c=cert->cell;
+
+	if (cert->error) {
+		std::exception_ptr error=cert->error;
+		delete c;
+		delete cert;
+		std::rethrow_exception(error);
+	}
+
+	try {
+		if (cert->rejected) throw EmptyBoxException();
+
+		status=cert->status;
+
+		// note: the solver data may have changed since the cell was
+		// submitted, so the solution may not be new anymore.
+		store_sol(status, cert->existence, cert->unicity, cert->varset);
+
+		if (status==CovSolverData::UNKNOWN && !cert->leaf && !is_too_small(c->box)) {
+			try {
+				pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
+				delete c;
+				delete cert;
+				push_subcells(new_cells, sol);
+				return false;
+			} catch (NoBisectableVariableException&) {
+				// the certification of the leaf would give the same result.
+			}
+		}
+
+		if (status==CovSolverData::UNKNOWN) {
+			if (trace >=1) cout << " [unknown] " << c->box << endl;
+			manif->add_unknown(c->box);
+		}
+		if (telemetry) telemetry->closed(c->depth, telemetry_cause(status));
+		delete c;
+		delete cert;
+		if (sol) *sol=&(*manif)[manif->size()-1];
+		return true;
+	}
+	catch (EmptyBoxException&) {
+		if (telemetry) telemetry->closed(c->depth, SearchTelemetry::REJECTED);
+		delete c;
+		delete cert;
+		return false;
+	}
+}
+
 Solver::Status Solver::solve(const IntervalVector& init_box, bool stop_at_first) {
 	start(init_box);
 	return solve(stop_at_first);
@@ -288,8 +595,12 @@ Solver::Status Solver::solve(bool stop_at_first) {
 			if (status==CovSolverData::UNKNOWN)
 				final_status=NOT_ALL_VALIDATED;
 
-			if (stop_at_first) {
-				if (!buffer.empty()) final_status=USER_BREAK;
+			bool user_stop=!notify();
+
+			if (!keep_output) drop_output();
+
+			if (stop_at_first || user_stop) {
+				if (!buffer.empty() || (pipeline && pipeline->size()>0)) final_status=USER_BREAK;
 				flush();
 				break;
 			}
@@ -309,19 +620,39 @@ Solver::Status Solver::solve(bool stop_at_first) {
 
 	manif->set_nb_cells(manif->nb_cells() + nb_cells);
 
+	for (vector<SolverListener*>::iterator it=listeners.begin(); it!=listeners.end(); it++)
+		(*it)->end(*manif);
+
+	if (telemetry) telemetry->end();
+
 	return final_status;
 }
 
+bool Solver::notify() {
+	bool go_on=true;
+	for (vector<SolverListener*>::iterator it=listeners.begin(); it!=listeners.end(); it++)
+		go_on &= (*it)->output(*manif);
+	return go_on;
+}
+
+void Solver::drop_output() {
+	manif->clear();
+}
+
 bool Solver::check_ineq(const IntervalVector& box) {
-	if (!ineqs)
+	return check_ineq(ineqs, box);
+}
+
+bool Solver::check_ineq(const System* ineq_sys, const IntervalVector& box) const {
+	if (!ineq_sys)
 		return true;
 
 	Interval y,r;
 
 	bool not_inner=false;
 
-	for (int i=0; i<ineqs->nb_ctr; i++) {
-		NumConstraint& c=ineqs->ctrs[i];
+	for (int i=0; i<ineq_sys->nb_ctr; i++) {
+		NumConstraint& c=ineq_sys->ctrs[i];
 		assert(c.f.image_dim()==1);
 		y=c.f.eval(box);
 		r=c.right_hand_side().i();
@@ -339,15 +670,26 @@ bool Solver::check_ineq(const IntervalVector& box) {
 
 CovSolverData::BoxStatus Solver::check_sol(const IntervalVector& box) {
 
-	if (!eqs) {
-		if (check_ineq(box)) {
-			if (trace >=1) cout << " [solution] " << box << endl;
-			manif->add_inner(box);
+	IntervalVector existence(box);
+	IntervalVector unicity(n);
+	VarSet varset(n,BitSet::empty(n));
+
+	CovSolverData::BoxStatus status=certify(eqs, ineqs, box, existence, unicity, varset);
+
+	store_sol(status, existence, unicity, varset);
+
+	return status;
+}
+
+CovSolverData::BoxStatus Solver::certify(const System* eq_sys, const System* ineq_sys, const IntervalVector& box,
+		IntervalVector& existence, IntervalVector& unicity, VarSet& varset) const {
+
+	if (!eq_sys) {
+		if (check_ineq(ineq_sys, box))
 			return CovSolverData::SOLUTION;
-		} else if (is_boundary(box)) {
-			manif->add_boundary(box);
+		else if (is_boundary(eq_sys, ineq_sys, box))
 			return CovSolverData::BOUNDARY;
-		} else
+		else
 			return CovSolverData::UNKNOWN;
 	} else {
 
@@ -356,26 +698,25 @@ CovSolverData::BoxStatus Solver::check_sol(const IntervalVector& box) {
 			return CovSolverData::UNKNOWN;
 		}
 
-		IntervalVector existence(box);
-		IntervalVector unicity(n);
-		VarSet varset(n,BitSet::empty(n));
-
 		if (m<n) {
 			// ====== under-constrained =========
 			try {
 
-				varset=get_newton_vars(eqs->f_ctrs,box.mid(),params);
+				varset=get_newton_vars(eq_sys->f_ctrs,box.mid(),params);
 
-				if (!inflating_newton(eqs->f_ctrs, varset, box, existence, unicity)) {
+				if (!inflating_newton(eq_sys->f_ctrs, varset, box, existence, unicity)) {
+					existence=box;
 					return CovSolverData::UNKNOWN;
 				}
 
 			} catch(SingularMatrixException& e) {
+				existence=box;
 				return CovSolverData::UNKNOWN;
 			}
 		} else {
 			// ====== well-constrained =========
-			if (!inflating_newton(eqs->f_ctrs, box.mid(), existence, unicity)) {
+			if (!inflating_newton(eq_sys->f_ctrs, box.mid(), existence, unicity)) {
+				existence=box;
 				return CovSolverData::UNKNOWN;
 			}
 		}
@@ -390,39 +731,55 @@ CovSolverData::BoxStatus Solver::check_sol(const IntervalVector& box) {
 
 		bool solution = existence.is_subset(solve_init_box);
 
-		solution &= check_ineq(existence);
-
-		if (eqs && n==m) {
-			// Check if the solution is new, that is, that the solution is not included in the unicity
-			// box of a previously found solution. For efficiency reason, this test is not performed in
-			// the case of under-constrained systems (m<n).
-
-			// TODO
-			//		for (vector<QualifiedBox>::iterator it=manif->inner.begin(); it!=manif->inner.end(); it++) {
-			//			if (it->unicity().is_superset(existence)) {
-			//				if (unicity) delete unicity;
-			//				if (varset) delete varset;
-			//				throw EmptyBoxException();
-			//			}
-			//		}
-		}
+		solution &= check_ineq(ineq_sys, existence);
 
-		if (solution) {
-			if (trace >=1) cout << " [solution] " << existence << endl;
-			manif->add_solution(existence, unicity, varset);
+		if (solution)
 			return CovSolverData::SOLUTION;
-		} else {
-			if (is_boundary(existence)) {
-				if (trace >=1) cout << " [boundary] " << existence << endl;
-				manif->add_boundary(existence, varset);
-				return CovSolverData::BOUNDARY;
-			} else
-				return CovSolverData::UNKNOWN;
+		else if (is_boundary(eq_sys, ineq_sys, existence))
+			return CovSolverData::BOUNDARY;
+		else
+			return CovSolverData::UNKNOWN;
+	}
+}
+
+void Solver::store_sol(CovSolverData::BoxStatus status, const IntervalVector& existence,
+		const IntervalVector& unicity, const VarSet& varset) {
+
+	if (eqs && n==m) {
+		// Check if the solution is new, that is, that the solution is not included in the unicity
+		// box of a previously found solution. For efficiency reason, this test is not performed in
+		// the case of under-constrained systems (m<n).
+		// Note: if the certification has failed, the existence box is the input box.
+		if (manif->find_unicity(existence)!=-1)
+			throw EmptyBoxException();
+	}
+
+	switch (status) {
+	case CovSolverData::SOLUTION:
+		if (trace >=1) cout << " [solution] " << existence << endl;
+		if (!eqs)
+			manif->add_inner(existence);
+		else
+			manif->add_solution(existence, unicity, varset);
+		break;
+	case CovSolverData::BOUNDARY:
+		if (!eqs)
+			manif->add_boundary(existence);
+		else {
+			if (trace >=1) cout << " [boundary] " << existence << endl;
+			manif->add_boundary(existence, varset);
 		}
+		break;
+	default:
+		break;
 	}
 }
 
 bool Solver::is_boundary(const IntervalVector& box) {
+	return is_boundary(eqs, ineqs, box);
+}
+
+bool Solver::is_boundary(const System* eq_sys, const System* ineq_sys, const IntervalVector& box) const {
 
 	switch (boundary_test) {
 	case ALL_TRUE : return true;
@@ -439,7 +796,7 @@ bool Solver::is_boundary(const IntervalVector& box) {
 		}
 
 		// get active inequalities
-		BitSet ineq_active=ineqs? ineqs->active_ctrs(box) : BitSet::empty(n);
+		BitSet ineq_active=ineq_sys? ineq_sys->active_ctrs(box) : BitSet::empty(n);
 
 		int size = bound.size() + m + ineq_active.size();
 
@@ -452,11 +809,11 @@ bool Solver::is_boundary(const IntervalVector& box) {
 			J[i][v]=1.0;
 		}
 		if (m>0) {
-			J.put(i,0,eqs->f_ctrs.jacobian(box));
+			J.put(i,0,eq_sys->f_ctrs.jacobian(box));
 			i+=m;
 		}
-		if (ineqs!=NULL) {
-			J.put(i,0,ineqs->f_ctrs.jacobian(box,ineq_active));
+		if (ineq_sys!=NULL) {
+			J.put(i,0,ineq_sys->f_ctrs.jacobian(box,ineq_active));
 		}
 		return full_rank(J);
 	}
@@ -480,10 +837,22 @@ bool Solver::is_too_large(const IntervalVector& box) {
 }
 
 void Solver::flush() {
+	if (pipeline) {
+		// the submitted cells are pending (even if already certified)
+		Certification* cert;
+		while (pipeline->cancel(cert)) {
+			if (trace >=1) cout << " [pending] " << cert->cell->box << endl;
+			manif->add_pending(cert->cell->box);
+			notify();
+			delete cert->cell;
+			delete cert;
+		}
+	}
 	while (!buffer.empty()) {
 		Cell* cell=buffer.top();
 		if (trace >=1) cout << " [pending] " << cell->box << endl;
 		manif->add_pending(cell->box);
+		notify();
 		delete buffer.pop();
 	}
 }
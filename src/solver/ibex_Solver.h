@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : May 13, 2012
-// Last Update : Oct 01, 2017
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_SOLVER_H__
@@ -20,6 +20,8 @@
 #include "ibex_Exception.h"
 #include "ibex_Linear.h"
 #include "ibex_CovSolverData.h"
+#include "ibex_SolverListener.h"
+#include "ibex_SearchTelemetry.h"
 
 #include <vector>
 
@@ -216,6 +218,18 @@ public:
 	 */
 	void flush();
 
+	/**
+	 * \brief Add a listener.
+	 *
+	 * The listener is notified each time solve(...) finds a new box and
+	 * each time a pending box is added (see #flush()). It is also notified
+	 * at the end of solve(...). Only the boxes found by the current search
+	 * are notified (not the ones of the input paving).
+	 *
+	 * The listener is not owned by the solver.
+	 */
+	void add_listener(SolverListener& listener);
+
 	/**
 	 * \brief The contractor.
 	 *
@@ -279,6 +293,52 @@ public:
 	 */
 	int trace;
 
+	/**
+	 * \brief Keep the output boxes.
+	 *
+	 * If false, the solution, boundary and unknown boxes found by solve(...) are
+	 * dropped from the solver data (see #get_data()) once they have been notified
+	 * to the listeners (see #add_listener(...)). This bounds the memory of
+	 * the solver when the output is streamed (see #CovSolverStream).
+	 * Pending boxes are always kept.
+	 *
+	 * Note: the numbers of boxes displayed by report() only count the kept boxes.
+	 * Note: the unicity boxes of dropped solutions (including the solutions
+	 * of the input paving, in a warm start) are still used to discard duplicate
+	 * solutions (see #CovManifold::find_unicity(...)); so the memory grows with
+	 * the number of solutions.
+	 *
+	 * By default: true.
+	 */
+	bool keep_output;
+
+	/**
+	 * \brief Search-tree statistics (NULL if none).
+	 *
+	 * Not owned by the solver.
+	 *
+	 * By default: NULL.
+	 */
+	SearchTelemetry* telemetry;
+
+	/**
+	 * \brief Number of certification threads.
+	 *
+	 * If positive, the candidate boxes (see #check_sol(...)) are certified
+	 * by a pool of threads while the search thread keeps on contracting and
+	 * bisecting the other cells of the buffer. Each thread works with its own
+	 * copy of the system. The certified boxes are then added in the solver data
+	 * by the search thread, and a box that could not be certified at an
+	 * intermediate step is bisected as usual.
+	 *
+	 * The same boxes are found as with 0 but not necessarily in the same order.
+	 * The value is taken into account at the next call to start(...) or solve(...).
+	 * On platforms without thread support, the boxes are certified by the
+	 * search thread.
+	 *
+	 * By default: 0 (the search thread certifies the boxes itself).
+	 */
+	int certif_threads;
 
 protected:
 	/**
@@ -287,6 +347,18 @@ protected:
 	 */
 	Status solve(bool stop_at_first);
 
+	/**
+	 * \brief Notify the listeners of the last box added in the solver data.
+	 *
+	 * \return false if one listener requires to stop.
+	 */
+	bool notify();
+
+	/**
+	 * \brief Remove the boxes of the solver data (see #keep_output).
+	 */
+	void drop_output();
+
 	/*
 	 * \brief Return a new "output box" that potentially contains solutions.
 	 * \throw An exception otherwise (no solution inside).
@@ -300,12 +372,40 @@ protected:
 	 */
 	CovSolverData::BoxStatus check_sol(const IntervalVector& box);
 
+	/*
+	 * \brief Certification part of check_sol(...).
+	 *
+	 * Calculates the status and the existence/unicity boxes without
+	 * modifying the solver data, with the given systems. Can be called
+	 * by several threads in parallel, provided that they work on
+	 * different copies of the systems.
+	 *
+	 * \throw EmptyBoxException if the box contains no solution.
+	 */
+	CovSolverData::BoxStatus certify(const System* eq_sys, const System* ineq_sys, const IntervalVector& box,
+			IntervalVector& existence, IntervalVector& unicity, VarSet& varset) const;
+
+	/*
+	 * \brief Add a box certified by certify(...) in the solver data.
+	 *
+	 * Nothing is added if the status is UNKNOWN.
+	 *
+	 * \throw EmptyBoxException if the box cannot contain a new solution.
+	 */
+	void store_sol(CovSolverData::BoxStatus status, const IntervalVector& existence,
+			const IntervalVector& unicity, const VarSet& varset);
+
 	/**
 	 * \brief Check if the box is "BOUNDARY"
 	 * \see SolverOutputBox.
 	 */
 	bool is_boundary(const IntervalVector& box);
 
+	/**
+	 * \brief Check if the box is "BOUNDARY" (with the given systems).
+	 */
+	bool is_boundary(const System* eq_sys, const System* ineq_sys, const IntervalVector& box) const;
+
 	/**
 	 * \brief True if width(box)>eps_x_max.
 	 */
@@ -318,6 +418,15 @@ protected:
 
 	bool check_ineq(const IntervalVector& box);
 
+	bool check_ineq(const System* ineq_sys, const IntervalVector& box) const;
+
+	/**
+	 * \brief Push the two subcells of a bisected cell in the buffer.
+	 *
+	 * \throw CellLimitException if the number of cells exceeds the limit.
+	 */
+	void push_subcells(const std::pair<Cell*,Cell*>& new_cells, const IntervalVector** sol);
+
 	/**
 	 * \brief Check if time is out.
 	 */
@@ -384,6 +493,33 @@ protected:
 	 * \brief Number of cells of the previous call.
 	 */
 	unsigned int old_nb_cells;
+
+	/**
+	 * \brief Listeners.
+	 */
+	std::vector<SolverListener*> listeners;
+
+private:
+	class Pipeline;
+	struct Certification;
+
+	/*
+	 * Create the certification threads (if any) for a new search.
+	 */
+	void start_pipeline();
+
+	/*
+	 * Commit a box certified by the pipeline (adds the box in the
+	 * solver data, or bisects the cell). Takes ownership of cert.
+	 *
+	 * \return true if a new covering box is found (see next(...)).
+	 */
+	bool commit(Certification* cert, CovSolverData::BoxStatus& status, const IntervalVector** sol);
+
+	/*
+	 * Certification threads (NULL if none).
+	 */
+	Pipeline* pipeline;
 };
 
 /*============================================ inline implementation ============================================ */
@@ -397,6 +533,10 @@ inline const CovSolverData& Solver::get_data() const {
 	return *manif;
 }
 
+inline void Solver::add_listener(SolverListener& listener) {
+	listeners.push_back(&listener);
+}
+
 inline double Solver::get_time() const {
 	return get_data().time();
 }
@@ -0,0 +1,61 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SolverListener.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_SOLVER_LISTENER_H__
+#define __IBEX_SOLVER_LISTENER_H__
+
+#include "ibex_CovSolverData.h"
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Solver listener.
+ *
+ * A listener is notified by the solver (see Solver::add_listener(...)) each time
+ * a new box (solution, boundary, unknown or pending) is added to the solver
+ * data, that is, while the search is still running.
+ *
+ * \see #CovSolverStream.
+ */
+class SolverListener {
+public:
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~SolverListener() { }
+
+	/**
+	 * \brief Called each time a new box is found.
+	 *
+	 * The new box is the last box of \a data, i.e., data[data.size()-1]
+	 * and its status is data.status(data.size()-1). If the status is
+	 * SOLUTION, the box is also the last solution (or the last inner
+	 * box if the system has no equality).
+	 *
+	 * \return false to interrupt the search (the solver then
+	 *         returns USER_BREAK). The return value is ignored
+	 *         for pending boxes.
+	 */
+	virtual bool output(const CovSolverData& data)=0;
+
+	/**
+	 * \brief Called at the end of the search.
+	 *
+	 * The solver status, the time and the number of cells of \a data are set.
+	 *
+	 * Does nothing by default.
+	 */
+	virtual void end(const CovSolverData& data) { }
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_SOLVER_LISTENER_H__
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 01, 2018
-// Last Update : Jul 09, 2018
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_BoxProperties.h"
@@ -82,6 +82,20 @@ void BoxProperties::add(Bxp* prop) {
 	_dep_up2date=false;
 }
 
+Bxp* BoxProperties::operator[](long id) {
+	Bxp* p=(Bxp*) ((const BoxProperties*) this)->operator[](id);
+
+	if (p && p->nb_refs>1) {
+		if (!_dep_up2date) topo_sort();
+		int i=0;
+		while (dep[i]!=p) i++;
+		p=unshare(i);
+		// the copy may have to be re-initialized
+		p->update(BoxEvent(box,BoxEvent::CONTRACT), *this);
+	}
+	return p;
+}
+
 const Bxp* BoxProperties::operator[](long id) const {
 	try {
 		return &map[id];
@@ -90,6 +104,25 @@ const Bxp* BoxProperties::operator[](long id) const {
 	}
 }
 
+bool BoxProperties::empty() const {
+	return map.begin()==map.end();
+}
+
+void BoxProperties::compact() {
+
+	if (!_dep_up2date) topo_sort();
+
+	for (size_t i=0; i<dep.size(); i++) {
+		Bxp* p=dep[i];
+		Bxp* q=p->light_copy(box, *this);
+		if (q) {
+			map.map[p->id]=q;
+			dep[i]=q;
+			release(p);
+		}
+	}
+}
+
 void BoxProperties::update(const BoxEvent& e) {
 
 	if (!_dep_up2date) topo_sort();
@@ -98,9 +131,37 @@ void BoxProperties::update(const BoxEvent& e) {
 	// We could also create each time a new property map with
 	// the required properties only. But we have shared
 	// memory to avoid copies -> not very safe
-	for (vector<Bxp*>::iterator it=dep.begin(); it!=dep.end(); ++it) {
-		(*it)->update(e,*this);
+	for (size_t i=0; i<dep.size(); i++) {
+		if (dep[i]->nb_refs>1) {
+			if (dep[i]->unchanged(e,*this)) continue;
+			unshare(i); // updated right after
+		}
+		dep[i]->update(e,*this);
+	}
+}
+
+void BoxProperties::inherit(Bxp* p, const BoxEvent& e) {
+	if (p->unchanged(e,*this)) {
+		p->nb_refs++;
+	} else {
+		p = p->copy(e.box, *this);
+		p->update(e, *this);
 	}
+	add(p);
+	dep.push_back(p);
+}
+
+Bxp* BoxProperties::unshare(int i) {
+	Bxp* p=dep[i];
+	Bxp* q=p->copy(box, *this);
+	map.map[p->id]=q;
+	dep[i]=q;
+	release(p);
+	return q;
+}
+
+void BoxProperties::release(Bxp* p) {
+	if (--p->nb_refs==0) delete p;
 }
 
 void BoxProperties::propagate(const Bxp& p) {
@@ -119,18 +180,14 @@ void BoxProperties::update_bisect(const Bisection& b, BoxProperties& lprop, BoxP
 
 	if (!_dep_up2date) topo_sort();
 
-	// Duplicate properties respecting dependencies
-	for (vector<Bxp*>::iterator it=dep.begin(); it!=dep.end(); it++) {
-		Bxp* p1 = (*it)->copy(b.left, lprop);
-		p1->update(BoxEvent(b.left,BoxEvent::CONTRACT,BitSet::singleton(b.box.size(), b.pt.var)), lprop);
-
-		Bxp* p2 = (*it)->copy(b.right, rprop);
-		p2->update(BoxEvent(b.right,BoxEvent::CONTRACT,BitSet::singleton(b.box.size(), b.pt.var)), rprop);
+	BitSet impact=BitSet::singleton(b.box.size(), b.pt.var);
+	BoxEvent left(b.left,BoxEvent::CONTRACT,impact);
+	BoxEvent right(b.right,BoxEvent::CONTRACT,impact);
 
-		lprop.add(p1);
-		lprop.dep.push_back(p1);
-		rprop.add(p2);
-		rprop.dep.push_back(p2);
+	// Share or duplicate properties respecting dependencies
+	for (vector<Bxp*>::iterator it=dep.begin(); it!=dep.end(); it++) {
+		lprop.inherit(*it, left);
+		rprop.inherit(*it, right);
 	}
 
 	lprop._dep_up2date = true; // avoid a call to topo_sort()
@@ -149,11 +206,20 @@ BoxProperties::BoxProperties(const IntervalVector& box, const BoxProperties& p)
 
 	if (!p._dep_up2date) p.topo_sort();
 
-	// Duplicate properties respecting dependencies
+	BoxEvent e(box,BoxEvent::CONTRACT);
+
+	// Share or duplicate properties respecting dependencies
 	for (vector<Bxp*>::iterator it=p.dep.begin(); it!=p.dep.end(); it++) {
-		Bxp* bxp=(*it)->copy(box, *this);
-		add(bxp);
-		dep.push_back(bxp);
+		if ((*it)->unchanged(e,*this)) {
+			(*it)->nb_refs++;
+			add(*it);
+			dep.push_back(*it);
+		} else {
+			Bxp* bxp=(*it)->copy(box, *this);
+			add(bxp);
+			dep.push_back(bxp);
+			bxp->update(e, *this);
+		}
 	}
 
 	_dep_up2date = true; // avoid a call to topo_sort()
@@ -161,7 +227,7 @@ BoxProperties::BoxProperties(const IntervalVector& box, const BoxProperties& p)
 
 BoxProperties::~BoxProperties() {
 	for (Map<long,Bxp>::iterator it=map.begin(); it!=map.end(); it++)
-		delete it->second;
+		release(it->second);
 }
 
 ostream& operator<<(ostream& os, const BoxProperties& p) {
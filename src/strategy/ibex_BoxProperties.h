@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 01, 2018
-// Last Update : Jul 09, 2018
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_BOX_PROPERTIES_H__
@@ -26,6 +26,11 @@ namespace ibex {
  *
  * This class allows to store a set of potentially inter-dependent
  * box properties, in a map structure.
+ *
+ * Property values are shared between maps (copy-on-write) when they
+ * are not modified by the box event that separates them (see Bxp::unchanged(...)).
+ * A shared value is read-only: it is replaced by a private copy as soon as it
+ * has to be updated or is accessed through the non-const operator[].
  */
 class BoxProperties {
 public:
@@ -42,7 +47,9 @@ public:
 	/**
 	 * \brief Copy constructor.
 	 *
-	 * Duplicate all properties for the new box.
+	 * Duplicate all properties for the new box
+	 * (values that are unchanged are shared, the other
+	 * ones are copied and updated).
 	 */
 	BoxProperties(const IntervalVector& box, const BoxProperties&);
 
@@ -79,11 +86,25 @@ public:
 	/**
 	 * \brief Return the property of identifier \a id.
 	 *
+	 * If the value is shared with other maps, it is replaced
+	 * by a private copy, so that it can be modified.
+	 *
 	 * \return NULL if this property does not exist in the map.
 	 */
-	Bxp* operator[](long id) {
-		return (Bxp*) ((const BoxProperties*) this)->operator[](id);
-	}
+	Bxp* operator[](long id);
+
+	/**
+	 * \brief True if there is no property.
+	 */
+	bool empty() const;
+
+	/**
+	 * \brief Replace the values by their light copies, if any.
+	 *
+	 * Called for a pending box stored in a compact form.
+	 * See Bxp::light_copy(...).
+	 */
+	void compact();
 
 	/**
 	 * \brief Update all the properties after box modification.
@@ -135,6 +156,24 @@ protected:
 	 */
 	void topo_sort() const;
 
+	/*
+	 * Add a value created for this box after the event "e" from
+	 * the value "p" of another map: "p" is either shared or copied
+	 * and updated.
+	 */
+	void inherit(Bxp* p, const BoxEvent& e);
+
+	/*
+	 * Replace the ith value of #dep, which is shared, by a private copy
+	 * and return the copy. The copy is not updated.
+	 */
+	Bxp* unshare(int i);
+
+	/*
+	 * Remove a reference to a value (deleted if not shared anymore).
+	 */
+	static void release(Bxp* p);
+
 	/*
 	 * The map that allows to retrieve a property by its id.
 	 */
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 01, 2018
-// Last update : Jul 09, 2018
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_IntervalVector.h"
@@ -14,6 +14,7 @@
 #include "ibex_BoxEvent.h"
 
 #include <sstream>
+#include <atomic>
 
 #ifndef __IBEX_BOX_PROPERTY_H__
 #define __IBEX_BOX_PROPERTY_H__
@@ -45,6 +46,10 @@ class BoxProperties;
  *
  * At each node of the tree, the value of a property required by an operator is retrieved by its
  * identifier.
+ *
+ * A property value that is not modified by a box event (see unchanged(...)) is not copied but
+ * shared by the parent and child nodes. A private copy is only created when one of the nodes
+ * requires a modification of the value (copy-on-write). See #ibex::BoxProperties.
  */
 class Bxp {
 public:
@@ -56,6 +61,10 @@ public:
 	 */
 	Bxp(long id);
 
+	/**
+	 * \brief Copy constructor (the copy is not shared).
+	 */
+	Bxp(const Bxp& p);
 
 	/**
 	 * \brief Create a copy.
@@ -74,6 +83,34 @@ public:
 	 */
 	virtual void update(const BoxEvent& event, const BoxProperties& prop)=0;
 
+	/**
+	 * \brief Whether the property value is unchanged by a box modification.
+	 *
+	 * Must return true only if update(event,prop) would leave the value
+	 * as it is. In this case, the same value can be shared by the boxes before and after
+	 * the event (e.g., a box and its sub-boxes at bisection) instead of being copied.
+	 *
+	 * By default: false (the value is always copied).
+	 *
+	 * \param event - the box modification
+	 * \param prop  - the properties of the box after modification (dependencies are up to date)
+	 */
+	virtual bool unchanged(const BoxEvent& event, const BoxProperties& prop) const;
+
+	/**
+	 * \brief Create a light copy for a pending box.
+	 *
+	 * Called when a box is stored in a compact form (see #ibex::CompactCell).
+	 * A value that only holds data the operators can recalculate (a cache,
+	 * a hint) may return an equivalent value without these data, to save
+	 * memory.
+	 *
+	 * By default: NULL (the value is kept).
+	 *
+	 * \param prop - the properties (dependencies are up to date)
+	 */
+	virtual Bxp* light_copy(const IntervalVector& box, const BoxProperties& prop) const;
+
 	/**
 	 * \brief To string
 	 *
@@ -98,11 +135,33 @@ public:
 	 * by this property.
 	 */
 	std::vector<long> dependencies;
+
+private:
+	friend class BoxProperties;
+
+	/**
+	 * Number of property maps sharing this value.
+	 *
+	 * Atomic because maps sharing a value may be used
+	 * by different threads (see Lookahead).
+	 */
+	std::atomic<unsigned int> nb_refs;
 };
 
 /*================================== inline implementations ========================================*/
 
-inline Bxp::Bxp(long id) : id(id) {
+inline Bxp::Bxp(long id) : id(id), nb_refs(1) {
+}
+
+inline Bxp::Bxp(const Bxp& p) : id(p.id), dependencies(p.dependencies), nb_refs(1) {
+}
+
+inline bool Bxp::unchanged(const BoxEvent& event, const BoxProperties& prop) const {
+	return false;
+}
+
+inline Bxp* Bxp::light_copy(const IntervalVector& box, const BoxProperties& prop) const {
+	return NULL;
 }
 
 inline Bxp::~Bxp() {
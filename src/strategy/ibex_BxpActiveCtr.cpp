@@ -5,6 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jul 05, 2018
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_BxpActiveCtr.h"
@@ -19,7 +20,7 @@ Map<long,long,false>& BxpActiveCtr::ids() {
 	return _ids;
 }
 
-void BxpActiveCtr::check() {
+void BxpActiveCtr::check(const IntervalVector& box) {
 	if (!up2date) {
 		assert(_active);
 		// TODO: if the impact contains no variable involved in the constraint
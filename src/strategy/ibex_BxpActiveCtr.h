@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jun 18, 2018
-// Last update : Jul 09, 2018
+// Last update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_BXP_ACTIVE_CTR_H__
@@ -31,10 +31,13 @@ public:
 	/**
 	 * \brief Build the property value, associated to a constraint.
 	 *
+	 * The value does not refer to any box so that it can be
+	 * shared by several boxes (see #unchanged(...)).
+	 *
 	 * \param ctr    - The constraint
 	 * \param active - Default activity value
 	 */
-	BxpActiveCtr(const IntervalVector& box, const NumConstraint& ctr, bool active=true, bool up2date=false);
+	BxpActiveCtr(const NumConstraint& ctr, bool active=true, bool up2date=false);
 
 	/**
 	 * \brief Copy the property
@@ -50,6 +53,14 @@ public:
 	 */
 	virtual void update(const BoxEvent& event, const BoxProperties& prop);
 
+	/**
+	 * \brief True if the flags are unchanged by the box modification.
+	 *
+	 * This is the case for a contraction if the constraint is inactive or
+	 * not checked yet.
+	 */
+	virtual bool unchanged(const BoxEvent& event, const BoxProperties& prop) const;
+
 	/**
 	 * \brief To string
 	 *
@@ -61,8 +72,11 @@ public:
 	 * \brief Check if the constraint is inactive
 	 *
 	 * Force function evaluation.
+	 *
+	 * \param box - the box the property is attached to
+	 *              (the box of the owning BoxProperties).
 	 */
-	void check();
+	void check(const IntervalVector& box);
 
 	/**
 	 * \brief The associated constraint.
@@ -89,7 +103,6 @@ public:
 	static long get_id(const NumConstraint&);
 
 protected:
-	const IntervalVector& box;
 	bool _active;
 	bool up2date;
 	static Map<long,long,false>& ids();
@@ -97,13 +110,17 @@ protected:
 
 /*================================== inline implementations ========================================*/
 
-inline BxpActiveCtr::BxpActiveCtr(const IntervalVector& box, const NumConstraint& ctr, bool active, bool up2date) :
-		Bxp(get_id(ctr)), ctr(ctr), box(box), _active(active), up2date(up2date) {
+inline BxpActiveCtr::BxpActiveCtr(const NumConstraint& ctr, bool active, bool up2date) :
+		Bxp(get_id(ctr)), ctr(ctr), _active(active), up2date(up2date) {
 
 }
 
 inline BxpActiveCtr* BxpActiveCtr::copy(const IntervalVector& box, const BoxProperties& prop) const {
-	return new BxpActiveCtr(box, ctr, _active, up2date);
+	return new BxpActiveCtr(ctr, _active, up2date);
+}
+
+inline bool BxpActiveCtr::unchanged(const BoxEvent& e, const BoxProperties& prop) const {
+	return e.type==BoxEvent::CONTRACT && (!_active || !up2date);
 }
 
 inline bool BxpActiveCtr::active() const {
@@ -38,7 +38,7 @@ BxpActiveCtrs* BxpActiveCtrs::copy(const IntervalVector& box, const BoxPropertie
 
 void BxpActiveCtrs::check(BoxProperties& prop) {
 	for (vector<long>::iterator it=dependencies.begin(); it!=dependencies.end(); ++it) {
-		((BxpActiveCtr*) prop[*it])->check();
+		((BxpActiveCtr*) prop[*it])->check(prop.box);
 	}
 	_update(prop);
 }
@@ -47,6 +47,19 @@ void BxpActiveCtrs::update(const BoxEvent& e, const BoxProperties& prop) {
 	_update(prop);
 }
 
+bool BxpActiveCtrs::unchanged(const BoxEvent& e, const BoxProperties& prop) const {
+	if (ineq.empty()) return true;
+
+	BitSet::const_iterator c=ineq.begin(); // constraint number
+
+	for (vector<long>::const_iterator it=dependencies.begin(); it!=dependencies.end(); ++it) {
+		const BxpActiveCtr* p=(const BxpActiveCtr*) prop[*it];
+		if (!p || p->active()!=active[c]) return false;
+		++c;
+	}
+	return true;
+}
+
 void BxpActiveCtrs::_update(const BoxProperties& prop) {
 	if (ineq.empty()) return;
 
@@ -46,6 +46,11 @@ public:
 	 */
 	virtual void update(const BoxEvent& event, const BoxProperties& prop);
 
+	/**
+	 * \brief True if the activity of all the constraints is unchanged.
+	 */
+	virtual bool unchanged(const BoxEvent& event, const BoxProperties& prop) const;
+
 	/**
 	 * \brief To string
 	 *
@@ -44,24 +44,29 @@ BxpLinearRelaxArgMin* BxpLinearRelaxArgMin::copy(const IntervalVector& box, cons
 	return new BxpLinearRelaxArgMin(sys);
 }
 
-void BxpLinearRelaxArgMin::update(const BoxEvent& event, const BoxProperties& prop) {
-	if (inside) {
-		int n=_argmin.size();
-		// box gotten from extended system
-		if (event.box.size() > n) {
-			assert(event.box.size()==n+1);
-			IntervalVector tmpbox(n);
-			((ExtendedSystem&) sys).read_ext_box(event.box,tmpbox);
-			if (!tmpbox.contains(_argmin))
-				inside=false;
-		} else {
-			assert(event.box.size()==n);
-			if (!event.box.contains(_argmin))
-				inside=false;
-		}
+bool BxpLinearRelaxArgMin::contains_argmin(const IntervalVector& box) const {
+	int n=_argmin.size();
+	// box gotten from extended system
+	if (box.size() > n) {
+		assert(box.size()==n+1);
+		IntervalVector tmpbox(n);
+		((ExtendedSystem&) sys).read_ext_box(box,tmpbox);
+		return tmpbox.contains(_argmin);
+	} else {
+		assert(box.size()==n);
+		return box.contains(_argmin);
 	}
 }
 
+void BxpLinearRelaxArgMin::update(const BoxEvent& event, const BoxProperties& prop) {
+	if (inside && !contains_argmin(event.box))
+		inside=false;
+}
+
+bool BxpLinearRelaxArgMin::unchanged(const BoxEvent& event, const BoxProperties& prop) const {
+	return !inside || contains_argmin(event.box);
+}
+
 string BxpLinearRelaxArgMin::to_string() const {
 	stringstream ss;
 	ss << '[' << id << "] BxpLinearRelaxArgmin Sys n°";
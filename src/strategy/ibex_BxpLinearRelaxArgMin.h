@@ -43,6 +43,11 @@ public:
 	 */
 	virtual void update(const BoxEvent& event, const BoxProperties& prop);
 
+	/**
+	 * \brief True if the argmin (if any) is still inside the box.
+	 */
+	virtual bool unchanged(const BoxEvent& event, const BoxProperties& prop) const;
+
 	/**
 	 * \brief To string
 	 */
@@ -71,6 +76,9 @@ public:
 protected:
 	friend class CtcLinearRelax;
 
+	/* Whether the argmin belongs to a box (possibly extended) */
+	bool contains_argmin(const IntervalVector& box) const;
+
 	Vector _argmin;
 	bool inside;
 	static Map<long,long,false>& ids();
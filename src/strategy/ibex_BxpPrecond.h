@@ -0,0 +1,112 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpPrecond.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_BXP_PRECOND_H__
+#define __IBEX_BXP_PRECOND_H__
+
+#include "ibex_Bxp.h"
+#include "ibex_Matrix.h"
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Last preconditioning matrix of a linear system.
+ *
+ * The interval Newton operator preconditions the linear system
+ * J*y=F(mid) by the inverse C of the midpoint of the Jacobian
+ * (O(n^3) operations). The Jacobian matrices of a box and its
+ * sub-boxes are often close to each other, so that the matrix
+ * C calculated for a box may remain effective in all its subtree.
+ *
+ * This property stores the last matrix C calculated for a box and
+ * makes it inherited by the sub-boxes (the matrix is shared until
+ * it is recalculated). See #ibex::precond(IntervalMatrix&, IntervalVector&, Matrix&, bool, double).
+ *
+ * The matrix is only allocated when calculated and is dropped
+ * from pending boxes stored in a compact form (see #light_copy(...)).
+ */
+class BxpPrecond : public Bxp {
+public:
+	/**
+	 * \brief Build the property (no matrix yet).
+	 *
+	 * \param id - the property identifier (typically, one per operator).
+	 * \param n  - the dimension of the linear system.
+	 */
+	BxpPrecond(long id, int n);
+
+	/**
+	 * \brief Copy the property.
+	 */
+	virtual BxpPrecond* copy(const IntervalVector& box, const BoxProperties& prop) const;
+
+	/**
+	 * \brief A value without matrix (NULL if there is no matrix).
+	 */
+	virtual BxpPrecond* light_copy(const IntervalVector& box, const BoxProperties& prop) const;
+
+	/**
+	 * \brief Update the property after box modification (nothing to do).
+	 */
+	virtual void update(const BoxEvent& event, const BoxProperties& prop);
+
+	/**
+	 * \brief Always true.
+	 *
+	 * The matrix is only a hint, not related to the box. So it
+	 * can be shared with sub-boxes.
+	 */
+	virtual bool unchanged(const BoxEvent& event, const BoxProperties& prop) const;
+
+	/**
+	 * \brief The dimension of the linear system.
+	 */
+	const int n;
+
+	/**
+	 * \brief The preconditioning matrix.
+	 *
+	 * Meaningless if #valid is false (the matrix
+	 * must be resized to n x n before being calculated).
+	 */
+	Matrix C;
+
+	/**
+	 * \brief Whether #C has been calculated.
+	 */
+	bool valid;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline BxpPrecond::BxpPrecond(long id, int n) : Bxp(id), n(n), C(1,1), valid(false) {
+
+}
+
+inline BxpPrecond* BxpPrecond::copy(const IntervalVector& box, const BoxProperties& prop) const {
+	return new BxpPrecond(*this);
+}
+
+inline BxpPrecond* BxpPrecond::light_copy(const IntervalVector& box, const BoxProperties& prop) const {
+	return valid || C.nb_rows()>1 ? new BxpPrecond(id, n) : NULL;
+}
+
+inline void BxpPrecond::update(const BoxEvent& event, const BoxProperties& prop) {
+
+}
+
+inline bool BxpPrecond::unchanged(const BoxEvent& event, const BoxProperties& prop) const {
+	return true;
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_BXP_PRECOND_H__ */
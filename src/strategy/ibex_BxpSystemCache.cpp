@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jun 23, 2017
-// Last Update : Jul 29, 2018
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_BxpSystemCache.h"
@@ -50,8 +50,19 @@ BxpSystemCache::BxpSystemCache(const System& sys, double update_ratio/*, int goa
 	//assert((goal_var==-1 && init_box.size()==sys.nb_var) || (goal_var!=-1 && init_box.size()==sys.nb_var+1));
 }
 
+BxpSystemCache::BxpSystemCache(const BxpSystemCache& c) : Bxp(c), sys(c.sys), nb_var(c.nb_var),
+		update_ratio(c.update_ratio), cache(c.cache),
+		_goal_eval(c._goal_eval), goal_eval_updated(c.goal_eval_updated),
+		_goal_gradient(c._goal_gradient), goal_gradient_updated(c.goal_gradient_updated),
+		_ctrs_eval(c._ctrs_eval), ctr_eval_updated(c.ctr_eval_updated),
+		_ctrs_jacobian(c._ctrs_jacobian), ctr_jacobian_updated(c.ctr_jacobian_updated),
+		active(c.active), active_ctr_updated(c.active_ctr_updated),
+		active_ctr_jacobian_updated(c.active_ctr_jacobian_updated) {
+
+}
+
 BxpSystemCache* BxpSystemCache::copy(const IntervalVector& box, const BoxProperties& prop) const {
-	return new BxpSystemCache(sys, update_ratio);
+	return new BxpSystemCache(*this);
 }
 
 long BxpSystemCache::get_id(const System& sys) {
@@ -70,48 +81,60 @@ std::string BxpSystemCache::to_string() const {
 	return ss.str();
 }
 
-void BxpSystemCache::update(const BoxEvent& e, const BoxProperties& prop) {
+void BxpSystemCache::compare(const BoxEvent& e, bool& close, bool& included) const {
 
-	bool close = true;     // is the new box close to the cache?
-	bool included = true;  // is the new box included in the cache?
-
-	// TODO:
-	// Should be fixed by making loup finders working on the
-	// extended box directly?
-	// ------------------------ HACK -----------------------
-	IntervalVector box(nb_var);
-	if (e.box.size()>nb_var) {
-		for (int i=0; i<nb_var; i++) { // skip goal variable
-			box[i]=e.box[i];
-		}
-	} else {
-		box=e.box;
-	}
-	// -----------------------------------------------------
+	close = true;     // is the new box close to the cache?
+	included = true;  // is the new box included in the cache?
+
+	// note: if the box is extended (see the hack in update), the goal
+	// variable is skipped since only the first nb_var components are read.
 
-	if (box.is_empty()) {
+	if (e.box.is_empty()) {
 		if (!cache.is_empty()) close=false;
 	} else if (cache.is_empty()) {
-		if (!box.is_empty()) included=false;
+		included=false;
 	} else {
 
 		for (int j=0; j<nb_var; j++) {
 
-			if (e.type!=BoxEvent::CONTRACT && !box[j].is_subset(cache[j])) {
+			if (e.type!=BoxEvent::CONTRACT && !e.box[j].is_subset(cache[j])) {
 				included=false;
 				break;
 			}
 
 			if (close) // we test closeness only if necessary
-				if ((update_ratio==0 && cache[j]!=box[j])
-						|| cache[j].rel_distance(box[j])>update_ratio)
+				if ((update_ratio==0 && cache[j]!=e.box[j])
+						|| cache[j].rel_distance(e.box[j])>update_ratio)
 					close = false;
 		}
 	}
+}
+
+bool BxpSystemCache::unchanged(const BoxEvent& e, const BoxProperties& prop) const {
+	bool close, included;
+	compare(e, close, included);
+	return close && included;
+}
+
+void BxpSystemCache::update(const BoxEvent& e, const BoxProperties& prop) {
+
+	bool close, included;
+	compare(e, close, included);
 
 	if (!close || !included) {
 
-		cache = box;
+		// TODO:
+		// Should be fixed by making loup finders working on the
+		// extended box directly?
+		// ------------------------ HACK -----------------------
+		if (e.box.size()>nb_var) {
+			for (int i=0; i<nb_var; i++) { // skip goal variable
+				cache[i]=e.box[i];
+			}
+		} else {
+			cache = e.box;
+		}
+		// -----------------------------------------------------
 
 		// mark interval computations as "to be updated"
 		if (sys.goal) {
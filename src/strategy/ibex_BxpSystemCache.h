@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jun 23, 2017
-// Last Update : Jul 29, 2018
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_BXP_SYSTEM_CACHE_H__
@@ -49,7 +49,10 @@ public:
 	BxpSystemCache(const System& sys, double update_ratio);
 
 	/**
-	 * \brief Copy the property
+	 * \brief Copy the property.
+	 *
+	 * The cached computations are copied; they are invalidated by the
+	 * next call to update(...) if the box is not close to the cache.
 	 */
 	virtual BxpSystemCache* copy(const IntervalVector& box, const BoxProperties& prop) const;
 
@@ -65,6 +68,13 @@ public:
 	 */
 	virtual void update(const BoxEvent& event, const BoxProperties& prop);
 
+	/**
+	 * \brief True if the cache is still valid after the box modification.
+	 *
+	 * \see update(...).
+	 */
+	virtual bool unchanged(const BoxEvent& event, const BoxProperties& prop) const;
+
 	/**
 	 * \brief To string
 	 *
@@ -164,6 +174,19 @@ public:
 
 protected:
 
+	/**
+	 * \brief Constructor by copy.
+	 */
+	explicit BxpSystemCache(const BxpSystemCache& c);
+
+	/**
+	 * Compare the box of an event with the cache.
+	 *
+	 * \param close    - set to true iff the box is close to the cache (see #update_ratio).
+	 * \param included - set to true iff the box is included in the cache.
+	 */
+	void compare(const BoxEvent& e, bool& close, bool& included) const;
+
 	/**
 	 * Number of variables of the system
 	 */
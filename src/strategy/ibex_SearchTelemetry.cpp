@@ -0,0 +1,196 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SearchTelemetry.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_SearchTelemetry.h"
+
+#include <typeinfo>
+#include <iomanip>
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+const char* SearchTelemetry::cause_name[NB_CAUSES] = {
+		"contractor", "loup", "eps_box", "solution", "boundary", "unknown", "rejected", "buffer" };
+
+namespace {
+
+const size_t SIGNATURE_LENGTH = 20;
+const char*  SIGNATURE = "IBEX TELEMETRY FILE";
+
+enum { START_EVENT, BOUNDS_EVENT, BUFFER_EVENT, DEPTH_EVENT, CONTRACTOR_EVENT, END_EVENT, NB_EVENTS };
+
+const char* event_name[NB_EVENTS] = { "start", "bounds", "buffer", "depth", "contractor", "end" };
+
+}
+
+SearchTelemetry::DepthStat::DepthStat() : cells(0) {
+	for (int i=0; i<NB_CAUSES; i++) closed[i]=0;
+}
+
+SearchTelemetry::SearchTelemetry(const char* filename, Format format) : sample_period(0.1), format(format),
+		nb_cells(0), start_time(chrono::steady_clock::now()), last_uplo(NEG_INFINITY), last_loup(POS_INFINITY),
+		last_bounds_time(0), last_buffer_time(0), stats_written(true) {
+
+	f.open(filename, ios::out | ios::binary | ios::trunc);
+
+	if (f.fail())
+		ibex_error("[SearchTelemetry]: cannot create output file.\n");
+
+	if (format==BINARY)
+		f.write(SIGNATURE, SIGNATURE_LENGTH*sizeof(char));
+	else
+		f << setprecision(12);
+}
+
+SearchTelemetry::~SearchTelemetry() {
+	end();
+	f.close();
+}
+
+void SearchTelemetry::set_name(const Ctc& ctc, const string& name) {
+	ctc_name[&ctc]=name;
+}
+
+void SearchTelemetry::start() {
+	end(); // previous search, if any
+
+	depth.clear();
+	ctc_emptied.clear();
+	nb_cells=0;
+	start_time=chrono::steady_clock::now();
+	last_uplo=NEG_INFINITY;
+	last_loup=POS_INFINITY;
+	last_bounds_time=last_buffer_time=0;
+	stats_written=false;
+
+	begin_record(START_EVENT);
+	end_record();
+}
+
+void SearchTelemetry::emptied(unsigned int d, const Ctc& ctc) {
+	closed(d, CONTRACTOR);
+	ctc_emptied[&ctc]++;
+}
+
+void SearchTelemetry::bounds(double uplo, double loup) {
+	if (loup==last_loup && uplo==last_uplo) return;
+
+	double time=elapsed();
+
+	// loup updates are always written (rare)
+	if (loup==last_loup && time-last_bounds_time<sample_period) return;
+
+	begin_record(BOUNDS_EVENT);
+	field("time", time);
+	field("cells", nb_cells);
+	field("uplo", uplo);
+	field("loup", loup);
+	end_record();
+
+	last_uplo=uplo;
+	last_loup=loup;
+	last_bounds_time=time;
+}
+
+void SearchTelemetry::node(unsigned int buffer_size) {
+	double time=elapsed();
+
+	if (time-last_buffer_time<sample_period) return;
+
+	begin_record(BUFFER_EVENT);
+	field("time", time);
+	field("cells", nb_cells);
+	field("size", (uint64_t) buffer_size);
+	end_record();
+
+	last_buffer_time=time;
+}
+
+void SearchTelemetry::end() {
+	if (stats_written) return;
+
+	write_stats();
+
+	begin_record(END_EVENT);
+	field("time", elapsed());
+	field("cells", nb_cells);
+	end_record();
+
+	f.flush();
+	stats_written=true;
+}
+
+double SearchTelemetry::elapsed() const {
+	return chrono::duration<double>(chrono::steady_clock::now()-start_time).count();
+}
+
+void SearchTelemetry::write_stats() {
+
+	for (size_t d=0; d<depth.size(); d++) {
+		begin_record(DEPTH_EVENT);
+		field("depth", (uint64_t) d);
+		field("cells", depth[d].cells);
+		for (int i=0; i<NB_CAUSES; i++)
+			field(cause_name[i], depth[d].closed[i]);
+		end_record();
+	}
+
+	for (map<const Ctc*, uint64_t>::const_iterator it=ctc_emptied.begin(); it!=ctc_emptied.end(); ++it) {
+		map<const Ctc*, string>::const_iterator name=ctc_name.find(it->first);
+		begin_record(CONTRACTOR_EVENT);
+		field("name", name!=ctc_name.end()? name->second : string(typeid(*it->first).name()));
+		field("emptied", it->second);
+		end_record();
+	}
+}
+
+void SearchTelemetry::begin_record(uint32_t event) {
+	if (format==BINARY)
+		f.write((char*) &event, sizeof(uint32_t));
+	else
+		f << "{\"event\":\"" << event_name[event] << '"';
+}
+
+void SearchTelemetry::field(const char* key, uint64_t x) {
+	if (format==BINARY)
+		f.write((char*) &x, sizeof(uint64_t));
+	else
+		f << ",\"" << key << "\":" << x;
+}
+
+void SearchTelemetry::field(const char* key, double x) {
+	if (format==BINARY)
+		f.write((char*) &x, sizeof(double));
+	else {
+		f << ",\"" << key << "\":";
+		if (std::isfinite(x)) f << x; else f << "null";
+	}
+}
+
+void SearchTelemetry::field(const char* key, const string& x) {
+	if (format==BINARY) {
+		f.write(x.c_str(), x.size()*sizeof(char));
+		f.put('\0');
+	} else {
+		f << ",\"" << key << "\":\"";
+		for (string::const_iterator c=x.begin(); c!=x.end(); ++c) {
+			if (*c=='"' || *c=='\\') f << '\\';
+			f << *c;
+		}
+		f << '"';
+	}
+}
+
+void SearchTelemetry::end_record() {
+	if (format==JSON_LINES) f << "}\n";
+}
+
+} // end namespace ibex
@@ -0,0 +1,251 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SearchTelemetry.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_SEARCH_TELEMETRY_H__
+#define __IBEX_SEARCH_TELEMETRY_H__
+
+#include "ibex_Ctc.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <stdint.h>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Search-tree statistics (Solver and Optimizer).
+ *
+ * Once attached to a strategy (see Solver::telemetry and Optimizer::telemetry),
+ * this object records:
+ * - the number of cells created at each depth of the search tree;
+ * - the number of cells closed at each depth, by cause (see #Cause);
+ * - the number of boxes emptied by each contractor. When the contractor
+ *   of the strategy is a composition (see #CtcCompo), the sub-contractor
+ *   that emptied the box is identified;
+ * - the timeline of the uplo/loup (optimizer only);
+ * - the size of the cell buffer over time.
+ *
+ * Statistics per depth and per contractor are aggregated in memory and written
+ * at the end of the search. Events of the timelines are written as they occur,
+ * but not more often than #sample_period (except for loup updates, which
+ * are always written). So the overhead is bounded, whatever the size of the search.
+ *
+ * All times are wall-clock times (in seconds) since the start of the search.
+ *
+ * Output formats:
+ *
+ * - JSON_LINES: one JSON object per line, with an "event" field in
+ *   "start", "bounds", "buffer", "depth", "contractor" and "end".
+ *   Infinite bounds are written as null.
+ *   <pre>
+ *   {"event":"start"}
+ *   {"event":"bounds","time":0.012,"cells":112,"uplo":-1.5,"loup":null}
+ *   {"event":"buffer","time":0.1,"cells":1532,"size":48}
+ *   {"event":"depth","depth":3,"cells":8,"contractor":2,"loup":0,"eps_box":0,...}
+ *   {"event":"contractor","name":"hc4","emptied":4521}
+ *   {"event":"end","time":1.25,"cells":20481}
+ *   </pre>
+ *
+ * - BINARY: a 20-byte signature "IBEX TELEMETRY FILE" (null-terminated) followed by
+ *   records starting with a uint32 tag (the index of the event in the list above):
+ *   <pre>
+ *   start      : -
+ *   bounds     : time (double), cells (uint64), uplo (double), loup (double)
+ *   buffer     : time (double), cells (uint64), size (uint64)
+ *   depth      : depth (uint64), cells (uint64), NB_CAUSES closed cells (uint64)
+ *   contractor : name (null-terminated), emptied (uint64)
+ *   end        : time (double), cells (uint64)
+ *   </pre>
+ */
+class SearchTelemetry {
+public:
+
+	/**
+	 * \brief Why a cell has been closed.
+	 *
+	 * CONTRACTOR: the box has been emptied by a contractor.
+	 * LOUP:       (optimizer) the objective cannot be lower than the loup.
+	 * EPS_BOX:    the precision has been reached, or the box cannot be bisected (optimizer).
+	 * SOLUTION:   (solver) solution box (or inner box).
+	 * BOUNDARY:   (solver) boundary box.
+	 * UNKNOWN:    (solver) unknown box (precision reached).
+	 * REJECTED:   (solver) the certification has proven that the box contains no solution.
+	 * BUFFER:     (optimizer) the cell has been removed from the buffer after a loup update.
+	 *             The depth of these cells is not known (they are counted at depth 0).
+	 */
+	typedef enum { CONTRACTOR, LOUP, EPS_BOX, SOLUTION, BOUNDARY, UNKNOWN, REJECTED, BUFFER, NB_CAUSES } Cause;
+
+	/**
+	 * \brief Output format.
+	 */
+	typedef enum { JSON_LINES, BINARY } Format;
+
+	/**
+	 * \brief Create telemetry written into a file.
+	 *
+	 * The file is created (or truncated).
+	 */
+	SearchTelemetry(const char* filename, Format format=JSON_LINES);
+
+	/**
+	 * \brief Write the statistics (if not done yet) and close the file.
+	 */
+	~SearchTelemetry();
+
+	/**
+	 * \brief Give a name to a contractor.
+	 *
+	 * By default, contractors are named by their (implementation-specific) type name.
+	 */
+	void set_name(const Ctc& ctc, const std::string& name);
+
+	/**
+	 * \brief Start a new search.
+	 *
+	 * Statistics of the previous search are written (if not done yet) and reset.
+	 */
+	void start();
+
+	/**
+	 * \brief A new cell has been created.
+	 */
+	void cell(unsigned int depth);
+
+	/**
+	 * \brief A cell has been closed.
+	 */
+	void closed(unsigned int depth, Cause cause);
+
+	/**
+	 * \brief A cell has been emptied by a contractor.
+	 *
+	 * \param ctc - the contractor (see ContractContext::emptied_by).
+	 */
+	void emptied(unsigned int depth, const Ctc& ctc);
+
+	/**
+	 * \brief Cells have been removed from the buffer (see #BUFFER).
+	 */
+	void pruned(unsigned int nb);
+
+	/**
+	 * \brief Current lower and upper bounds of the objective.
+	 */
+	void bounds(double uplo, double loup);
+
+	/**
+	 * \brief Current size of the buffer.
+	 *
+	 * To be called at each iteration.
+	 */
+	void node(unsigned int buffer_size);
+
+	/**
+	 * \brief End of the search: write the statistics.
+	 */
+	void end();
+
+	/**
+	 * \brief Minimal time between two events of a timeline.
+	 *
+	 * By default: 0.1s.
+	 */
+	double sample_period;
+
+	/**
+	 * \brief Name of each cause.
+	 */
+	static const char* cause_name[NB_CAUSES];
+
+protected:
+
+	/** Elapsed time since start. */
+	double elapsed() const;
+
+	/** Write the statistics. */
+	void write_stats();
+
+	/* Start a new record (see the list of events). */
+	void begin_record(uint32_t event);
+
+	/* Write a field of the current record (the key is ignored in binary format). */
+	void field(const char* key, uint64_t x);
+	void field(const char* key, double x);
+	void field(const char* key, const std::string& x);
+
+	/* End the current record. */
+	void end_record();
+
+	/* Statistics of one depth. */
+	struct DepthStat {
+		DepthStat();
+		uint64_t cells;
+		uint64_t closed[NB_CAUSES];
+	};
+
+	std::ofstream f;
+
+	const Format format;
+
+	/** Statistics of each depth. */
+	std::vector<DepthStat> depth;
+
+	/** Number of boxes emptied by each contractor. */
+	std::map<const Ctc*, uint64_t> ctc_emptied;
+
+	/** Names of the contractors. */
+	std::map<const Ctc*, std::string> ctc_name;
+
+	/** Total number of cells. */
+	uint64_t nb_cells;
+
+	std::chrono::steady_clock::time_point start_time;
+
+	/** Last written uplo and loup. */
+	double last_uplo, last_loup;
+
+	/** Last time a "bounds" event was written. */
+	double last_bounds_time;
+
+	/** Last time a "buffer" event was written. */
+	double last_buffer_time;
+
+	/** Whether the statistics are written. */
+	bool stats_written;
+
+private:
+	SearchTelemetry(const SearchTelemetry&); // forbidden
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void SearchTelemetry::cell(unsigned int d) {
+	if (d>=depth.size()) depth.resize(d+1);
+	depth[d].cells++;
+	nb_cells++;
+}
+
+inline void SearchTelemetry::closed(unsigned int d, Cause cause) {
+	if (d>=depth.size()) depth.resize(d+1);
+	depth[d].closed[cause]++;
+}
+
+inline void SearchTelemetry::pruned(unsigned int nb) {
+	if (depth.empty()) depth.resize(1);
+	depth[0].closed[BUFFER]+=nb;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_SEARCH_TELEMETRY_H__
@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Jan 05, 2012
- * Last Update : May 04, 2020
+ * Last Update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef _IBEX_EXPR_H
@@ -132,7 +132,12 @@ public:
 	 *    0 - no simplification at all (fast)
 	 *    1 - basic simplifications (fairly fast)
 	 *    2 - more advanced simplifications without developing (can be slow)
-	 *    3 - simplifications with full polynomial developing (can blow up)
+	 *    3 - simplifications with polynomial developing. The number of monomials
+	 *        generated is bounded by Expr2Polynom::default_expansion_ratio (10)
+	 *        times the size of the expression: beyond this budget, products and
+	 *        squares are left undeveloped. So large products (e.g., of more than 7
+	 *        binomials) are only partially developed. Use ExprSimplify2(true,ratio)
+	 *        with a larger ratio to develop them fully (can blow up).
 	 * */
 	const ExprNode& simplify(int level) const;
 
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 27, 2020
-// Last update : May 12, 2020
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_Expr2Polynom.h"
@@ -22,7 +22,8 @@ using namespace std;
 
 namespace ibex {
 
-Expr2Polynom::Expr2Polynom(ExprSimplify2& simp, bool develop) : develop(develop), simp(simp) {
+Expr2Polynom::Expr2Polynom(ExprSimplify2& simp, bool develop, double expansion_ratio) :
+		develop(develop), expansion_ratio(expansion_ratio), budget(0), simp(simp) {
 
 }
 
@@ -36,9 +37,16 @@ const ExprNode& Expr2Polynom::rec(const ExprNode& e) {
 }
 
 const ExprPolynomial* Expr2Polynom::get(const ExprNode& e) {
+	budget = expansion_ratio * e.size;
 	return visit(e);
 }
 
+bool Expr2Polynom::expand(double n) {
+	if (!develop || n>budget) return false;
+	budget -= n;
+	return true;
+}
+
 void Expr2Polynom::cleanup() {
 	for (IBEX_NODE_MAP(const ExprPolynomial*)::iterator it=cache.begin(); it!=cache.end(); ++it)
 		delete it->second;
@@ -126,7 +134,8 @@ const ExprPolynomial* Expr2Polynom::visit(const ExprChi& e) {
 const ExprPolynomial* Expr2Polynom::visit(const ExprMul& e) {
 	const ExprPolynomial* l = visit(e.left);
 	const ExprPolynomial* r = visit(e.right);
-	if (develop || l->is_constant() || r->is_constant() || (l->one_monomial() && r->one_monomial()))
+	if (l->is_constant() || r->is_constant() || (l->one_monomial() && r->one_monomial())
+			|| expand(((double) l->mono.size())*r->mono.size()))
 		return l->mul(r,&simp);
 	else {
 		const ExprNode& lnode=l->to_expr(&simp.record);
@@ -148,11 +157,40 @@ const ExprPolynomial* Expr2Polynom::visit(const ExprGenericBinaryOp& e) {
 }
 
 const ExprPolynomial* Expr2Polynom::visit(const ExprAdd& e)   {
-	return visit(e.left)->add(visit(e.right));
+	return sum(e);
 }
 
 const ExprPolynomial* Expr2Polynom::visit(const ExprSub& e)   {
-	return visit(e.left)->sub(visit(e.right));
+	return sum(e);
+}
+
+const ExprPolynomial* Expr2Polynom::sum(const ExprBinaryOp& e) {
+	vector<const ExprPolynomial*> p;
+	vector<bool> signs;
+	NodeMap<bool> visited;
+	sum_operands(e.left, true, visited, p, signs);
+	sum_operands(e.right, dynamic_cast<const ExprAdd*>(&e)!=NULL, visited, p, signs);
+	return ExprPolynomial::sum(p, signs);
+}
+
+void Expr2Polynom::sum_operands(const ExprNode& e, bool add, NodeMap<bool>& visited,
+		vector<const ExprPolynomial*>& p, vector<bool>& signs) {
+
+	// A sub-sum already calculated or occurring several times
+	// is considered as a single operand (avoids exponential
+	// explosion with shared sub-sums).
+	if (!cache.found(e) && !visited.found(e)) {
+		const ExprAdd* a=dynamic_cast<const ExprAdd*>(&e);
+		const ExprSub* s=dynamic_cast<const ExprSub*>(&e);
+		if (a || s) {
+			visited.insert(e,true);
+			sum_operands(((const ExprBinaryOp&) e).left, add, visited, p, signs);
+			sum_operands(((const ExprBinaryOp&) e).right, a? add : !add, visited, p, signs);
+			return;
+		}
+	}
+	p.push_back(visit(e));
+	signs.push_back(add);
 }
 
 const ExprPolynomial* Expr2Polynom::visit(const ExprDiv& e)   {
@@ -190,8 +228,9 @@ const ExprPolynomial* Expr2Polynom::visit(const ExprIndex& e) {
 
 const ExprPolynomial* Expr2Polynom::visit(const ExprSqr& e)   {
 	const ExprPolynomial* p = visit(e.expr);
-	if (develop || p->one_monomial())
-		return visit(e.expr)->square_();
+	double n = p->mono.size();
+	if (p->one_monomial() || expand(n*(n+1)/2))
+		return p->square_();
 	else
 		return unary(e, ExprSqr::new_);
 }
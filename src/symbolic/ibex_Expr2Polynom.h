@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 27, 2020
-// Last update : May 12, 2020
+// Last update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_EXPR_2_POLYNOM_H__
@@ -43,8 +43,9 @@ public:
 	 *                  * the multiplication of monomials may require to apply a
 	 *                  transposition and thus a call to simplification (but only
 	 *                  the systematic part, no recursive call to Expr2Polynom).
+	 * \param expansion_ratio - Expansion budget in develop mode (see #get(const ExprNode&)).
 	 */
-	Expr2Polynom(ExprSimplify2& simp, bool develop=false);
+	Expr2Polynom(ExprSimplify2& simp, bool develop=false, double expansion_ratio=default_expansion_ratio);
 
 	/**
 	 * Delete this.
@@ -53,6 +54,12 @@ public:
 
 	/**
 	 * Get the resulting polynomial.
+	 *
+	 * In develop mode, the total number of monomials generated by
+	 * products and squares of polynomials is bounded by the expansion
+	 * ratio times the size of e. Once this budget is exhausted, the
+	 * remaining products are not developed (just like without develop
+	 * mode), which prevents the expression from blowing up.
 	 */
 	const ExprPolynomial* get(const ExprNode& e);
 
@@ -63,6 +70,11 @@ public:
 	 */
 	void cleanup();
 
+	/**
+	 * Default expansion ratio: 10.
+	 */
+	static constexpr double default_expansion_ratio = 10;
+
 protected:
 
 	const ExprPolynomial* visit(const ExprNode& e);
@@ -112,6 +124,26 @@ protected:
 
 	const ExprPolynomial* nary(const ExprNAryOp& e, std::function<const ExprNAryOp&(const Array<const ExprNode>&)> f);
 
+	/*
+	 * Polynomial of a sum/difference e, calculated in one go
+	 * with all the operands of the sum tree rooted by e
+	 * (instead of a sequence of binary sums).
+	 */
+	const ExprPolynomial* sum(const ExprBinaryOp& e);
+
+	/*
+	 * Push the operands of the sum tree rooted by e in p, with
+	 * their sign. The intermediate sums are not cached.
+	 */
+	void sum_operands(const ExprNode& e, bool add, NodeMap<bool>& visited,
+			std::vector<const ExprPolynomial*>& p, std::vector<bool>& signs);
+
+	/*
+	 * Whether a development generating n monomials fits in the
+	 * remaining budget (the budget is decreased if so).
+	 */
+	bool expand(double n);
+
 	/*
 	 * Record the node in #record for cleanup
 	 */
@@ -119,6 +151,10 @@ protected:
 
 	bool develop;
 
+	/* Expansion budget (see #get(const ExprNode&)) */
+	double expansion_ratio;
+	double budget;
+
 	ExprSimplify2& simp;
 };
 
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 30, 2020
-// Last update : May 12, 2020
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_ExprMonomial.h"
@@ -803,6 +803,17 @@ pair<int,bool> ExprMonomial::cmp_and_add(const ExprMonomial& m2, ExprMonomial* m
 	return make_pair(final_result,true);
 }
 
+bool ExprMonomial::key(vector<uint64_t>& k) const {
+	k.clear();
+	for (list<Term*>::const_iterator it=terms.begin(); it!=terms.end(); ++it) {
+		if ((*it)->type()!=Term::SCALAR) return false;
+		const ScalarTerm& t=(const ScalarTerm&) **it;
+		if (t.power<=0 || t.power>=(1<<16) || t.e.id<0 || ((int64_t) t.e.id)>=(((int64_t) 1)<<47)) return false;
+		k.push_back((((uint64_t) t.e.id) << 16) | ((uint64_t) t.power));
+	}
+	return true;
+}
+
 ExprMonomial operator*(const ExprMonomial& m1, const ExprMonomial& m2) {
 	return m1.mul(m2);
 }
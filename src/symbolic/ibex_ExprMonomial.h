@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 30, 2020
-// Last update : May 12, 2020
+// Last update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_EXPR_MONOMIAL_H__
@@ -16,6 +16,8 @@
 #include "ibex_ExprOccCounter.h"
 
 #include <list>
+#include <vector>
+#include <cstdint>
 
 namespace ibex {
 
@@ -166,6 +168,18 @@ protected:
 	 */
 	std::pair<int,bool> cmp_and_add(const ExprMonomial& m2, ExprMonomial* m12, bool add) const;
 
+	/**
+	 * Hash key of the monomial (regardless of the coefficient).
+	 *
+	 * The key is the sequence of terms, each term being packed
+	 * in a machine word (node id in the upper 48 bits, power in
+	 * the lower 16 bits). Two monomials with the same key only
+	 * differ by their coefficient.
+	 *
+	 * \return false if the monomial has non-scalar terms (no key).
+	 */
+	bool key(std::vector<uint64_t>& k) const;
+
 	friend class ExprPolynomial;
 	friend ExprMonomial operator*(const ExprMonomial& m1, const ExprMonomial& m2);
 	friend ExprMonomial operator+(const ExprMonomial& m1, const ExprMonomial& m2);
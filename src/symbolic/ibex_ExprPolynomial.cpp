@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 30, 2020
-// Last update : May 12, 2020
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_ExprPolynomial.h"
@@ -13,11 +13,120 @@
 
 #include <sstream>
 #include <numeric>
+#include <unordered_map>
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+struct KeyHash {
+	size_t operator()(const vector<uint64_t>& k) const {
+		uint64_t h=k.size();
+		for (vector<uint64_t>::const_iterator it=k.begin(); it!=k.end(); ++it)
+			h ^= *it + 0x9e3779b97f4a7c15ULL + (h<<6) + (h>>2);
+		return (size_t) h;
+	}
+};
+
+}
+
+class ExprPolynomial::Accumulator {
+public:
+	/*
+	 * The monomials will be added to p.
+	 */
+	Accumulator(ExprPolynomial& p);
+
+	/*
+	 * Add (or subtract) a monomial.
+	 */
+	void add(const ExprMonomial& m, bool add);
+
+	/*
+	 * Sort the monomials of p and merge those
+	 * that could not be merged by the hash table.
+	 */
+	void flush();
+
+protected:
+	ExprPolynomial& p;
+
+	/* monomials are hashed only in a scalar polynomial */
+	const bool hashed;
+
+	std::unordered_map<vector<uint64_t>, list<ExprMonomial>::iterator, KeyHash> index;
+
+	/* buffer */
+	vector<uint64_t> k;
+};
+
+ExprPolynomial::Accumulator::Accumulator(ExprPolynomial& p) : p(p), hashed(p.dim.is_scalar()) {
+
+}
+
+void ExprPolynomial::Accumulator::add(const ExprMonomial& m, bool add) {
+	if (hashed && m.key(k)) {
+		std::unordered_map<vector<uint64_t>, list<ExprMonomial>::iterator, KeyHash>::iterator it=index.find(k);
+		if (it!=index.end()) {
+			Interval& c=it->second->coeff;
+			c = add? c+m.coeff : c-m.coeff;
+			return;
+		}
+		p.mono.push_back(add? m : -m);
+		index.insert(make_pair(k,--p.mono.end()));
+	} else
+		p.mono.push_back(add? m : -m);
+}
+
+void ExprPolynomial::Accumulator::flush() {
+	index.clear();
+
+	p.mono.sort([](const ExprMonomial& m1, const ExprMonomial& m2) { return compare(m1,m2)<0; });
+
+	list<ExprMonomial>::iterator it=p.mono.begin();
+	while (it!=p.mono.end()) {
+		if (is_zero(it->coeff)) {
+			it = p.mono.erase(it);
+			continue;
+		}
+		list<ExprMonomial>::iterator next=it;
+		++next;
+		if (next==p.mono.end()) break;
+
+		// merge monomials that are equal up to their coefficient
+		// (or constant parts, see ExprMonomial::cmp_and_add), but
+		// with a different key (different nodes or matrix terms).
+		ExprMonomial m12;
+		try {
+			if (it->cmp_and_add(*next, &m12, true).second) {
+				p.mono.erase(next);
+				it = p.mono.erase(it);
+				it = p.mono.insert(it, m12);
+			} else
+				++it;
+		} catch(ExprMonomial::NullResult&) {
+			p.mono.erase(next);
+			it = p.mono.erase(it);
+		}
+	}
+}
+
+ExprPolynomial* ExprPolynomial::sum(const std::vector<const ExprPolynomial*>& p, const std::vector<bool>& add) {
+	assert(!p.empty() && p.size()==add.size());
+
+	ExprPolynomial* res=new ExprPolynomial(p[0]->dim);
+	Accumulator acc(*res);
+	for (size_t i=0; i<p.size(); i++) {
+		assert(p[i]->dim==res->dim);
+		for (list<ExprMonomial>::const_iterator it=p[i]->mono.begin(); it!=p[i]->mono.end(); ++it)
+			acc.add(*it, add[i]);
+	}
+	acc.flush();
+	return res;
+}
+
 bool ExprPolynomial::is_zero(const Interval& x) {
 	return (x.lb()==0 && x.ub()==0);
 }
@@ -135,15 +244,18 @@ ExprPolynomial& ExprPolynomial::init_square(const ExprPolynomial& p) {
 	assert(dim.nb_rows()==dim.nb_cols());
 	assert(dim == p.dim);
 
+	Accumulator acc(*this);
+
 	for (list<ExprMonomial>::const_iterator it1=p.mono.begin(); it1!=p.mono.end(); ++it1) {
 		for (list<ExprMonomial>::const_iterator it2=it1; it2!=p.mono.end(); ++it2) {
 			// order or monomials is not necessarily preserved, ex: (x(1,2)+(1,2))*(x(1;2)+(1;2)) -> 5 + ...
 			if (it1==it2)
-				(*this) +=(it1->square());
+				acc.add(it1->square(), true);
 			else
-				(*this) +=(2*(*it1)*(*it2));
+				acc.add(2*(*it1)*(*it2), true);
 		}
 	}
+	acc.flush();
 	return *this;
 }
 
@@ -162,12 +274,15 @@ ExprPolynomial& ExprPolynomial::init_mult(const ExprPolynomial& p1, const ExprPo
 	assert(dim==mul_dim(p1.dim,p2.dim));
 	if (&p1==&p2) return init_square(p1); // to avoid mix with iterators
 
+	Accumulator acc(*this);
+
 	for (list<ExprMonomial>::const_iterator it1=p1.mono.begin(); it1!=p1.mono.end(); ++it1) {
 		for (list<ExprMonomial>::const_iterator it2=p2.mono.begin(); it2!=p2.mono.end(); ++it2) {
 			// order or monomials is not necessarily preserved, ex: (x(1,2)+(1,2))*(y(1;2)+(1;2)) -> 5 + ...
-			(*this) += it1->mul(*it2,s);
+			acc.add(it1->mul(*it2,s), true);
 		}
 	}
+	acc.flush();
 	return *this;
 }
 
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 30, 2020
-// Last update : May 12, 2020
+// Last update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_EXPR_POLYNOMIAL_H__
@@ -137,6 +137,18 @@ public:
 	 */
 	ExprPolynomial* sub(const ExprPolynomial* p2) const;
 
+	/**
+	 * Sum of n polynomials (dynamic variant)
+	 *
+	 * Return p[0]+...+p[n-1] where p[i] is subtracted instead
+	 * of added if add[i] is false. All the polynomials must have
+	 * the same dimension.
+	 *
+	 * Contrary to a sequence of binary sums (quadratic), the
+	 * monomials are gathered in a hash table and sorted only once.
+	 */
+	static ExprPolynomial* sum(const std::vector<const ExprPolynomial*>& p, const std::vector<bool>& add);
+
 	/**
 	 * Multiplication of a polynomial by a scalar (dynamic variant)
 	 */
@@ -160,6 +172,13 @@ public:
 	std::list<ExprMonomial> mono;
 
 protected:
+	/*
+	 * Gathers monomials in a polynomial (in any order). Monomials
+	 * with the same key (see ExprMonomial::key()) are merged on
+	 * the fly in a hash table. The polynomial is sorted at the end.
+	 */
+	class Accumulator;
+
 	static ExprPolynomial zero(Dim d);
 
 	static bool is_zero(const Interval& x);
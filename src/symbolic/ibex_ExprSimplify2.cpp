@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 27, 2020
-// Last update : May 15, 2020
+// Last update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_ExprSimplify2.h"
@@ -90,7 +90,7 @@ const ExprNode& expr(const ExprNode& e) {
 
 } // end anonymous namespace
 
-ExprSimplify2::ExprSimplify2(bool develop) : _2polynom(*this, develop) {
+ExprSimplify2::ExprSimplify2(bool develop, double expansion_ratio) : _2polynom(*this, develop, expansion_ratio) {
 
 }
 
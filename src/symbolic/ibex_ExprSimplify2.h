@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Mar 27, 2020
-// Last update : May 15, 2020
+// Last update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_EXPR_SIMPLIFY_2_H__
@@ -26,7 +26,15 @@ namespace ibex {
 class ExprSimplify2 : public virtual ExprVisitor<const ExprNode*> {
 public:
 
-	ExprSimplify2(bool develop=false);
+	/**
+	 * \param develop         - Develop products of polynomials.
+	 * \param expansion_ratio - Bounds the number of monomials generated by development
+	 *                          (see Expr2Polynom::get(const ExprNode&)). With the default
+	 *                          ratio, large products are not fully developed (this is
+	 *                          the behavior of ExprNode::simplify(3)); give a larger
+	 *                          ratio to develop them fully.
+	 */
+	ExprSimplify2(bool develop=false, double expansion_ratio=Expr2Polynom::default_expansion_ratio);
 
 	/**
 	 * \warning The function destroys all unused nodes which
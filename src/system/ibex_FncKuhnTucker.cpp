@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Apr 26, 2017
-// Last Update : Jul 11, 2019
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include <stdlib.h>
@@ -17,11 +17,12 @@ using namespace std;
 
 namespace ibex {
 
-FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, Function& _df, Function** _dg, const IntervalVector& current_box, const BitSet* _active) :
+FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, Function* _df, Function** _dg, Hessian* hf, Hessian* hg, const IntervalVector& current_box, const BitSet* _active) :
 								Fnc(1,1), sys(sys), n(sys.nb_var), nb_mult(0), // **tmp**
-								act(NULL), df(_df), nothing(BitSet::empty(1)) {
+								act(NULL), df(_df), hf(hf), hg(hg), nothing(BitSet::empty(1)) {
 
 	assert(sys.goal);
+	assert(df || hf);
 
 	try {
 		// ***************************************************
@@ -35,11 +36,28 @@ FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, Function& _df, Functio
 		else
 			act = new FncActiveCtrs(sys,current_box,true);
 
-		dg.resize(act->active_ctr.size());
+		if (df) {
+			dg.resize(act->active_ctr.size());
 
-		unsigned int i=0; // index of a constraint in the active set
-		for (BitSet::const_iterator c=act->active_ctr.begin(); c!=act->active_ctr.end(); ++c) {
-			dg.set_ref(i++,*_dg[c]);
+			unsigned int i=0; // index of a constraint in the active set
+			for (BitSet::const_iterator c=act->active_ctr.begin(); c!=act->active_ctr.end(); ++c) {
+				dg.set_ref(i++,*_dg[c]);
+			}
+		} else {
+			assert(act->active_ctr.empty() || hg);
+
+			// original indices of active constraints, in the order of multipliers
+			if (!act->ineq.empty()) {
+				BitSet ineq=act->active_ctr.compose(act->ineq);
+				for (BitSet::const_iterator c=ineq.begin(); c!=ineq.end(); ++c)
+					ctr.push_back(c);
+			}
+
+			if (!act->eq.empty()) {
+				BitSet eq=act->active_ctr.compose(act->eq);
+				for (BitSet::const_iterator c=eq.begin(); c!=eq.end(); ++c)
+					ctr.push_back(c);
+			}
 		}
 
 		(int&) nb_mult = act->image_dim() +1 ; // +1 because of objective
@@ -83,7 +101,7 @@ IntervalVector FncKuhnTucker::eval_vector(const IntervalVector& x_lambda, const
 	int l=lambda0; // multipliers indices counter. The first multiplier is lambda0.
 
 	// vector corresponding to the "gradient expression" lambda_0*dg + lambda_1*dg_1 + ... (init
-	IntervalVector grad=x_lambda[l] * df.eval_vector(x); // init
+	IntervalVector grad=x_lambda[l] * (df? df->eval_vector(x) : sys.goal->gradient(x)); // init
 
 	// normalization equation lambda_0 + ... = 1.0
 	res[lambda0] = x_lambda[lambda0] - 1.0; // init
@@ -134,6 +152,32 @@ IntervalVector FncKuhnTucker::eval_vector(const IntervalVector& x_lambda, const
 	return res;
 }
 
+void FncKuhnTucker::lagrangian_hessian(const IntervalVector& x_lambda, IntervalMatrix& H, IntervalMatrix& dgx, int v) const {
+
+	IntervalVector x=x_lambda.subvector(0,n-1);
+
+	hf->hessian(x, IntervalVector(1,x_lambda[n]), H, v);
+
+	if (ctr.empty()) return;
+
+	// multipliers of all the constraints (0 for inactive ones)
+	IntervalVector lambda(sys.f_ctrs.image_dim(), Interval::zero());
+
+	for (unsigned int k=0; k<ctr.size(); k++)
+		lambda[ctr[k]]=x_lambda[n+1+k];
+
+	// The Hessian of the constraints is obtained in a single
+	// pass for all active constraints (and their Jacobian as a by-product)
+	IntervalMatrix Hg(n,n);
+	hg->hessian(x, lambda, Hg, dgx, v);
+
+	H += Hg;
+}
+
+IntervalVector FncKuhnTucker::ctr_gradient(const IntervalVector& x, int k) const {
+	return sys.f_ctrs.jacobian(x, BitSet::singleton(sys.f_ctrs.image_dim(),ctr[k])).row(0);
+}
+
 void FncKuhnTucker::jacobian(const IntervalVector& x_lambda, IntervalMatrix& J, const BitSet& components, int v) const {
 
 	if (components.size()!=n+nb_mult) {
@@ -149,8 +193,17 @@ void FncKuhnTucker::jacobian(const IntervalVector& x_lambda, IntervalMatrix& J,
 
 	// matrix corresponding to the "Hessian expression" lambda_0*d^2f+lambda_1*d^2g_1+...=0
 	IntervalMatrix hessian(n,n);
-	if (v==-1 || v<n) hessian = x_lambda[l] * df.jacobian(x,v); // init
-	if (v==-1 || v==l) J.put(0, l, df.eval_vector(x), false);
+
+	// Jacobian of the constraints (automatic differentiation mode only)
+	IntervalMatrix dgx(hg? sys.f_ctrs.image_dim() : 1, n);
+
+	if (v==-1 || v<n) {
+		if (df)
+			hessian = x_lambda[l] * df->jacobian(x,v); // init
+		else
+			lagrangian_hessian(x_lambda, hessian, dgx, v);
+	}
+	if (v==-1 || v==l) J.put(0, l, df? df->eval_vector(x) : sys.goal->gradient(x), false);
 
 	// normalization equation (init)
 	if (v==-1) {
@@ -177,20 +230,26 @@ void FncKuhnTucker::jacobian(const IntervalVector& x_lambda, IntervalMatrix& J,
 
 	for (BitSet::const_iterator i=act->ineq.begin(); i!=act->ineq.end(); ++i) {
 		if (v==-1) {
-			hessian += x_lambda[l] * dg[i].jacobian(x);
-			dgi=dg[i].eval_vector(x);
+			if (df) {
+				hessian += x_lambda[l] * dg[i].jacobian(x);
+				dgi=dg[i].eval_vector(x);
+			} else
+				dgi=dgx[ctr[l-n-1]];
 			J.put(0, l, dgi, false);
 			J.put(l, 0, (x_lambda[l]*dgi), true);
 			J.put(l, n, Vector::zeros(nb_mult), true);
 			J[l][l] = gx[l-n-1]; // maybe a counter for inequalities would be clearer
 			J[lambda0][l] = 1.0;
 		} else if (v==l) {
-			J.put(0, l, dg[i].eval_vector(x), false);
+			J.put(0, l, df? dg[i].eval_vector(x) : ctr_gradient(x,l-n-1), false);
 			J[l][l] = gx[l-n-1];
 			J[lambda0][l] = 1.0;
 		} else if (v<n) {
-			hessian += x_lambda[l] * dg[i].jacobian(x,v);
-			J[l][v] = x_lambda[l]*dg[i].eval(v,x);
+			if (df) {
+				hessian += x_lambda[l] * dg[i].jacobian(x,v);
+				J[l][v] = x_lambda[l]*dg[i].eval(v,x);
+			} else
+				J[l][v] = x_lambda[l]*dgx[ctr[l-n-1]][v];
 		} else {
 			J[l][v] = 0;
 		}
@@ -200,19 +259,25 @@ void FncKuhnTucker::jacobian(const IntervalVector& x_lambda, IntervalMatrix& J,
 
 	for (BitSet::const_iterator i=act->eq.begin(); i!=act->eq.end(); ++i) {
 		if (v==-1) {
-			hessian += x_lambda[l] * dg[i].jacobian(x,v);
-			dgi=dg[i].eval_vector(x);
+			if (df) {
+				hessian += x_lambda[l] * dg[i].jacobian(x,v);
+				dgi=dg[i].eval_vector(x);
+			} else
+				dgi=dgx[ctr[l-n-1]];
 			J.put(0, l, dgi, false);
 			J.put(l, 0, dgi, true);
 			J.put(l, n, Vector::zeros(nb_mult), true);
 			J[lambda0][l] = 2*x_lambda[l];
 		} else if (v==l) {
-			J.put(0, l, dg[i].eval_vector(x), false);
+			J.put(0, l, df? dg[i].eval_vector(x) : ctr_gradient(x,l-n-1), false);
 			J[l][l] = 0;
 			J[lambda0][l] = 2*x_lambda[l];
 		} else if (v<n) {
-			hessian += x_lambda[l] * dg[i].jacobian(x,v);
-			J[l][v] = dg[i].eval(v,x);
+			if (df) {
+				hessian += x_lambda[l] * dg[i].jacobian(x,v);
+				J[l][v] = dg[i].eval(v,x);
+			} else
+				J[l][v] = dgx[ctr[l-n-1]][v];
 		} else {
 			J[l][v] = 0;
 		}
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Apr 26, 2017
-// Last Update : Jul 11, 2019
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_FNC_KUHN_TUCKER_H__
@@ -13,6 +13,9 @@
 
 #include "ibex_NormalizedSystem.h"
 #include "ibex_FncActiveCtrs.h"
+#include "ibex_Hessian.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -114,6 +117,27 @@ public:
  	 */
 	FncKuhnTucker(const NormalizedSystem& sys, Function& df, Function** dg, const IntervalVector& box, const BitSet& active);
 
+	/**
+	 * \brief Build the KKT conditions function for a given box (no symbolic derivative).
+	 *
+	 * The Hessian of the Lagrangian is calculated by automatic differentiation
+	 * (see #ibex::Hessian) directly on the objective and constraints functions
+	 * of the system. Its cost does not depend on the number of active constraints.
+	 *
+	 * \param sys -    see other constructor.
+	 * \param hf -     Hessian of the objective (sys.goal).
+	 * \param hg -     Hessian of the constraints (sys.f_ctrs). NULL if unconstrained problem.
+	 * \param box -    see other constructor.
+	 */
+	FncKuhnTucker(const NormalizedSystem& sys, Hessian& hf, Hessian* hg, const IntervalVector& box);
+
+	/**
+	 * \brief Build the KKT conditions function for a given box (no symbolic derivative).
+	 *
+	 * \param active - see other constructor.
+	 */
+	FncKuhnTucker(const NormalizedSystem& sys, Hessian& hf, Hessian* hg, const IntervalVector& box, const BitSet& active);
+
 	/**
 	 * \brief Delete this.
 	 */
@@ -230,13 +254,30 @@ public:
 	const int nb_mult;
 
 protected:
-	FncKuhnTucker(const NormalizedSystem& sys, Function& df, Function** dg, const IntervalVector& box, const BitSet* active);
+	FncKuhnTucker(const NormalizedSystem& sys, Function* df, Function** dg, Hessian* hf, Hessian* hg, const IntervalVector& box, const BitSet* active);
+
+	/*
+	 * Hessian of the Lagrangian (n first columns of the n first rows)
+	 * and, in automatic differentiation mode, Jacobian of the constraints.
+	 */
+	void lagrangian_hessian(const IntervalVector& x_lambda, IntervalMatrix& H, IntervalMatrix& dgx, int v) const;
+
+	/*
+	 * Gradient of the kth active constraint (automatic differentiation mode).
+	 */
+	IntervalVector ctr_gradient(const IntervalVector& x, int k) const;
 
 	FncActiveCtrs* act;            // function of active constraints
 
-	Function& df;                  // gradient of objective function
+	Function* df;                  // gradient of objective function (NULL in automatic differentiation mode)
+
+	Array<Function> dg;            // gradients of active (in)equalities (symbolic mode)
 
-	Array<Function> dg;            // gradients of active (in)equalities
+	Hessian* hf;                   // Hessian of the objective (NULL in symbolic mode)
+
+	Hessian* hg;                   // Hessian of the constraints (NULL in symbolic mode)
+
+	std::vector<int> ctr;          // indices in sys.f_ctrs of active inequalities, then equalities
 
 	BitSet nothing;                // for the case where nothing is active.
 };
@@ -246,11 +287,19 @@ protected:
   ============================================================================*/
 
 inline FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, Function& df, Function** dg, const IntervalVector& box, const BitSet& active) :
-		FncKuhnTucker(sys,df,dg,box,&active) {
+		FncKuhnTucker(sys,&df,dg,NULL,NULL,box,&active) {
 }
 
 inline FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, Function& df, Function** dg, const IntervalVector& box) :
-		FncKuhnTucker(sys,df,dg,box,NULL) {
+		FncKuhnTucker(sys,&df,dg,NULL,NULL,box,NULL) {
+}
+
+inline FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, Hessian& hf, Hessian* hg, const IntervalVector& box, const BitSet& active) :
+		FncKuhnTucker(sys,NULL,NULL,&hf,hg,box,&active) {
+}
+
+inline FncKuhnTucker::FncKuhnTucker(const NormalizedSystem& sys, Hessian& hf, Hessian* hg, const IntervalVector& box) :
+		FncKuhnTucker(sys,NULL,NULL,&hf,hg,box,NULL) {
 }
 
 inline bool FncKuhnTucker::qualified() const {
@@ -5,7 +5,7 @@
 // Copyright   : IMT Atlantique (France)
 // License     : See the LICENSE file
 // Created     : Jun 12, 2012
-// Last Update : Apr 08, 2019
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_System.h"
@@ -314,13 +314,9 @@ IntervalVector System::active_ctrs_eval(const IntervalVector& box) const {
 
 	assert(!b.empty());
 
-	IntervalVector ev(b.size());
-	int c;
-	for (int i=0; i<b.size(); i++) {
-		c=(i==0? b.min() : b.next(c));
-		ev[i] = f_ctrs[c].eval(box); // not: a call to f_ctrs.eval_vector would benefit from the DAG...
-	}
-	return ev;
+	// note: evaluating the components f_ctrs[c] separately would
+	// not benefit from the DAG (and generate the components)
+	return f_ctrs.eval_vector(box,b);
 }
 
 IntervalMatrix System::active_ctrs_jacobian(const IntervalVector& box) const {
@@ -0,0 +1,194 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_PriorityAgenda.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_PRIORITY_AGENDA_H__
+#define __IBEX_PRIORITY_AGENDA_H__
+
+#include "ibex_Agenda.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Priority agenda.
+ *
+ * Like an #Agenda, a priority agenda is a set of integers in [0,size-1]
+ * where each element can only appear once. But elements are retrieved
+ * by decreasing priority instead of insertion order. Elements with the
+ * same priority are retrieved in insertion order (so that the agenda
+ * behaves like a FIFO if all priorities are equal).
+ *
+ * The agenda is implemented as a binary heap indexed by the elements:
+ * push and pop are in O(log(n)).
+ */
+class PriorityAgenda {
+
+public:
+
+	/**
+	 * \brief Create the agenda.
+	 *
+	 * All elements will be inside the range [0,size-1].
+	 */
+	PriorityAgenda(int size);
+
+	/**
+	 * \brief Push an element with a given priority.
+	 *
+	 * If the element is already in the agenda, its priority
+	 * is updated (and its rank in the insertion order is kept).
+	 */
+	void push(int p, double priority);
+
+	/**
+	 * \brief Pop the element with highest priority.
+	 *
+	 * \throw EmptyAgendaException if the agenda is empty.
+	 */
+	void pop(int& p);
+
+	/**
+	 * \brief True iff p is in the agenda.
+	 */
+	bool contains(int p) const;
+
+	/**
+	 * \brief Remove all elements.
+	 */
+	void flush();
+
+	/**
+	 * \brief True iff the agenda is empty.
+	 */
+	bool empty() const;
+
+	/**
+	 * \brief Number of elements in the agenda.
+	 */
+	int nb_elements() const;
+
+	/**
+	 * \brief The size defining the range of the agenda.
+	 */
+	const int size;
+
+protected:
+	/* true if the element at position i in the heap must be before the one at position j */
+	bool before(int i, int j) const;
+
+	void swap(int i, int j);
+
+	void up(int i);
+
+	void down(int i);
+
+	/** The heap (elements). */
+	std::vector<int> heap;
+
+	/** Position of each element in the heap (-1 if absent). */
+	std::vector<int> pos;
+
+	/** Priority of each element. */
+	std::vector<double> priority;
+
+	/** Insertion stamp of each element. */
+	std::vector<unsigned long> stamp;
+
+	/** Next insertion stamp. */
+	unsigned long counter;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline PriorityAgenda::PriorityAgenda(int size) : size(size), pos(size,-1), priority(size), stamp(size), counter(0) {
+	heap.reserve(size);
+}
+
+inline bool PriorityAgenda::before(int i, int j) const {
+	int p=heap[i];
+	int q=heap[j];
+	return priority[p]>priority[q] || (priority[p]==priority[q] && stamp[p]<stamp[q]);
+}
+
+inline void PriorityAgenda::swap(int i, int j) {
+	int p=heap[i];
+	heap[i]=heap[j];
+	heap[j]=p;
+	pos[heap[i]]=i;
+	pos[heap[j]]=j;
+}
+
+inline void PriorityAgenda::up(int i) {
+	while (i>0 && before(i,(i-1)/2)) {
+		swap(i,(i-1)/2);
+		i=(i-1)/2;
+	}
+}
+
+inline void PriorityAgenda::down(int i) {
+	int n=heap.size();
+	while (true) {
+		int best=i;
+		int l=2*i+1;
+		if (l<n && before(l,best)) best=l;
+		if (l+1<n && before(l+1,best)) best=l+1;
+		if (best==i) return;
+		swap(i,best);
+		i=best;
+	}
+}
+
+inline void PriorityAgenda::push(int p, double prio) {
+	assert(p>=0 && p<size);
+	if (pos[p]==-1) {
+		priority[p]=prio;
+		stamp[p]=counter++;
+		pos[p]=heap.size();
+		heap.push_back(p);
+		up(pos[p]);
+	} else {
+		double old=priority[p];
+		priority[p]=prio;
+		if (prio>old) up(pos[p]);
+		else if (prio<old) down(pos[p]);
+	}
+}
+
+inline void PriorityAgenda::pop(int& p) {
+	if (heap.empty()) throw EmptyAgendaException();
+	p=heap[0];
+	swap(0,heap.size()-1);
+	heap.pop_back();
+	pos[p]=-1;
+	if (!heap.empty()) down(0);
+}
+
+inline bool PriorityAgenda::contains(int p) const {
+	return pos[p]!=-1;
+}
+
+inline void PriorityAgenda::flush() {
+	for (std::vector<int>::const_iterator it=heap.begin(); it!=heap.end(); ++it)
+		pos[*it]=-1;
+	heap.clear();
+}
+
+inline bool PriorityAgenda::empty() const {
+	return heap.empty();
+}
+
+inline int PriorityAgenda::nb_elements() const {
+	return heap.size();
+}
+
+} // namespace ibex
+
+#endif // __IBEX_PRIORITY_AGENDA_H__
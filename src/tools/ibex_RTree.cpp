@@ -0,0 +1,202 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_RTree.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_RTree.h"
+#include "ibex_Exception.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+const int RTree::default_max_entries = 8;
+
+namespace {
+
+/*
+ * Increase of the perimeter of a if enlarged to contain b.
+ */
+double enlargement(const IntervalVector& a, const IntervalVector& b) {
+	double e=0;
+	for (int i=0; i<a.size(); i++) {
+		if (b[i].lb()<a[i].lb()) e+=a[i].lb()-b[i].lb();
+		if (b[i].ub()>a[i].ub()) e+=b[i].ub()-a[i].ub();
+	}
+	return e;
+}
+
+}
+
+RTree::RTree(int max_entries) : max_entries(max_entries), min_entries(max_entries<4? 1 : (max_entries*2)/5), root(-1) {
+	if (max_entries<2)
+		ibex_error("[RTree]: the maximal number of entries must be at least 2");
+}
+
+void RTree::clear() {
+	nodes.clear();
+	entries.clear();
+	ids.clear();
+	root=-1;
+}
+
+void RTree::insert(const IntervalVector& box, int id) {
+	int e=entries.size();
+	entries.push_back(box);
+	ids.push_back(id);
+
+	if (root==-1) {
+		root=nodes.size();
+		nodes.push_back(Node(box,true));
+		nodes[root].children.push_back(e);
+		return;
+	}
+
+	// ======== choose the leaf (least enlargement) ==========
+	vector<int> path;
+	int node=root;
+
+	while (true) {
+		path.push_back(node);
+		nodes[node].box |= box;
+		if (nodes[node].leaf) break;
+
+		const Node& n=nodes[node];
+		int best=-1;
+		double best_e=POS_INFINITY, best_p=POS_INFINITY;
+		for (size_t k=0; k<n.children.size(); k++) {
+			const IntervalVector& b=nodes[n.children[k]].box;
+			double en=enlargement(b,box);
+			if (best==-1 || en<best_e || (en==best_e && b.perimeter()<best_p)) {
+				best=n.children[k];
+				best_e=en;
+				best_p=b.perimeter();
+			}
+		}
+		node=best;
+	}
+
+	nodes[node].children.push_back(e);
+
+	// ======== split overflowing nodes (bottom-up) ==========
+	for (int i=path.size()-1; i>=0; i--) {
+		node=path[i];
+		if ((int) nodes[node].children.size()<=max_entries) break;
+
+		int sibling=split(node);
+
+		if (i==0) { // new root
+			int new_root=nodes.size();
+			nodes.push_back(Node(nodes[node].box | nodes[sibling].box, false));
+			nodes[new_root].children.push_back(node);
+			nodes[new_root].children.push_back(sibling);
+			root=new_root;
+		} else
+			nodes[path[i-1]].children.push_back(sibling);
+	}
+}
+
+int RTree::split(int node) {
+
+	vector<int> children;
+	children.swap(nodes[node].children);
+	bool leaf=nodes[node].leaf;
+	int nb=children.size();
+	int n=nodes[node].box.size();
+	const IntervalVector& bounds=nodes[node].box;
+
+	// ======== pick seeds (linear) ==========
+	// the pair of children with the greatest normalized separation
+	int seed1=0, seed2=1;
+	double best_sep=NEG_INFINITY;
+	for (int i=0; i<n; i++) {
+		int highest_lb=0, lowest_ub=0;
+		for (int k=1; k<nb; k++) {
+			const IntervalVector& b=leaf? entries[children[k]] : nodes[children[k]].box;
+			const IntervalVector& h=leaf? entries[children[highest_lb]] : nodes[children[highest_lb]].box;
+			const IntervalVector& l=leaf? entries[children[lowest_ub]] : nodes[children[lowest_ub]].box;
+			if (b[i].lb()>h[i].lb()) highest_lb=k;
+			if (b[i].ub()<l[i].ub()) lowest_ub=k;
+		}
+		if (highest_lb==lowest_ub) continue;
+		const IntervalVector& h=leaf? entries[children[highest_lb]] : nodes[children[highest_lb]].box;
+		const IntervalVector& l=leaf? entries[children[lowest_ub]] : nodes[children[lowest_ub]].box;
+		double w=bounds[i].diam();
+		double sep=(h[i].lb()-l[i].ub()) / (w>0 && w<POS_INFINITY? w : 1.0);
+		if (sep>best_sep) {
+			best_sep=sep;
+			seed1=lowest_ub;
+			seed2=highest_lb;
+		}
+	}
+
+	// ======== distribute the children ==========
+	int sibling=nodes.size();
+	{
+		const IntervalVector& b1=leaf? entries[children[seed1]] : nodes[children[seed1]].box;
+		const IntervalVector& b2=leaf? entries[children[seed2]] : nodes[children[seed2]].box;
+		nodes[node].box=b1;
+		Node s(b2,leaf); // note: b2 may be invalidated by push_back
+		nodes.push_back(s);
+	}
+	Node& g1=nodes[node];
+	Node& g2=nodes[sibling];
+	g1.children.push_back(children[seed1]);
+	g2.children.push_back(children[seed2]);
+
+	int remaining=nb-2;
+	for (int k=0; k<nb; k++) {
+		if (k==seed1 || k==seed2) continue;
+		const IntervalVector& b=leaf? entries[children[k]] : nodes[children[k]].box;
+
+		Node* g;
+		if ((int) g1.children.size()+remaining==min_entries)
+			g=&g1;
+		else if ((int) g2.children.size()+remaining==min_entries)
+			g=&g2;
+		else {
+			double e1=enlargement(g1.box,b);
+			double e2=enlargement(g2.box,b);
+			if (e1<e2) g=&g1;
+			else if (e2<e1) g=&g2;
+			else if (g1.box.perimeter()<g2.box.perimeter()) g=&g1;
+			else if (g2.box.perimeter()<g1.box.perimeter()) g=&g2;
+			else g=g1.children.size()<=g2.children.size()? &g1 : &g2;
+		}
+		g->children.push_back(children[k]);
+		g->box |= b;
+		remaining--;
+	}
+
+	return sibling;
+}
+
+int RTree::find_superset(const IntervalVector& box) const {
+	if (root==-1) return -1;
+
+	vector<int> stack;
+	stack.push_back(root);
+
+	while (!stack.empty()) {
+		const Node& n=nodes[stack.back()];
+		stack.pop_back();
+
+		if (!n.box.is_superset(box)) continue;
+
+		if (n.leaf) {
+			for (vector<int>::const_iterator e=n.children.begin(); e!=n.children.end(); ++e)
+				if (entries[*e].is_superset(box)) return ids[*e];
+		} else
+			stack.insert(stack.end(), n.children.begin(), n.children.end());
+	}
+
+	return -1;
+}
+
+} // namespace ibex
@@ -0,0 +1,124 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_RTree.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_RTREE_H__
+#define __IBEX_RTREE_H__
+
+#include "ibex_IntervalVector.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief R-tree of boxes.
+ *
+ * A spatial index over a set of boxes, each box being associated
+ * to an identifier. Boxes are grouped in a balanced tree of bounding
+ * boxes (Guttman's R-tree, with linear split) so that the boxes
+ * containing a given box can be found without a linear scan.
+ *
+ * Since boxes in high dimension have (very) small or large volumes,
+ * the size of a bounding box is measured by its perimeter instead of
+ * its volume.
+ *
+ * The structure can be copied.
+ */
+class RTree {
+public:
+	/**
+	 * \brief Create an empty tree.
+	 *
+	 * \param max_entries - maximal number of children of a node (>=2).
+	 */
+	RTree(int max_entries=default_max_entries);
+
+	/**
+	 * \brief Add a box with identifier \a id.
+	 *
+	 * The box is copied.
+	 */
+	void insert(const IntervalVector& box, int id);
+
+	/**
+	 * \brief Find a box containing \a box.
+	 *
+	 * \return the identifier of such box or -1 if there is none.
+	 */
+	int find_superset(const IntervalVector& box) const;
+
+	/**
+	 * \brief Number of boxes.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Remove all the boxes.
+	 */
+	void clear();
+
+	/**
+	 * \brief Default maximal number of children of a node: 8.
+	 */
+	static const int default_max_entries;
+
+protected:
+
+	/* A node of the tree. */
+	struct Node {
+		Node(const IntervalVector& box, bool leaf);
+
+		/** The bounding box. */
+		IntervalVector box;
+
+		/** Whether the children are boxes (entries) or nodes. */
+		bool leaf;
+
+		/** Indices of the children (in #nodes or #entries). */
+		std::vector<int> children;
+	};
+
+	/* Box of the kth child of a node. */
+	const IntervalVector& child_box(const Node& node, int k) const;
+
+	/* Split an overflowing node and return the index of the new node. */
+	int split(int node);
+
+	/** Maximal and minimal number of children of a node. */
+	int max_entries, min_entries;
+
+	/** All the nodes. */
+	std::vector<Node> nodes;
+
+	/** The root node (-1 if the tree is empty). */
+	int root;
+
+	/** All the boxes (entries) and their identifiers. */
+	std::vector<IntervalVector> entries;
+	std::vector<int> ids;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline RTree::Node::Node(const IntervalVector& box, bool leaf) : box(box), leaf(leaf) {
+
+}
+
+inline const IntervalVector& RTree::child_box(const Node& node, int k) const {
+	return node.leaf? entries[node.children[k]] : nodes[node.children[k]].box;
+}
+
+inline int RTree::size() const {
+	return (int) entries.size();
+}
+
+} // namespace ibex
+
+#endif // __IBEX_RTREE_H__
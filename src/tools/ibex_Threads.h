@@ -0,0 +1,535 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Threads.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_THREADS_H__
+#define __IBEX_THREADS_H__
+
+#include <functional>
+#include <stack>
+#include <queue>
+
+#ifndef _WIN32 // MinGW does not support mutex
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <vector>
+#include <cfenv>
+#endif
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Mutex.
+ *
+ * Does nothing on platforms without thread support (all the
+ * algorithms are then run by a single thread).
+ */
+class Mutex {
+public:
+	void lock();
+	void unlock();
+
+#ifndef _WIN32
+	std::mutex m;
+#endif
+};
+
+/**
+ * \ingroup tools
+ * \brief Lock a mutex until the end of the scope.
+ */
+class Lock {
+public:
+	Lock(Mutex& mutex);
+	~Lock();
+protected:
+	Mutex& mutex;
+};
+
+/**
+ * \ingroup tools
+ * \brief Stack shared by several workers.
+ *
+ * Each worker repeatedly pops an item, processes it (possibly
+ * pushing new items) and calls done(). The pop() function blocks
+ * until an item is available and returns false when the work is
+ * over, i.e., when the stack is empty and no other worker is processing
+ * an item (so that no new item can appear), or stop() has been called.
+ *
+ * With a single worker, items are processed exactly in the same
+ * order as with a std::stack.
+ */
+template<class T>
+class WorkStack {
+public:
+	/**
+	 * \brief Create an empty stack.
+	 */
+	WorkStack();
+
+	/**
+	 * \brief Push an item.
+	 */
+	void push(const T& item);
+
+	/**
+	 * \brief Pop an item.
+	 *
+	 * \return false if the work is over.
+	 */
+	bool pop(T& item);
+
+	/**
+	 * \brief Signal that the item popped by the caller has been processed.
+	 */
+	void done();
+
+	/**
+	 * \brief Stop all the workers and remove all the items.
+	 */
+	void stop();
+
+	/**
+	 * \brief True if stop() has been called.
+	 */
+	bool stopped();
+
+	/**
+	 * \brief Remove all the items and reset the stack (not thread-safe).
+	 */
+	void clear();
+
+protected:
+	Mutex mutex;
+#ifndef _WIN32
+	std::condition_variable_any cond;
+#endif
+	std::stack<T> items;
+	int busy;
+	bool _stopped;
+};
+
+/**
+ * \ingroup tools
+ * \brief FIFO queue shared by producer and consumer threads.
+ *
+ * On platforms without thread support, pop() does not block
+ * (it returns false if the queue is empty).
+ */
+template<class T>
+class SharedQueue {
+public:
+	/**
+	 * \brief Create an empty queue.
+	 */
+	SharedQueue();
+
+	/**
+	 * \brief Push an item (ignored if the queue is closed).
+	 */
+	void push(const T& item);
+
+	/**
+	 * \brief Pop an item.
+	 *
+	 * Blocks until an item is available.
+	 *
+	 * \return false if the queue is empty and closed.
+	 */
+	bool pop(T& item);
+
+	/**
+	 * \brief Pop an item, if any (does not block).
+	 *
+	 * \return false if the queue is empty.
+	 */
+	bool try_pop(T& item);
+
+	/**
+	 * \brief Close the queue (wakes up all the consumers).
+	 */
+	void close();
+
+protected:
+	Mutex mutex;
+#ifndef _WIN32
+	std::condition_variable_any cond;
+#endif
+	std::queue<T> items;
+	bool closed;
+};
+
+/**
+ * \ingroup tools
+ * \brief Run a function by n workers in parallel.
+ *
+ * The function is called with the worker number w (0<=w<n).
+ * Worker 0 is the calling thread. All the workers start with the
+ * floating-point environment of the calling thread (in particular,
+ * the rounding mode expected by the interval library).
+ *
+ * If a worker throws an exception, the first one is rethrown once
+ * all the workers are terminated.
+ *
+ * On platforms without thread support, the workers are run
+ * sequentially.
+ */
+void run_threads(int n, const std::function<void(int)>& f);
+
+/**
+ * \ingroup tools
+ * \brief Workers kept alive between parallel runs.
+ *
+ * Same as #run_threads(int,const std::function<void(int)>&) except
+ * that the n-1 threads are created once (by the constructor) and
+ * reused by every call to #run(const std::function<void(int)>&).
+ * Between two runs, the threads wait on a condition variable.
+ *
+ * A pool is not reentrant: run(...) must only be called by one
+ * thread at a time, and not by a worker.
+ */
+class WorkerPool {
+public:
+	/**
+	 * \brief Create a pool of n workers (including the calling thread).
+	 */
+	WorkerPool(int n);
+
+	/**
+	 * \brief Terminate the threads.
+	 */
+	~WorkerPool();
+
+	/**
+	 * \brief Number of workers.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Run a function by all the workers in parallel.
+	 *
+	 * \see #run_threads(int,const std::function<void(int)>&).
+	 */
+	void run(const std::function<void(int)>& f);
+
+protected:
+	WorkerPool(const WorkerPool&);            // forbidden
+	WorkerPool& operator=(const WorkerPool&); // forbidden
+
+	const int n;
+
+#ifndef _WIN32
+	/*
+	 * Loop of the worker w>0.
+	 */
+	void work(int w);
+
+	Mutex mutex;
+	std::condition_variable_any cond;
+	std::vector<std::thread> threads;
+	const std::function<void(int)>* task; // function of the current run
+	std::fenv_t env;                      // floating-point environment of the caller
+	std::exception_ptr error;             // first exception of the current run
+	unsigned long round;                  // number of runs started
+	int pending;                          // number of threads still running the current task
+	bool over;                            // set by the destructor
+#endif
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void Mutex::lock() {
+#ifndef _WIN32
+	m.lock();
+#endif
+}
+
+inline void Mutex::unlock() {
+#ifndef _WIN32
+	m.unlock();
+#endif
+}
+
+inline Lock::Lock(Mutex& mutex) : mutex(mutex) {
+	mutex.lock();
+}
+
+inline Lock::~Lock() {
+	mutex.unlock();
+}
+
+template<class T>
+WorkStack<T>::WorkStack() : busy(0), _stopped(false) {
+
+}
+
+template<class T>
+void WorkStack<T>::push(const T& item) {
+	{
+		Lock lock(mutex);
+		if (_stopped) return;
+		items.push(item);
+	}
+#ifndef _WIN32
+	cond.notify_one();
+#endif
+}
+
+template<class T>
+bool WorkStack<T>::pop(T& item) {
+#ifndef _WIN32
+	std::unique_lock<std::mutex> lock(mutex.m);
+	cond.wait(lock, [this] { return _stopped || !items.empty() || busy==0; });
+#else
+	Lock lock(mutex);
+#endif
+	if (_stopped || items.empty()) {
+#ifndef _WIN32
+		cond.notify_all(); // the work is over
+#endif
+		return false;
+	}
+	item=items.top();
+	items.pop();
+	busy++;
+	return true;
+}
+
+template<class T>
+void WorkStack<T>::done() {
+	bool over;
+	{
+		Lock lock(mutex);
+		busy--;
+		over = busy==0 && items.empty();
+	}
+#ifndef _WIN32
+	if (over) cond.notify_all();
+#endif
+}
+
+template<class T>
+void WorkStack<T>::stop() {
+	{
+		Lock lock(mutex);
+		_stopped=true;
+		while (!items.empty()) items.pop();
+	}
+#ifndef _WIN32
+	cond.notify_all();
+#endif
+}
+
+template<class T>
+bool WorkStack<T>::stopped() {
+	Lock lock(mutex);
+	return _stopped;
+}
+
+template<class T>
+void WorkStack<T>::clear() {
+	while (!items.empty()) items.pop();
+	busy=0;
+	_stopped=false;
+}
+
+template<class T>
+SharedQueue<T>::SharedQueue() : closed(false) {
+
+}
+
+template<class T>
+void SharedQueue<T>::push(const T& item) {
+	{
+		Lock lock(mutex);
+		if (closed) return;
+		items.push(item);
+	}
+#ifndef _WIN32
+	cond.notify_one();
+#endif
+}
+
+template<class T>
+bool SharedQueue<T>::pop(T& item) {
+#ifndef _WIN32
+	std::unique_lock<std::mutex> lock(mutex.m);
+	cond.wait(lock, [this] { return closed || !items.empty(); });
+#else
+	Lock lock(mutex);
+#endif
+	if (items.empty()) return false;
+	item=items.front();
+	items.pop();
+	return true;
+}
+
+template<class T>
+bool SharedQueue<T>::try_pop(T& item) {
+	Lock lock(mutex);
+	if (items.empty()) return false;
+	item=items.front();
+	items.pop();
+	return true;
+}
+
+template<class T>
+void SharedQueue<T>::close() {
+	{
+		Lock lock(mutex);
+		closed=true;
+	}
+#ifndef _WIN32
+	cond.notify_all();
+#endif
+}
+
+inline void run_threads(int n, const std::function<void(int)>& f) {
+#ifndef _WIN32
+	if (n<=1) {
+		f(0);
+		return;
+	}
+
+	std::fenv_t env;
+	std::fegetenv(&env);
+
+	std::exception_ptr error;
+	Mutex error_mutex;
+
+	std::function<void(int)> worker = [&](int w) {
+		if (w>0) std::fesetenv(&env);
+		try {
+			f(w);
+		} catch(...) {
+			Lock lock(error_mutex);
+			if (!error) error=std::current_exception();
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (int w=1; w<n; w++)
+		threads.push_back(std::thread(worker,w));
+
+	worker(0);
+
+	for (std::vector<std::thread>::iterator it=threads.begin(); it!=threads.end(); ++it)
+		it->join();
+
+	if (error) std::rethrow_exception(error);
+#else
+	for (int w=0; w<n; w++)
+		f(w);
+#endif
+}
+
+inline WorkerPool::WorkerPool(int n) : n(n<1 ? 1 : n)
+#ifndef _WIN32
+		, task(NULL), round(0), pending(0), over(false)
+#endif
+{
+#ifndef _WIN32
+	for (int w=1; w<this->n; w++)
+		threads.push_back(std::thread(&WorkerPool::work, this, w));
+#endif
+}
+
+inline WorkerPool::~WorkerPool() {
+#ifndef _WIN32
+	{
+		Lock lock(mutex);
+		over=true;
+	}
+	cond.notify_all();
+
+	for (std::vector<std::thread>::iterator it=threads.begin(); it!=threads.end(); ++it)
+		it->join();
+#endif
+}
+
+inline int WorkerPool::size() const {
+	return n;
+}
+
+#ifndef _WIN32
+inline void WorkerPool::work(int w) {
+	unsigned long done=0; // number of runs performed by this worker
+
+	while (true) {
+		const std::function<void(int)>* f;
+		{
+			std::unique_lock<std::mutex> lock(mutex.m);
+			cond.wait(lock, [&] { return over || round!=done; });
+			if (over) return;
+			done=round;
+			f=task;
+		}
+
+		std::fesetenv(&env);
+		try {
+			(*f)(w);
+		} catch(...) {
+			Lock lock(mutex);
+			if (!error) error=std::current_exception();
+		}
+
+		bool last;
+		{
+			Lock lock(mutex);
+			last = --pending==0;
+		}
+		if (last) cond.notify_all();
+	}
+}
+#endif
+
+inline void WorkerPool::run(const std::function<void(int)>& f) {
+#ifndef _WIN32
+	if (n==1) {
+		f(0);
+		return;
+	}
+
+	{
+		Lock lock(mutex);
+		std::fegetenv(&env);
+		task=&f;
+		error=nullptr;
+		pending=n-1;
+		round++;
+	}
+	cond.notify_all();
+
+	try {
+		f(0);
+	} catch(...) {
+		Lock lock(mutex);
+		if (!error) error=std::current_exception();
+	}
+
+	std::exception_ptr e;
+	{
+		std::unique_lock<std::mutex> lock(mutex.m);
+		cond.wait(lock, [this] { return pending==0; });
+		e=error;
+		task=NULL;
+	}
+
+	if (e) std::rethrow_exception(e);
+#else
+	for (int w=0; w<n; w++)
+		f(w);
+#endif
+}
+
+} // namespace ibex
+
+#endif // __IBEX_THREADS_H__
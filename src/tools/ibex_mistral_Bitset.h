@@ -95,8 +95,22 @@ public:
 	int neg_words;
 	/// A vector of bits
 	WORD_TYPE* table;
+	/// Storage of the vector of bits for small sets (one word), to avoid heap allocation (ibex)
+	WORD_TYPE local;
 	//@}
 
+	/// Allocate a vector of words (the local word if only one is required)
+	inline WORD_TYPE* alloc(const int nb_words)
+	{
+		return nb_words<=1 ? &local : new WORD_TYPE[nb_words];
+	}
+	/// Release the vector of words
+	inline void release()
+	{
+		WORD_TYPE* t = table+neg_words;
+		if(t != &local) delete [] t;
+	}
+
 	Bitset()
 	{
 		initialise();
@@ -179,8 +193,7 @@ public:
 	}
 	void reinitialise(const int lb, const int ub, const WORD_TYPE p)
 	{
-		table += neg_words;
-		delete [] table;
+		release();
 		initialise(lb, ub, p, NULL);
 	}
 	void initialise(const int sz, const WORD_TYPE p)
@@ -188,7 +201,7 @@ public:
 		pos_words = sz;
 		neg_words = 0;
 		if( sz>=0 ) {
-			table = new WORD_TYPE[pos_words];
+			table = alloc(pos_words);
 			for(int i=0; i<pos_words; ++i)
 				table[i]=p;
 		} else table = NULL;
@@ -197,7 +210,7 @@ public:
 	{
 		neg_words = (lb >> EXP);
 		pos_words = (ub >> EXP)+1;
-		if(pool==NULL) table = new WORD_TYPE[pos_words-neg_words];
+		if(pool==NULL) table = alloc(pos_words-neg_words);
 		else table = pool;
 		for(int i=0; i<pos_words-neg_words; ++i)
 			table[i]=p;
@@ -210,7 +223,7 @@ public:
 	{
 		pos_words = s.pos_words;
 		neg_words = s.neg_words;
-		table = new WORD_TYPE[pos_words-neg_words];
+		table = alloc(pos_words-neg_words);
 		table -= neg_words;
 		for(int i=neg_words; i<pos_words; ++i)
 			//table[i].initialise(s.table+i, s.size(i));
@@ -247,7 +260,7 @@ public:
 			}
 			if(need_to_extend) {
 				WORD_TYPE *aux = table;
-				table = new WORD_TYPE[new_pos_words-new_neg_words];
+				table = alloc(new_pos_words-new_neg_words);
 				table -= new_neg_words;
 				memcpy(table+neg_words, aux+neg_words,
 						(pos_words-neg_words)*sizeof(WORD_TYPE));
@@ -256,7 +269,7 @@ public:
 				if(new_pos_words > pos_words)
 					std::fill(table+pos_words, table+new_pos_words, 0);
 				aux += neg_words;
-				delete [] aux;
+				if(aux != &local) delete [] aux;
 				pos_words = new_pos_words;
 				neg_words = new_neg_words;
 			}
@@ -269,13 +282,10 @@ public:
 	}
 	void clone(const Bitset<WORD_TYPE,FLOAT_TYPE>& s)
 	{
-		if(table) {
-			table += neg_words;
-			delete [] table;
-		}
+		if(table) release();
 		neg_words = s.neg_words;
 		pos_words = s.pos_words;
-		table = new WORD_TYPE[pos_words-neg_words];
+		table = alloc(pos_words-neg_words);
 		memcpy(table, s.table+neg_words,
 				size_word_byte*(pos_words-neg_words));
 		table -= neg_words;
@@ -305,14 +315,12 @@ public:
 	}
 	virtual ~Bitset()
 	{
-		table += neg_words;
-		delete [] table;
+		release();
 	}
 	void destroy()
 	{
-		table += neg_words;
+		release();
 		neg_words = 0;
-		delete [] table;
 		table = NULL;
 	}
 	bool is_built()
@@ -324,6 +332,12 @@ public:
 		WORD_TYPE *aux = s.table;
 		s.table = table;
 		table = aux;
+		// the local words are swapped as well
+		WORD_TYPE w = s.local;
+		s.local = local;
+		local = w;
+		if(s.table+s.neg_words == &local) s.table = &s.local-s.neg_words;
+		if(table+neg_words == &s.local) table = &local-neg_words;
 	}
 	void iterate_into_b(const int size, int *buffer) {
 		int elt;
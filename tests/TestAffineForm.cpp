@@ -0,0 +1,119 @@
+//============================================================================
+//                                  I B E X
+// File        : TestAffineForm.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "TestAffineForm.h"
+#include "ibex_Function.h"
+#include "ibex_AffineFormEval.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Check that the form encloses f(t) for sample points t of x.
+ */
+bool encloses(const AffineForm& z, const Interval& x, double (*f)(double)) {
+	for (int i=0; i<=10; i++) {
+		double t=x.lb()+i*x.diam()/10;
+		if (!z.itv().contains(f(t)) || !z.range().contains(f(t))) return false;
+	}
+	return true;
+}
+
+double cube(double t) { return t*t*t; }
+double inverse(double t) { return 1/t; }
+
+}
+
+void TestAffineForm::sub01() {
+	AffineForm x(Interval(1,3),0);
+	AffineForm z=x-x;
+	CPPUNIT_ASSERT(z.is_affine());
+	CPPUNIT_ASSERT(z.nb_terms()==0);
+	check(z.itv(),Interval::zero());
+}
+
+void TestAffineForm::mul01() {
+	// x*(1-x) with x in [0,1] (interval arithmetic gives [0,1])
+	AffineForm x(Interval(0,1),0);
+	AffineForm z=x*(AffineForm(Interval::one())-x);
+	CPPUNIT_ASSERT(z.itv().is_subset(Interval(0,1)));
+	CPPUNIT_ASSERT(z.itv().ub()<=0.5+ERROR);
+	CPPUNIT_ASSERT(z.itv().contains(0.25));
+}
+
+void TestAffineForm::sqr01() {
+	// x^2-x with x in [0,1] (the exact range is [-0.25,0])
+	AffineForm x(Interval(0,1),0);
+	AffineForm z=sqr(x)-x;
+	check(z.itv(),Interval(-0.25,0));
+}
+
+void TestAffineForm::nonlinear01() {
+	Interval x(1,2);
+	AffineForm a(x,0);
+	CPPUNIT_ASSERT(encloses(exp(a),x,::exp));
+	CPPUNIT_ASSERT(encloses(log(a),x,::log));
+	CPPUNIT_ASSERT(encloses(sqrt(a),x,::sqrt));
+	CPPUNIT_ASSERT(encloses(inv(a),x,inverse));
+	CPPUNIT_ASSERT(encloses(pow(a,3),x,cube));
+
+	// exp(x)-x is tighter than with interval arithmetic
+	AffineForm z=exp(a)-a;
+	CPPUNIT_ASSERT(z.itv().is_strict_subset(exp(x)-x));
+}
+
+void TestAffineForm::condense01() {
+	AffineForm z=AffineForm(Interval(0,1),0)+AffineForm(Interval(0,2),1)+AffineForm(Interval(0,4),2);
+	CPPUNIT_ASSERT(z.nb_terms()==3);
+	Interval r=z.range();
+	z.condense(1);
+	CPPUNIT_ASSERT(z.nb_terms()==1);
+	CPPUNIT_ASSERT(z.symbol(0)==2);
+	CPPUNIT_ASSERT(r.is_subset(z.range()));
+	check(z.range(),r);
+}
+
+void TestAffineForm::unbounded01() {
+	AffineForm x(Interval::pos_reals(),0);
+	CPPUNIT_ASSERT(!x.is_affine());
+	AffineForm z=x+AffineForm(Interval(1,2),1);
+	CPPUNIT_ASSERT(!z.is_affine());
+	CPPUNIT_ASSERT(z.itv()==Interval(1,POS_INFINITY));
+}
+
+void TestAffineForm::eval01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,sqr(x)-x*y+sqr(y)-x);
+
+	IntervalVector box(2,Interval(0,1));
+	Interval itv=f.eval(box);
+
+	AffineFormEval e(f.basic_evaluator());
+	Interval z=e.eval(box).i();
+	CPPUNIT_ASSERT(z.is_strict_subset(itv));
+	CPPUNIT_ASSERT(z.is_subset(e.form().range()));
+	// f(1/3,2/3)=-1/3
+	CPPUNIT_ASSERT(z.contains(-1.0/3));
+}
+
+void TestAffineForm::eval02() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(2));
+	Function f(x,Return(x[0]*x[1]-x[1]*x[0],x[0]+x[1]-x[0]));
+
+	AffineFormEval e(f.basic_evaluator());
+	IntervalVector z=e.eval(IntervalVector(2,Interval(1,2))).v();
+	CPPUNIT_ASSERT(z[0].is_strict_subset(Interval(-3,3)));
+	CPPUNIT_ASSERT(z[0].contains(0));
+	check(z[1],Interval(1,2));
+}
+
+} // namespace ibex
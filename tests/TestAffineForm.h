@@ -0,0 +1,47 @@
+//============================================================================
+//                                  I B E X
+// File        : TestAffineForm.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __TEST_AFFINE_FORM_H__
+#define __TEST_AFFINE_FORM_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestAffineForm : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestAffineForm);
+	CPPUNIT_TEST(sub01);
+	CPPUNIT_TEST(mul01);
+	CPPUNIT_TEST(sqr01);
+	CPPUNIT_TEST(nonlinear01);
+	CPPUNIT_TEST(condense01);
+	CPPUNIT_TEST(unbounded01);
+	CPPUNIT_TEST(eval01);
+	CPPUNIT_TEST(eval02);
+	CPPUNIT_TEST_SUITE_END();
+
+	void sub01();
+	void mul01();
+	void sqr01();
+	void nonlinear01();
+	void condense01();
+	void unbounded01();
+	void eval01();
+	void eval02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestAffineForm);
+
+} // namespace ibex
+
+#endif // __TEST_AFFINE_FORM_H__
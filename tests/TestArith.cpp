@@ -234,6 +234,8 @@ void TestArith::sinh04() { check_sinh(Interval(1,POS_INFINITY)); }
 void TestArith::sinh05() { check_sinh(Interval(1,1)); }
 void TestArith::sinh06() { check_sinh(Interval(2,3)); }
 void TestArith::sinh07() { check_sinh(Interval(4,5)); }
+// sinh(710)~1.117e308 does not overflow
+void TestArith::sinh08() { CPPUNIT_ASSERT(sinh(Interval(710)).lb()<1.12e308 && sinh(Interval(-710)).ub()>-1.12e308); }
 
 
 void TestArith::check_cosh(const Interval& x) {
@@ -269,6 +271,8 @@ void TestArith::cosh04() { check_cosh(Interval(1,POS_INFINITY)); }
 void TestArith::cosh05() { check_cosh(Interval(1,1)); }
 void TestArith::cosh06() { check_cosh(Interval(2,3)); }
 void TestArith::cosh07() { check_cosh(Interval(4,5)); }
+// cosh(710)~1.117e308 does not overflow
+void TestArith::cosh08() { CPPUNIT_ASSERT(cosh(Interval(710)).lb()<1.12e308 && cosh(Interval(-710)).lb()<1.12e308); }
 
 
 void TestArith::check_trigo(const Interval& x, const Interval& sin_x_expected) {
@@ -293,6 +297,7 @@ void TestArith::log08() { check(log(Interval(0,1)),       Interval(NEG_INFINITY,
 void TestArith::log09() { check(log(Interval(1,POS_INFINITY)), Interval::pos_reals()); }
 void TestArith::log10() { check(log(Interval(0)), Interval::empty_set()); /* Interval(NEG_INFINITY,-DBL_MAX)); */ }
 void TestArith::log11() { check(log(Interval(-2,-1)), Interval::empty_set()); }
+void TestArith::log12() { CPPUNIT_ASSERT((log(Interval(0,1e-320))).ub()> -736.9); }
 
 void TestArith::exp01() { check(exp(Interval::empty_set()), Interval::empty_set()); }
 void TestArith::exp02() { check(exp(Interval::all_reals()), Interval::pos_reals()); }
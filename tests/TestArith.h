@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Dec 07, 2011
- * Last Update : Oct 29, 2019
+ * Last Update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __TEST_ARITH_H__
@@ -129,6 +129,7 @@ public:
 	CPPUNIT_TEST(log09);
 	CPPUNIT_TEST(log10);
 	CPPUNIT_TEST(log11);
+	CPPUNIT_TEST(log12);
 
 	CPPUNIT_TEST(exp01);
 	CPPUNIT_TEST(exp02);
@@ -192,6 +193,7 @@ public:
 	CPPUNIT_TEST(sinh05);
 	CPPUNIT_TEST(sinh06);
 	CPPUNIT_TEST(sinh07);
+	CPPUNIT_TEST(sinh08);
 
 	CPPUNIT_TEST(cosh01);
 	CPPUNIT_TEST(cosh02);
@@ -200,6 +202,7 @@ public:
 	CPPUNIT_TEST(cosh05);
 	CPPUNIT_TEST(cosh06);
 	CPPUNIT_TEST(cosh07);
+	CPPUNIT_TEST(cosh08);
 
 	CPPUNIT_TEST(atan2_01);
 	CPPUNIT_TEST(atan2_02);
@@ -554,6 +557,7 @@ private:
 	void log09();
 	void log10();
 	void log11();
+	void log12();
 
 	void exp01();
 	void exp02();
@@ -625,6 +629,7 @@ private:
 	void sinh05();
 	void sinh06();
 	void sinh07();
+	void sinh08();
 
 	void cosh01();
 	void cosh02();
@@ -633,6 +638,7 @@ private:
 	void cosh05();
 	void cosh06();
 	void cosh07();
+	void cosh08();
 
 	void atan2_01();
 	void atan2_02();
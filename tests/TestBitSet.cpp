@@ -108,6 +108,22 @@ void TestBitSet::inter01() {
 	CPPUNIT_ASSERT(b==BitSet::singleton(1,7));
 }
 
+// from a small set (local storage) to a large one
+void TestBitSet::resize_large() {
+	BitSet b(BitSet::singleton(10,3));
+	b.resize(200);
+	b.add(150);
+	CPPUNIT_ASSERT(b.size()==2);
+	CPPUNIT_ASSERT(b[3] && b[150]);
+	BitSet c(b);
+	c.remove(3);
+	CPPUNIT_ASSERT(b[3] && c.size()==1 && c[150]);
+	BitSet d(BitSet::all(10));
+	d.resize(100);
+	d|=c;
+	CPPUNIT_ASSERT(d.size()==11);
+}
+
 void TestBitSet::union01() {
 	BitSet b(bitset1);
 	b|=bitset2;
@@ -30,6 +30,7 @@ public:
 	CPPUNIT_TEST(size01);
 	CPPUNIT_TEST(size02);
 	CPPUNIT_TEST(resize);
+	CPPUNIT_TEST(resize_large);
 	CPPUNIT_TEST(union01);
 	CPPUNIT_TEST(union02);
 	CPPUNIT_TEST(union03); // check union resizes if necessary
@@ -51,6 +52,7 @@ private:
 	void size01();
 	void size02();
 	void resize();
+	void resize_large();
 	void inter01();
 	void union01();
 	void union02();
@@ -236,6 +236,40 @@ void TestBxpSystemCache::is_inner() {
 	CPPUNIT_ASSERT(!cache.is_inner());
 }
 
+void TestBxpSystemCache::copy() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_ctr(x<=0);
+	fac.add_ctr(x+1.5<=0);
+	fac.add_ctr(x+2.5<=0);
+	fac.add_ctr(x+3.5<=0);
+	System sys(fac);
+
+	BxpSystemCache cache(sys,0.1);
+	IntervalVector box(sys.nb_var);
+	BoxProperties prop(box);
+
+	box[0]=Interval(-102,-2);
+	cache.update(BoxEvent(box,BoxEvent::CONTRACT),prop);
+
+	BxpSystemCache* c=cache.copy(box,prop);
+	BitSet b=c->active_ctrs();
+	CPPUNIT_ASSERT(b.size()==2);
+	CPPUNIT_ASSERT(b[2] && b[3]);
+
+	box[0]=Interval(-101,-2); // should not recalc
+	c->update(BoxEvent(box,BoxEvent::CONTRACT),prop);
+	b=c->active_ctrs();
+	CPPUNIT_ASSERT(b.size()==2);
+
+	box[0]=Interval(-104,-4); // the original is unchanged
+	c->update(BoxEvent(box,BoxEvent::CHANGE),prop);
+	CPPUNIT_ASSERT(c->active_ctrs().empty());
+	CPPUNIT_ASSERT(cache.active_ctrs().size()==2);
+	delete c;
+}
+
 void TestBxpSystemCache::active_ctrs_eval() {
 	const ExprSymbol& x=ExprSymbol::new_();
 	SystemFactory fac;
@@ -30,6 +30,7 @@ public:
 	CPPUNIT_TEST(ctrs_jacobian);
 	CPPUNIT_TEST(active_ctrs);
 	CPPUNIT_TEST(is_inner);
+	CPPUNIT_TEST(copy);
 	CPPUNIT_TEST(active_ctrs_eval);
 	CPPUNIT_TEST(active_ctrs_jacobian);
 	CPPUNIT_TEST_SUITE_END();
@@ -40,6 +41,7 @@ public:
 	void ctrs_jacobian();
 	void active_ctrs();
 	void is_inner();
+	void copy();
 	void active_ctrs_eval();
 	void active_ctrs_jacobian();
 
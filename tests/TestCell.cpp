@@ -5,7 +5,7 @@
 // Copyright   : ENSTA Bretagne (France)
 // License     : See the LICENSE file
 // Created     : Oct 10, 2016
-// Last Update : Oct 10, 2016
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "TestCell.h"
@@ -16,12 +16,71 @@
 #include "ibex_SystemFactory.h"
 #include "ibex_NormalizedSystem.h"
 #include "ibex_Cell.h"
+#include "ibex_CompactCell.h"
+#include "ibex_CellStack.h"
+#include "ibex_CellList.h"
+#include "ibex_BxpPrecond.h"
+#include "ibex_BxpActiveCtr.h"
 
 //using namespace std;
 
 namespace ibex {
 
 long BxpTest::id = next_id();
+long BxpTestShared::id = next_id();
+int BxpTestShared::nb_copies = 0;
+
+namespace {
+
+/*
+ * Run the same search with two buffers and check that
+ * the cells are popped in the same order, with the same data.
+ */
+void compare_buffers(CellBuffer& plain, CellBuffer& compact) {
+	int n=40;
+	IntervalVector box(n, Interval(-1,1));
+	LargestFirst bsc;
+
+	plain.push(new Cell(box));
+	compact.push(new Cell(box));
+
+	int nb_cells=0;
+
+	while (!plain.empty()) {
+		CPPUNIT_ASSERT(plain.size()==compact.size());
+
+		Cell* c1=plain.top();
+		Cell* c2=compact.top();
+		CPPUNIT_ASSERT(c2==compact.top());
+		CPPUNIT_ASSERT(c1->box==c2->box);
+		CPPUNIT_ASSERT(c1->depth==c2->depth);
+		CPPUNIT_ASSERT(c1->bisected_var==c2->bisected_var);
+
+		CPPUNIT_ASSERT(plain.pop()==c1);
+		CPPUNIT_ASSERT(compact.pop()==c2);
+		nb_cells++;
+
+		// emulates a contraction
+		int i=(7*nb_cells)%n;
+		c1->box[i]=Interval(c1->box[i].lb(),c1->box[i].mid());
+		c2->box[i]=Interval(c2->box[i].lb(),c2->box[i].mid());
+
+		if (c1->depth<8) {
+			std::pair<Cell*,Cell*> p1=bsc.bisect(*c1);
+			std::pair<Cell*,Cell*> p2=bsc.bisect(*c2);
+			plain.push(p1.first);
+			plain.push(p1.second);
+			compact.push(p2.first);
+			compact.push(p2.second);
+		}
+		delete c1;
+		delete c2;
+	}
+	CPPUNIT_ASSERT(compact.empty());
+	CPPUNIT_ASSERT(nb_cells==511);
+}
+
+}
 
 void TestCell::test01() {
 	IntervalVector box (2, Interval(-1,1));
@@ -117,7 +176,180 @@ void TestCell::test02() {
 }
 
 
-} // end namespace
+void TestCell::copy_on_write() {
+	IntervalVector box(2, Interval(-1,1));
+	Cell* root = new Cell(box);
+	root->prop.add(new BxpTestShared());
+	BxpTestShared::nb_copies=0;
+
+	LargestFirst bsc;
+	std::pair<Cell*, Cell*> new_cells = bsc.bisect(*root);
+	const Cell* c1 = new_cells.first;
+	const Cell* c2 = new_cells.second;
+
+	// the value is shared
+	CPPUNIT_ASSERT(BxpTestShared::nb_copies==0);
+	CPPUNIT_ASSERT(c1->prop[BxpTestShared::id]==c2->prop[BxpTestShared::id]);
+
+	delete root;
+	CPPUNIT_ASSERT(((const BxpTestShared*) c1->prop[BxpTestShared::id])->n == 10);
+
+	// modification: the value is copied
+	BxpTestShared* p1 = (BxpTestShared*) new_cells.first->prop[BxpTestShared::id];
+	CPPUNIT_ASSERT(BxpTestShared::nb_copies==1);
+	p1->n = 1;
+	CPPUNIT_ASSERT(((const BxpTestShared*) c2->prop[BxpTestShared::id])->n == 10);
 
+	// the last owner modifies the value in place
+	BxpTestShared* p2 = (BxpTestShared*) new_cells.second->prop[BxpTestShared::id];
+	CPPUNIT_ASSERT(BxpTestShared::nb_copies==1);
+	p2->n = 2;
+	CPPUNIT_ASSERT(p1->n == 1);
+
+	delete new_cells.first;
+	delete new_cells.second;
+}
+
+void TestCell::share_active_ctr() {
+	Variable x,y;
+	Function f(x,y,x+y-10);
+	NumConstraint ctr(f,LEQ);
+	long id=BxpActiveCtr::get_id(ctr);
+
+	IntervalVector box(2, Interval(-1,1));
+	Cell* root = new Cell(box);
+	root->prop.add(new BxpActiveCtr(ctr));
+
+	LargestFirst bsc;
+	std::pair<Cell*, Cell*> new_cells = bsc.bisect(*root);
+	CPPUNIT_ASSERT(((const Cell*) new_cells.first)->prop[id]==((const Cell*) new_cells.second)->prop[id]);
+
+	// the shared value must not refer to the box of the parent
+	delete root;
+	new_cells.second->box[0]=Interval(9,10);
+	new_cells.second->box[1]=Interval(9,10);
 
+	BxpActiveCtr* p1=(BxpActiveCtr*) new_cells.first->prop[id];
+	p1->check(new_cells.first->box);
+	CPPUNIT_ASSERT(!p1->active());
 
+	BxpActiveCtr* p2=(BxpActiveCtr*) new_cells.second->prop[id];
+	p2->check(new_cells.second->box);
+	CPPUNIT_ASSERT(p2->active());
+
+	delete new_cells.first;
+	delete new_cells.second;
+}
+
+void TestCell::compact_delta() {
+	int n=40;
+	IntervalVector box(n, Interval(-1,1));
+	CellCompactor compactor;
+	LargestFirst bsc;
+
+	// no reference yet: the root is the reference
+	CompactCell* root=compactor.pack(new Cell(box));
+	CPPUNIT_ASSERT(root->nb_components()==0);
+
+	Cell* c=compactor.unpack(root);
+	CPPUNIT_ASSERT(c->box==box);
+	c->box[3]=Interval(0,1);
+
+	std::pair<Cell*,Cell*> p=bsc.bisect(*c);
+	IntervalVector left=p.first->box;
+	IntervalVector right=p.second->box;
+	delete c;
+
+	// only the contracted and the bisected components are stored
+	CompactCell* c1=compactor.pack(p.first);
+	CompactCell* c2=compactor.pack(p.second);
+	CPPUNIT_ASSERT(c1->nb_components()==2);
+	CPPUNIT_ASSERT(c2->nb_components()==2);
+
+	// the reference is renewed if most of the components differ
+	IntervalVector other(n, Interval(0,1));
+	CompactCell* c3=compactor.pack(new Cell(other, -1, 5));
+	CPPUNIT_ASSERT(c3->nb_components()==0);
+
+	Cell* u3=compactor.unpack(c3);
+	CPPUNIT_ASSERT(u3->box==other);
+	CPPUNIT_ASSERT(u3->depth==5);
+	delete u3;
+
+	Cell* u2=compactor.unpack(c2);
+	CPPUNIT_ASSERT(u2->box==right);
+	CPPUNIT_ASSERT(u2->depth==1);
+	delete u2;
+
+	CPPUNIT_ASSERT(c1->get()==c1->get());
+	CPPUNIT_ASSERT(c1->unpacked());
+	CPPUNIT_ASSERT(c1->get()->box==left);
+	delete c1;
+}
+
+void TestCell::compact_prop() {
+	int n=20;
+	IntervalVector box(n, Interval(-1,1));
+	Cell* root=new Cell(box);
+	root->prop.add(new BxpTest());
+	((BxpTest*) root->prop[BxpTest::id])->n = 100;
+
+	CellStack stack(true);
+	stack.push(root);
+
+	// the last pushed cell is not packed
+	Cell* other=new Cell(box);
+	stack.push(other);
+	CPPUNIT_ASSERT(stack.size()==2);
+	CPPUNIT_ASSERT(stack.pop()==other);
+	delete other;
+
+	Cell* c=stack.pop();
+
+	// the cell is kept with its properties
+	CPPUNIT_ASSERT(c==root);
+	CPPUNIT_ASSERT(c->box==box);
+	CPPUNIT_ASSERT(&c->prop.box==&c->box);
+	CPPUNIT_ASSERT(((BxpTest*) c->prop[BxpTest::id])->n == 100);
+	delete c;
+}
+
+void TestCell::compact_light() {
+	int n=20;
+	long id=next_id();
+	IntervalVector box(n, Interval(-1,1));
+	Cell* root=new Cell(box);
+	root->prop.add(new BxpPrecond(id,n));
+	root->prop.add(new BxpTest());
+
+	BxpPrecond* precond=(BxpPrecond*) root->prop[id];
+	precond->C.resize(n,n);
+	precond->valid=true;
+
+	CellCompactor compactor;
+	Cell* c=compactor.unpack(compactor.pack(root));
+
+	// the matrix is dropped, not the other properties
+	CPPUNIT_ASSERT(c==root);
+	precond=(BxpPrecond*) c->prop[id];
+	CPPUNIT_ASSERT(precond!=NULL);
+	CPPUNIT_ASSERT(!precond->valid);
+	CPPUNIT_ASSERT(precond->n==n);
+	CPPUNIT_ASSERT(precond->C.nb_rows()==1);
+	CPPUNIT_ASSERT(c->prop[BxpTest::id]!=NULL);
+	delete c;
+}
+
+void TestCell::compact_stack() {
+	CellStack plain;
+	CellStack compact(true);
+	compare_buffers(plain, compact);
+}
+
+void TestCell::compact_list() {
+	CellList plain;
+	CellList compact(true);
+	compare_buffers(plain, compact);
+}
+
+} // end namespace
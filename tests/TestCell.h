@@ -40,6 +40,30 @@ protected:
 
 };
 
+/*
+ * A property value shared until modified.
+ */
+class BxpTestShared:  public Bxp {
+public:
+	BxpTestShared(): Bxp(id), n(10) { };
+
+	Bxp* copy(const IntervalVector& box, const BoxProperties& prop) const {
+		nb_copies++;
+		return new BxpTestShared(*this);
+	};
+
+	void update(const BoxEvent& event, const BoxProperties& prop) { }
+
+	bool unchanged(const BoxEvent& event, const BoxProperties& prop) const { return true; }
+
+	int n;
+	static long id;
+	static int nb_copies;
+
+protected:
+	explicit BxpTestShared(const BxpTestShared& e) : Bxp(id), n(e.n) { };
+};
+
 class TestCell : public CppUnit::TestFixture {
 
 public:
@@ -47,10 +71,24 @@ public:
 	CPPUNIT_TEST_SUITE(TestCell);
 	CPPUNIT_TEST(test01);
 	CPPUNIT_TEST(test02);
+	CPPUNIT_TEST(copy_on_write);
+	CPPUNIT_TEST(share_active_ctr);
+	CPPUNIT_TEST(compact_delta);
+	CPPUNIT_TEST(compact_prop);
+	CPPUNIT_TEST(compact_light);
+	CPPUNIT_TEST(compact_stack);
+	CPPUNIT_TEST(compact_list);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
 	void test02();
+	void copy_on_write();
+	void share_active_ctr();
+	void compact_delta();
+	void compact_prop();
+	void compact_light();
+	void compact_stack();
+	void compact_list();
 
 };
 
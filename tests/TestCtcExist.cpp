@@ -72,4 +72,72 @@ void TestCtcExist::test01() {
 
 }
 
+void TestCtcExist::threads01() {
+
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+
+	double prec=1e-05;
+
+	NumConstraint c(f,LEQ);
+	CtcExist exist_y(c,y,IntervalVector(1,Interval(-10,10)),prec);
+	exist_y.set_nb_threads(4);
+
+	double right_bound=+0.3872983346072957;
+
+	for (int i=0; i<10; i++) {
+		IntervalVector box(1,Interval(-10,10));
+		exist_y.contract(box);
+		CPPUNIT_ASSERT(box.is_superset(IntervalVector(1,Interval(-right_bound,right_bound))));
+		CPPUNIT_ASSERT(box[0].ub()<1);
+
+		box=IntervalVector(1,Interval(1,10));
+		exist_y.contract(box);
+		CPPUNIT_ASSERT(box.is_empty());
+	}
+}
+
+void TestCtcExist::cache01() {
+
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+
+	double prec=1e-05;
+
+	NumConstraint c(f,LEQ);
+	CtcExist exist_y(c,y,IntervalVector(1,Interval(-10,10)),prec);
+	CtcExist no_cache(c,y,IntervalVector(1,Interval(-10,10)),prec);
+	no_cache.set_cache_size(0);
+
+	double right_bound=+0.3872983346072957;
+
+	stack<IntervalVector> stack;
+	stack.push(IntervalVector(1,Interval(-10,10)));
+	while (!stack.empty()) {
+		IntervalVector box=stack.top();
+		IntervalVector box2=stack.top();
+		stack.pop();
+		exist_y.contract(box);
+		no_cache.contract(box2);
+		CPPUNIT_ASSERT(box.is_subset(box2));
+		if (box2[0].contains(right_bound)) CPPUNIT_ASSERT(box[0].contains(right_bound));
+		if (!box.is_empty() && box.max_diam()>1e-02) {
+			pair<IntervalVector,IntervalVector> p=box.bisect(0);
+			stack.push(p.first);
+			stack.push(p.second);
+		}
+	}
+
+	// modifying the parameter domain flushes the cache
+	IntervalVector box(1,Interval(0.5,0.6));
+	exist_y.contract(box);
+	CPPUNIT_ASSERT(box.is_empty());
+	exist_y.y_init=IntervalVector(1,Interval(-100,100));
+	box=IntervalVector(1,Interval(0.5,0.6));
+	exist_y.contract(box);
+	CPPUNIT_ASSERT(box.is_empty());
+}
+
 } // end namespace
@@ -78,4 +78,72 @@ void TestCtcForAll::test01() {
 	CPPUNIT_ASSERT(sol[0].contains(right_bound));
 }
 
+void TestCtcForAll::threads01() {
+
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+
+	double prec=1e-05;
+
+	NumConstraint c(f,LEQ);
+	IntervalVector parambox(1,Interval(-0.01,0.01));
+
+	CtcForAll forall_y(c, y, parambox, prec);
+	CtcForAll sequential(c, y, parambox, prec);
+	forall_y.set_nb_threads(4);
+
+	for (int i=0; i<10; i++) {
+		IntervalVector box(1,Interval(-10,10));
+		IntervalVector box2(1,Interval(-10,10));
+		forall_y.contract(box);
+		sequential.contract(box2);
+		CPPUNIT_ASSERT(box.is_superset(box2));
+		CPPUNIT_ASSERT(box[0].ub()<1);
+
+		box=IntervalVector(1,Interval(0.4,10));
+		forall_y.contract(box);
+		CPPUNIT_ASSERT(box.is_empty());
+	}
+}
+
+void TestCtcForAll::cache01() {
+
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+
+	double prec=1e-04;
+
+	NumConstraint c(f,LEQ);
+	IntervalVector parambox(1,Interval(-0.01,0.01));
+
+	CtcForAll forall_y(c, y, parambox, prec);
+	CtcForAll no_cache(c, y, parambox, prec);
+	no_cache.set_cache_size(0);
+
+	double right_bound=+0.3616933019201018;
+
+	stack<IntervalVector> stack;
+	stack.push(IntervalVector(1,Interval(-10,10)));
+	while (!stack.empty()) {
+		IntervalVector box=stack.top();
+		IntervalVector box2=stack.top();
+		stack.pop();
+		ContractContext context(box);
+		forall_y.contract(box,context);
+		ContractContext context2(box2);
+		no_cache.contract(box2,context2);
+		CPPUNIT_ASSERT(box.is_subset(box2));
+		if (box2[0].contains(right_bound)) CPPUNIT_ASSERT(box[0].contains(right_bound));
+		// inactivity must be preserved
+		if (context2.output_flags[Ctc::INACTIVE]) CPPUNIT_ASSERT(context.output_flags[Ctc::INACTIVE]);
+		if (!box.is_empty() && box.max_diam()>1e-02) {
+			pair<IntervalVector,IntervalVector> p=box.bisect(0);
+			stack.push(p.first);
+			stack.push(p.second);
+		}
+	}
+}
+
 } // end namespace
@@ -42,5 +42,35 @@ void TestCtcFwdBwd::atan2_issue134() {
 	check(box[2],Interval::half_pi());
 }
 
+void TestCtcFwdBwd::affine01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,sqr(x)-x*y+sqr(y)-x);
+
+	CtcFwdBwd ctc1(f,Interval(-0.1,0.1));
+	CtcFwdBwd ctc2(f,Interval(-0.1,0.1));
+	ctc2.set_affine(true);
+
+	IntervalVector box1(2);
+	box1[0]=Interval(0.5,2);
+	box1[1]=Interval(-1,3);
+	IntervalVector box2(box1);
+
+	ctc1.contract(box1);
+	ctc2.contract(box2);
+
+	CPPUNIT_ASSERT(box2.is_strict_subset(box1));
+	// (1,1) is a solution
+	CPPUNIT_ASSERT(box2.contains(Vector(2,1.0)));
+
+	// back to the standard forward phase
+	ctc2.set_affine(false);
+	box2=IntervalVector(2);
+	box2[0]=Interval(0.5,2);
+	box2[1]=Interval(-1,3);
+	ctc2.contract(box2);
+	CPPUNIT_ASSERT(box2==box1);
+}
+
 
 } // namespace ibex
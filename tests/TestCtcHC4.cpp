@@ -12,6 +12,7 @@
 #include "Ponts30.h"
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_CtcHC4.h"
+#include "ibex_PropagScore.h"
 #include "ibex_Array.h"
 
 namespace ibex {
@@ -55,4 +56,66 @@ void TestCtcHC4::ponts30() {
 	}
 }
 
+void TestCtcHC4::priority() {
+	Ponts30 p30;
+	Array<NumConstraint> a(30);
+	for (int i=0; i<30; i++)
+		a.set_ref(i,*new NumConstraint(dynamic_cast<Function&>((*p30.f)[i]),EQ));
+
+	CtcHC4 fifo(a,0.01);
+	fifo.accumulate=true;
+	IntervalVector fifo_box=p30.init_box;
+	fifo.contract(fifo_box);
+
+	CtcHC4 hc4(a,0.01);
+	hc4.accumulate=true;
+	PropagScore score(false); // not timed (deterministic)
+	hc4.set_priority(score);
+
+	// same fixpoint as FIFO
+	IntervalVector box=p30.init_box;
+	hc4.contract(box);
+	CPPUNIT_ASSERT(almost_eq(box, fifo_box, 1e-08));
+
+	// once the priority is learnt: same result (the expected
+	// gain of a previous call does not stop the propagation)
+	for (int k=0; k<10; k++) {
+		box=p30.init_box;
+		hc4.contract(box);
+		CPPUNIT_ASSERT(almost_eq(box, fifo_box, 1e-08));
+	}
+
+	for (int i=0; i<30; i++)
+		delete &a[i];
+}
+
+void TestCtcHC4::cutoff() {
+	Ponts30 p30;
+	Array<NumConstraint> a(30);
+	for (int i=0; i<30; i++)
+		a.set_ref(i,*new NumConstraint(dynamic_cast<Function&>((*p30.f)[i]),EQ));
+
+	CtcHC4 hc4(a,0.01);
+	hc4.accumulate=true;
+	PropagScore score(false);
+	hc4.set_priority(score);
+
+	hc4.cutoff=POS_INFINITY; // no contraction at all
+	IntervalVector box=p30.init_box;
+	hc4.contract(box);
+	CPPUNIT_ASSERT(box==p30.init_box);
+
+	hc4.cutoff=1; // stops before the fixpoint
+	hc4.contract(box);
+	CPPUNIT_ASSERT(box.is_strict_subset(p30.init_box));
+
+	IntervalVector fixpoint=box;
+	hc4.cutoff=0;
+	hc4.contract(fixpoint);
+	CPPUNIT_ASSERT(fixpoint.is_subset(box));
+
+	for (int i=0; i<30; i++)
+		delete &a[i];
+}
+
 } // end namespace ibex
@@ -23,9 +23,13 @@ public:
 	CPPUNIT_TEST_SUITE(TestCtcHC4);
 	
 		CPPUNIT_TEST(ponts30);
+		CPPUNIT_TEST(priority);
+		CPPUNIT_TEST(cutoff);
 	CPPUNIT_TEST_SUITE_END();
 
 	void ponts30();
+	void priority();
+	void cutoff();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcHC4);
@@ -0,0 +1,98 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcMohc.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#include "TestCtcMohc.h"
+#include "ibex_CtcMohc.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestCtcMohc::multi_occ01() {
+	Variable x,y,z;
+	Function f(x,y,z,x*y+x-z);
+	CtcMohc ctc(f);
+
+	CPPUNIT_ASSERT(ctc.multi_occ_vars().size()==1);
+	CPPUNIT_ASSERT(ctc.multi_occ_vars()[0]==0);
+}
+
+void TestCtcMohc::multi_occ02() {
+	Variable x(3),y;
+	Function f(y,x,sqr(x[1])+x[1]*y+x[0]-y*x[2]);
+	CtcMohc ctc(f);
+
+	CPPUNIT_ASSERT(ctc.multi_occ_vars().size()==2);
+	CPPUNIT_ASSERT(ctc.multi_occ_vars()[0]==0);
+	CPPUNIT_ASSERT(ctc.multi_occ_vars()[1]==2);
+}
+
+void TestCtcMohc::mohc01() {
+	// f is increasing w.r.t. x and y in the box
+	Variable x,y;
+	Function f(x,y,x*y-x-3);
+
+	CtcFwdBwd hc4r(f);
+	CtcMohc mohc(f);
+
+	IntervalVector box1(2);
+	box1[0]=Interval(1,2);
+	box1[1]=Interval(2,3);
+	IntervalVector box2(box1);
+
+	hc4r.contract(box1);
+	mohc.contract(box2);
+
+	// the exact hull is [1.5,2]x[2.5,3]. Only x occurs
+	// twice so y is only contracted by forward-backward.
+	CPPUNIT_ASSERT(box2.is_strict_subset(box1));
+	CPPUNIT_ASSERT(box2[0].is_superset(Interval(1.5,2)));
+	CPPUNIT_ASSERT(box2[1].is_superset(Interval(2.5,3)));
+	CPPUNIT_ASSERT(box2[0].lb()>1.4);
+}
+
+void TestCtcMohc::mohc02() {
+	// f is decreasing w.r.t. x and y in the box
+	Variable x,y;
+	Function f(x,y,3+x-x*y);
+
+	CtcMohc mohc(f,EQ,CtcMohc::default_tau_mohc,0.001);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(2,3);
+	mohc.contract(box);
+
+	CPPUNIT_ASSERT(box[0].is_superset(Interval(1.5,2)));
+	CPPUNIT_ASSERT(box[1].is_superset(Interval(2.5,3)));
+	CPPUNIT_ASSERT(box[0].lb()>1.5-0.001);
+}
+
+void TestCtcMohc::mohc03() {
+	// x*(y-1) is in [1,4] in the box
+	Variable x,y;
+	Function f(x,y,x*y-x);
+
+	CtcFwdBwd hc4r(f,Interval(0.9,0.9));
+	Variable x2,y2;
+	NumConstraint c(x2,y2,x2*y2-x2=0.9);
+	CtcMohc mohc(c);
+
+	IntervalVector box1(2);
+	box1[0]=Interval(1,2);
+	box1[1]=Interval(2,3);
+	IntervalVector box2(box1);
+
+	hc4r.contract(box1);
+	CPPUNIT_ASSERT(!box1.is_empty());
+
+	mohc.contract(box2);
+	CPPUNIT_ASSERT(box2.is_empty());
+}
+
+} // namespace ibex
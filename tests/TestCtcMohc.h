@@ -0,0 +1,43 @@
+//============================================================================
+//                                  I B E X
+// File        : TestCtcMohc.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __TEST_CTC_MOHC_H__
+#define __TEST_CTC_MOHC_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcMohc : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcMohc);
+	CPPUNIT_TEST(multi_occ01);
+	CPPUNIT_TEST(multi_occ02);
+	CPPUNIT_TEST(mohc01);
+	CPPUNIT_TEST(mohc02);
+	CPPUNIT_TEST(mohc03);
+	CPPUNIT_TEST_SUITE_END();
+
+	void multi_occ01();
+	void multi_occ02();
+	void mohc01();
+	void mohc02();
+	void mohc03();
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcMohc);
+
+
+} // namespace ibex
+
+#endif // __TEST_CTC_MOHC_H__
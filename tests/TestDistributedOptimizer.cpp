@@ -0,0 +1,115 @@
+/* ============================================================================
+ * I B E X - Distributed optimizer Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestDistributedOptimizer.h"
+#include "ibex_DistributedOptimizer.h"
+#include "ibex_OptimSocketTransport.h"
+#include "ibex_SystemFactory.h"
+#include "ibex_ExtendedSystem.h"
+#include "ibex_NormalizedSystem.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_LoupFinderFwdBwd.h"
+#include "ibex_CellDoubleHeap.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// Optimizer that does not require a LP solver
+class TestOptim {
+public:
+	TestOptim(const System& sys) : ext(sys), norm(sys), ctc(ext), bsc(1e-08), finder(norm), buffer(ext),
+	                               optim(sys.nb_var, ctc, bsc, finder, buffer, ext.goal_var()) { }
+
+	ExtendedSystem ext;
+	NormalizedSystem norm;
+	CtcHC4 ctc;
+	RoundRobin bsc;
+	LoupFinderFwdBwd finder;
+	CellDoubleHeap buffer;
+	Optimizer optim;
+};
+
+System* problem01_sys() {
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(3));
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_ctr(x[0]*x[1]*x[2]>=1);
+	f.add_goal(x*x);
+	return new System(f);
+}
+
+}
+
+void TestDistributedOptimizer::problem01() {
+	System* sys=problem01_sys();
+	TestOptim o(*sys);
+	OptimSocketTransport transport(3);
+	DistributedOptimizer d(o.optim, transport);
+	d.slice_time=0.05;
+
+	Optimizer::Status status=d.optimize(IntervalVector(3,Interval(0,10)));
+
+	CPPUNIT_ASSERT(status==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(d.get_loup()>=3 && d.get_uplo()<=3);
+	CPPUNIT_ASSERT(d.get_loup()-d.get_uplo()<=1e-02);
+	CPPUNIT_ASSERT(d.get_nb_cells()>0);
+	CPPUNIT_ASSERT(almost_eq(d.get_loup_point(),Vector::ones(3),0.1));
+	delete sys;
+}
+
+void TestDistributedOptimizer::restart() {
+	System* sys=problem01_sys();
+	TestOptim o(*sys);
+	OptimSocketTransport transport(2);
+	DistributedOptimizer d(o.optim, transport);
+	d.slice_time=0.01;
+	d.timeout=1e-06; // stops after the first fragments
+
+	Optimizer::Status status=d.optimize(IntervalVector(3,Interval(0,10)));
+	CPPUNIT_ASSERT(status==Optimizer::TIME_OUT);
+
+	CovOptimData cov(d.get_data(), true);
+	CPPUNIT_ASSERT(cov.is_extended_space());
+	CPPUNIT_ASSERT(cov.size()>1);
+
+	d.timeout=-1;
+	status=d.optimize(cov);
+	CPPUNIT_ASSERT(status==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(d.get_loup()>=3 && d.get_uplo()<=3);
+	CPPUNIT_ASSERT(d.get_data().nb_cells()>d.get_nb_cells());
+	delete sys;
+}
+
+void TestDistributedOptimizer::infeasible() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)<=1);
+	f.add_ctr(x+y>=2);
+	f.add_goal(x+y);
+	System sys(f);
+
+	TestOptim o(sys);
+	OptimSocketTransport transport(2);
+	DistributedOptimizer d(o.optim, transport);
+
+	Optimizer::Status status=d.optimize(IntervalVector(2,Interval(-10,10)));
+	CPPUNIT_ASSERT(status==Optimizer::INFEASIBLE);
+}
+
+} // namespace ibex
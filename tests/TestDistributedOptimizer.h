@@ -0,0 +1,46 @@
+/* ============================================================================
+ * I B E X - Distributed optimizer Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_DISTRIBUTED_OPTIMIZER_H__
+#define __TEST_DISTRIBUTED_OPTIMIZER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestDistributedOptimizer : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestDistributedOptimizer);
+#ifndef _WIN32
+	CPPUNIT_TEST(problem01);
+	CPPUNIT_TEST(restart);
+	CPPUNIT_TEST(infeasible);
+#endif
+	CPPUNIT_TEST_SUITE_END();
+
+	// same as TestOptimizer::vec_problem01, with 3 workers
+	void problem01();
+
+	// stop after a short time and restart from the COV
+	void restart();
+
+	// infeasible problem
+	void infeasible();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestDistributedOptimizer);
+
+} // namespace ibex
+
+#endif // __TEST_DISTRIBUTED_OPTIMIZER_H__
@@ -7,6 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Mar 31, 2020
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "TestExprMonomial.h"
@@ -16,6 +17,17 @@ using namespace std;
 
 namespace ibex {
 
+namespace {
+
+// gives access to the hash key
+class MonomialKey : public ExprMonomial {
+public:
+	MonomialKey(const ExprMonomial& m) : ExprMonomial(m) { }
+	using ExprMonomial::key;
+};
+
+}
+
 void TestExprMonomial::cmp_mul_00() {
 	stringstream ss;
 
@@ -402,4 +414,46 @@ void TestExprMonomial::add_sub_03() {
 	CPPUNIT_ASSERT_THROW(m4xc2vC1A+m4xc1vC2A,ExprMonomial::NotAMonomial);
 }
 
+void TestExprMonomial::key01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	vector<uint64_t> k1,k2;
+
+	// constant: empty key
+	CPPUNIT_ASSERT(MonomialKey(ExprMonomial(Interval(3))).key(k1));
+	CPPUNIT_ASSERT(k1.empty());
+
+	ExprMonomial mx(x);
+	ExprMonomial my(y);
+
+	CPPUNIT_ASSERT(MonomialKey(mx).key(k1));
+	CPPUNIT_ASSERT(k1.size()==1);
+	CPPUNIT_ASSERT(k1[0]==((((uint64_t) x.id) << 16) | 1));
+
+	// the coefficient is ignored
+	CPPUNIT_ASSERT(MonomialKey(3*mx).key(k2));
+	CPPUNIT_ASSERT(k1==k2);
+
+	// the power is not
+	CPPUNIT_ASSERT(MonomialKey(ExprMonomial(x,2)).key(k2));
+	CPPUNIT_ASSERT(k2.size()==1);
+	CPPUNIT_ASSERT(k2[0]==((((uint64_t) x.id) << 16) | 2));
+	CPPUNIT_ASSERT(MonomialKey(mx*mx).key(k1));
+	CPPUNIT_ASSERT(k1==k2);
+
+	// terms are ordered
+	CPPUNIT_ASSERT(MonomialKey(2*mx*my).key(k1));
+	CPPUNIT_ASSERT(MonomialKey(-my*mx).key(k2));
+	CPPUNIT_ASSERT(k1.size()==2);
+	CPPUNIT_ASSERT(k1==k2);
+	CPPUNIT_ASSERT(MonomialKey(mx*my*my).key(k2));
+	CPPUNIT_ASSERT(k1!=k2);
+
+	// no key with non-scalar terms
+	const ExprSymbol& v=ExprSymbol::new_("v", Dim::col_vec(3));
+	CPPUNIT_ASSERT(!MonomialKey(mx*ExprMonomial(v)).key(k1));
+	CPPUNIT_ASSERT(!MonomialKey(ExprMonomial(IntervalVector(3,1.0),false)*mx).key(k1));
+}
+
 } // namespace ibex
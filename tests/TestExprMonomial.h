@@ -7,6 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Mar 31, 2020
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __TEST_EXPR_MONOMIAL_H__
@@ -33,6 +34,7 @@ public:
 	CPPUNIT_TEST(add_sub_01);
 	CPPUNIT_TEST(add_sub_02);
 	CPPUNIT_TEST(add_sub_03);
+	CPPUNIT_TEST(key01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void cmp_mul_00();
@@ -45,6 +47,7 @@ public:
 	void add_sub_01();
 	void add_sub_02();
 	void add_sub_03();
+	void key01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestExprMonomial);
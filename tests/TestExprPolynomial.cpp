@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Mar 31, 2020
- * Last update : Apr 29, 2020
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "TestExprPolynomial.h"
@@ -228,4 +228,93 @@ void TestExprPolynomial::test04() {
 
 }
 
+void TestExprPolynomial::sum01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	ExprPolynomial px(x);
+	ExprPolynomial py(y);
+	ExprPolynomial p1(2*px+py+Interval::one());
+	ExprPolynomial p2(px*py);
+	ExprPolynomial p3(px-3*py);
+
+	ExprPolynomial* p=ExprPolynomial::sum({&p1},{true});
+	CPPUNIT_ASSERT(((string) *p)=="1+2x+y");
+	delete p;
+
+	p=ExprPolynomial::sum({&p1},{false});
+	CPPUNIT_ASSERT(((string) *p)=="-1+-2x+-y");
+	delete p;
+
+	p=ExprPolynomial::sum({&p1,&p2,&p3},{true,true,true});
+	CPPUNIT_ASSERT(((string) *p)==(string) (p1+p2+p3));
+	CPPUNIT_ASSERT(((string) *p)=="1+3x+xy+-2y");
+	delete p;
+
+	p=ExprPolynomial::sum({&p1,&p2,&p3},{true,false,false});
+	CPPUNIT_ASSERT(((string) *p)==(string) (p1-p2-p3));
+	CPPUNIT_ASSERT(((string) *p)=="1+x+-xy+4y");
+	delete p;
+
+	// all monomials cancel
+	p=ExprPolynomial::sum({&p1,&p3,&p1,&p3},{true,false,false,true});
+	CPPUNIT_ASSERT(((string) *p)=="0");
+	CPPUNIT_ASSERT(p->is_constant());
+	delete p;
+
+	// a polynomial summed with itself
+	p=ExprPolynomial::sum({&p2,&p2,&p2},{true,true,false});
+	CPPUNIT_ASSERT(((string) *p)=="xy");
+	delete p;
+}
+
+void TestExprPolynomial::sum02() {
+	// non-scalar polynomials (no hashing)
+	const ExprSymbol& u=ExprSymbol::new_("u", Dim::col_vec(3));
+	const ExprSymbol& v=ExprSymbol::new_("v", Dim::col_vec(3));
+
+	ExprPolynomial pu(u);
+	ExprPolynomial pv(v);
+	ExprPolynomial p1(pu+2*pv);
+
+	ExprPolynomial* p=ExprPolynomial::sum({&p1,&pu,&pv},{true,true,false});
+	CPPUNIT_ASSERT(((string) *p)==(string) (p1+pu-pv));
+	CPPUNIT_ASSERT(((string) *p)=="2u+v");
+	delete p;
+
+	p=ExprPolynomial::sum({&p1,&pu,&pv,&pv},{true,false,false,false});
+	CPPUNIT_ASSERT(((string) *p)=="0");
+	delete p;
+}
+
+void TestExprPolynomial::accumulator01() {
+	// products and squares merge their monomials through an accumulator
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	const ExprSymbol& z=ExprSymbol::new_("z");
+
+	ExprPolynomial px(x);
+	ExprPolynomial py(y);
+	ExprPolynomial pz(z);
+
+	ExprPolynomial p(px+py+pz);
+
+	CPPUNIT_ASSERT(((string) (p*p))=="x^2+2xy+2xz+y^2+2yz+z^2");
+	CPPUNIT_ASSERT(((string) (p*p))==(string) p.square());
+
+	// cubic: every monomial of the result is generated several times
+	CPPUNIT_ASSERT(((string) (p*p*p))=="x^3+3x^2y+3x^2z+3xy^2+6xyz+3xz^2+y^3+3y^2z+3yz^2+z^3");
+
+	// all cross terms cancel
+	ExprPolynomial q(px-py+pz);
+	ExprPolynomial r(px+py-pz);
+	CPPUNIT_ASSERT(((string) (q*r))=="x^2+-y^2+2yz+-z^2");
+	CPPUNIT_ASSERT(((string) (p*(px-py)-(px+py+pz)*px))=="-xy+-y^2+-yz");
+
+	// constant terms
+	ExprPolynomial c(px+Interval(2));
+	CPPUNIT_ASSERT(((string) (c*c-c.square()))=="0");
+	CPPUNIT_ASSERT(((string) (c*(px-Interval(2))))=="-4+x^2");
+}
+
 } // namespace ibex
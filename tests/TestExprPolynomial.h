@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Mar 31, 2020
- * Last update : Apr 29, 2020
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __TEST_EXPR_POLYNOMIAL_H__
@@ -29,6 +29,9 @@ public:
 	CPPUNIT_TEST(test02);
 	CPPUNIT_TEST(test03);
 	CPPUNIT_TEST(test04);
+	CPPUNIT_TEST(sum01);
+	CPPUNIT_TEST(sum02);
+	CPPUNIT_TEST(accumulator01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test00();
@@ -36,6 +39,9 @@ public:
 	void test02();
 	void test03();
 	void test04();
+	void sum01();
+	void sum02();
+	void accumulator01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestExprPolynomial);
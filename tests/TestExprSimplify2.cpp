@@ -7,6 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : May 17, 2020
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "TestExprSimplify2.h"
@@ -285,4 +286,61 @@ void TestExprSimplify2::issue425_05() {
 	cleanup(e2,true);
 }
 
+void TestExprSimplify2::develop_01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	const ExprNode& e=ExprSimplify2(false).simplify((x+y)*(x-y));
+	CPPUNIT_ASSERT(sameExpr(e,"((x+y)*(x-y))"));
+
+	const ExprNode& e2=ExprSimplify2(true).simplify(e);
+	CPPUNIT_ASSERT(sameExpr(e2,"(x^2-y^2)"));
+	cleanup(e2,true);
+}
+
+void TestExprSimplify2::develop_budget_01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	const ExprSymbol& z=ExprSymbol::new_("z");
+
+	CPPUNIT_ASSERT(((x+y)*(x+z)*(y+z)).size==8);
+
+	// budget=0.8: nothing is developed
+	const ExprNode& e1=ExprSimplify2(true,0.1).simplify((x+y)*(x+z)*(y+z));
+	CPPUNIT_ASSERT(sameExpr(e1,"((y+z)*((x+y)*(x+z)))"));
+	cleanup(e1,false);
+
+	// budget=8: the first product (4 monomials) is developed, not the second one (4x2)
+	const ExprNode& e2=ExprSimplify2(true,1).simplify((x+y)*(x+z)*(y+z));
+	CPPUNIT_ASSERT(sameExpr(e2,"((y+z)*(((x^2+(x*y))+(x*z))+(y*z)))"));
+	cleanup(e2,false);
+
+	// budget=12: everything is developed
+	const ExprNode& e3=ExprSimplify2(true,1.5).simplify((x+y)*(x+z)*(y+z));
+	CPPUNIT_ASSERT(sameExpr(e3,"(((((((x^2*y)+(x^2*z))+(x*y^2))+(2*((x*y)*z)))+(x*z^2))+(y^2*z))+(y*z^2))"));
+	cleanup(e3,true);
+}
+
+void TestExprSimplify2::develop_budget_02() {
+	// with the default expansion ratio (budget=310), a product of 8 binomials
+	// (31 nodes, 508 monomials generated) is not fully developed by simplify(3).
+	const int k=8;
+	Array<const ExprSymbol> x(k), y(k);
+	for (int i=0; i<k; i++) {
+		x.set_ref(i,ExprSymbol::new_());
+		y.set_ref(i,ExprSymbol::new_());
+	}
+
+	const ExprNode* e=&(x[0]+y[0]);
+	for (int i=1; i<k; i++)
+		e=&(*e*(x[i]+y[i]));
+	CPPUNIT_ASSERT(e->size==4*k-1);
+	CPPUNIT_ASSERT(dynamic_cast<const ExprMul*>(&e->simplify(3)));
+
+	e=&(x[0]+y[0]);
+	for (int i=1; i<k; i++)
+		e=&(*e*(x[i]+y[i]));
+	CPPUNIT_ASSERT(dynamic_cast<const ExprAdd*>(&ExprSimplify2(true,1000).simplify(*e)));
+}
+
 } // end namespace
@@ -7,6 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : May 17, 2020
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __TEST_EXPR_SIMPLIFY_2_H__
@@ -51,6 +52,9 @@ public:
 	CPPUNIT_TEST(issue425_03);
 	CPPUNIT_TEST(issue425_04);
 	CPPUNIT_TEST(issue425_05);
+	CPPUNIT_TEST(develop_01);
+	CPPUNIT_TEST(develop_budget_01);
+	CPPUNIT_TEST(develop_budget_02);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -81,6 +85,9 @@ public:
 	void issue425_03();
 	void issue425_04();
 	void issue425_05();
+	void develop_01();
+	void develop_budget_01();
+	void develop_budget_02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestExprSimplify2);
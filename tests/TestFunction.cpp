@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Mar 23, 2012
- * Last update : Jun 16, 2019
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "TestFunction.h"
@@ -16,6 +16,7 @@
 #include "ibex_Expr.h"
 #include "ibex_System.h"
 #include "ibex_SyntaxError.h"
+#include "ibex_Threads.h"
 #include <sstream>
 #include <cstdio>
 
@@ -357,6 +358,57 @@ void TestFunction::generate_comp03() {
 	CPPUNIT_ASSERT(c->get_vector_value()[1]==Interval(2,2));
 }
 
+void TestFunction::generate_comp04() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	const ExprNode& e1=sqr(x)+exp(y*sin(x));
+	const ExprNode& e2=ExprConstant::new_scalar(0);
+	const ExprNode& e3=y-x;
+	const ExprNode& e4=ExprConstant::new_scalar(0);
+	Array<const ExprNode> v(e1, e2, e3, e4);
+
+	Function f(x,y,ExprVector::new_col(v));
+
+	// the last components are generated first
+	CPPUNIT_ASSERT(sameExpr(f[2].expr(),"(y-x)"));
+	// only the sub-expression of the component is copied
+	CPPUNIT_ASSERT(f[2].nb_nodes()==3);
+	CPPUNIT_ASSERT(&f[3]==&f[1]);
+	CPPUNIT_ASSERT(sameExpr(f[0].expr(),"(x^2+exp((y*sin(x))))"));
+
+	IntervalVector box(2,Interval(0,1));
+	check(f[0].eval(box),f.eval(0,box));
+}
+
+void TestFunction::generate_comp05() {
+	const int m=8;
+	const int nb_threads=4;
+	Variable x(m);
+	Array<const ExprNode> v(m);
+	for (int i=0; i<m; i++)
+		v.set_ref(i, sqr(x[i])-x[(i+1)%m]);
+
+	Function f(x,ExprVector::new_col(v));
+
+	// all the threads ask for the components at the same time,
+	// in different orders
+	Function* comp[nb_threads][m];
+	run_threads(nb_threads, [&](int w) {
+		for (int j=0; j<m; j++) {
+			int i=(w%2==0) ? j : m-1-j;
+			comp[w][i]=&f[i];
+		}
+	});
+
+	IntervalVector box(m,Interval(0,1));
+	for (int i=0; i<m; i++) {
+		for (int w=1; w<nb_threads; w++)
+			CPPUNIT_ASSERT(comp[w][i]==comp[0][i]);
+		check(f[i].eval(box),f.eval(i,box));
+	}
+}
+
 void TestFunction::used() {
 	const ExprSymbol& x=ExprSymbol::new_("x");
 	const ExprSymbol& y=ExprSymbol::new_("y");
@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Mar 23, 2012
- * Last update : Jun 16, 2019
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #ifndef __TEST_FUNCTION_H__
@@ -77,6 +77,8 @@ public:
 	CPPUNIT_TEST(generate_comp01);
 	CPPUNIT_TEST(generate_comp02);
 	CPPUNIT_TEST(generate_comp03);
+	CPPUNIT_TEST(generate_comp04);
+	CPPUNIT_TEST(generate_comp05);
 
 	CPPUNIT_TEST(used);
 	CPPUNIT_TEST(used02);
@@ -135,6 +137,8 @@ public:
 	void generate_comp01();
 	void generate_comp02();
 	void generate_comp03(); // matrix-valued
+	void generate_comp04(); // on demand
+	void generate_comp05(); // on demand, from several threads
 
 	void used();
 	void used02();
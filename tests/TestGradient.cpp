@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 24, 2012
-// Last Update : May 24, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "TestGradient.h"
@@ -13,6 +13,7 @@
 #include "ibex_Expr.h"
 #include "ibex_Eval.h"
 #include "Ponts30.h"
+#include "ibex_Threads.h"
 
 using namespace std;
 
@@ -662,5 +663,19 @@ void TestGradient::jacobian_components02() {
 
 }
 
+void TestGradient::linear_threads() {
+	Variable x(5);
+	Function f(x,Return(x[0]+2*x[1],x[0]*x[1],x[2]-x[3]+x[4],sqr(x[4]),3*x[3]));
+	Gradient& g=f.deriv_calculator();
+
+	bool ok[4];
+	run_threads(4, [&](int w) {
+		ok[w] = g.linear(0) && !g.linear(1) && g.linear(2) && !g.linear(3) && g.linear(4);
+	});
+
+	for (int w=0; w<4; w++)
+		CPPUNIT_ASSERT(ok[w]);
+}
+
 } // end namespace
 
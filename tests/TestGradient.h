@@ -45,6 +45,7 @@ public:
 	CPPUNIT_TEST(mulVM02);
 	CPPUNIT_TEST(jacobian_components01);
 	CPPUNIT_TEST(jacobian_components02);
+	CPPUNIT_TEST(linear_threads);
 	CPPUNIT_TEST_SUITE_END();
 
 	void deco01();
@@ -70,6 +71,9 @@ public:
 
 	void jacobian_components01();
 	void jacobian_components02();
+
+	// linear part calculated by concurrent threads
+	void linear_threads();
 private:
 	void check_deco(const ExprNode& e);
 };
@@ -7,7 +7,7 @@
  *
  * Author(s)   : Gilles Chabert
  * Created     : Apr 03, 2012
- * Last update : Jan 28, 2020
+ * Last update : Oct 19, 2026
  * ---------------------------------------------------------------------------- */
 
 #include "TestHC4Revise.h"
@@ -187,5 +187,92 @@ void TestHC4Revise::issue431() {
 	CPPUNIT_ASSERT(x[0]==Interval::zero());
 }
 
+void TestHC4Revise::incremental01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	Function f(x,x[0]+x[1]*x[2]);
+	Domain zero(Dim::scalar());
+	zero.i()=Interval::zero();
+
+	double _box[][2]= { {1,3}, {-4,-2}, {1,2} };
+	IntervalVector box(3,_box);
+	IntervalVector box2(box);
+
+	f.backward(zero,box,BitSet::all(3));
+	f.backward(zero,box2);
+	CPPUNIT_ASSERT(box==box2);
+
+	// x[1] is reduced: only x[1]*x[2] and the root are re-evaluated
+	box[1]=Interval(-2.5,-2);
+	box2=box;
+	f.backward(zero,box,BitSet::singleton(3,1));
+	f.backward(zero,box2);
+	CPPUNIT_ASSERT(box==box2);
+
+	// nothing has changed
+	f.backward(zero,box,BitSet::all(3));
+	CPPUNIT_ASSERT(box==box2);
+}
+
+void TestHC4Revise::incremental02() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	Function f(x,x[0]+x[1]);
+	Domain zero(Dim::scalar());
+	zero.i()=Interval::zero();
+
+	double _box[][2]= { {1,3}, {-4,-2} };
+	IntervalVector box(2,_box);
+	f.backward(zero,box,BitSet::all(2));
+	double _res[][2]= { {2,3}, {-3,-2} };
+	CPPUNIT_ASSERT(box==IntervalVector(2,_res));
+
+	// the box is not a subset of the previous one:
+	// a full forward is required, whatever the impact.
+	double _box2[][2]= { {0,10}, {-1,1} };
+	IntervalVector box2(2,_box2);
+	f.backward(zero,box2,BitSet::empty(2));
+	double _res2[][2]= { {0,1}, {-1,0} };
+	CPPUNIT_ASSERT(box2==IntervalVector(2,_res2));
+
+	// the evaluator has been used for another box:
+	// a full forward is required.
+	box2=IntervalVector(2,_box2);
+	f.eval(IntervalVector(2,Interval(100,200)));
+	f.backward(zero,box2,BitSet::empty(2));
+	CPPUNIT_ASSERT(box2==IntervalVector(2,_res2));
+}
+
+void TestHC4Revise::incremental03() {
+	const ExprSymbol& a = ExprSymbol::new_("a");
+	const ExprSymbol& c = ExprSymbol::new_("c");
+	const ExprSymbol& e = ExprSymbol::new_("e");
+	Function f(a,c,e,sqr(a)-c-e);
+	Domain zero(Dim::scalar());
+	zero.i()=Interval::zero();
+	BitSet impact=BitSet::singleton(3,1); // only c is propagated
+
+	double _box[][2]= { {0,2}, {0,0.5}, {0,0.5} };
+	IntervalVector box(3,_box);
+	f.backward(zero,box,BitSet::all(3));
+	CPPUNIT_ASSERT(box[0]==Interval(0,1));
+
+	// e is reduced but not propagated: the result
+	// must remain a subset of the box
+	double _box1[][2]= { {0,1}, {0,0.5}, {0,0.1} };
+	IntervalVector box1(3,_box1);
+	f.backward(zero,box1,impact);
+	CPPUNIT_ASSERT(box1.is_subset(IntervalVector(3,_box1)));
+
+	// a is shrunk and e is shifted (e is not propagated): the
+	// solutions (e.g., a=0.8, c=0.34, e=0.3) must be kept
+	double _box2[][2]= { {0.7,0.8}, {0.1,0.5}, {0.3,0.5} };
+	IntervalVector box2(3,_box2);
+	IntervalVector full(box2);
+	f.backward(zero,box2,impact);
+	f.backward(zero,full);
+	CPPUNIT_ASSERT(full.is_subset(box2));
+	CPPUNIT_ASSERT(box2.is_subset(IntervalVector(3,_box2)));
+	CPPUNIT_ASSERT(box2[0]==Interval(0.7,0.8));
+}
+
 } // end namespace
 
@@ -39,6 +39,9 @@ public:
 	CPPUNIT_TEST(vec02);
 	CPPUNIT_TEST(vec03);
 	CPPUNIT_TEST(issue431);
+	CPPUNIT_TEST(incremental01);
+	CPPUNIT_TEST(incremental02);
+	CPPUNIT_TEST(incremental03);
 	CPPUNIT_TEST_SUITE_END();
 
 	void id01();
@@ -60,6 +63,9 @@ public:
 	// but x is not fully inside the definition
 	// domain of f.
 	void issue431();
+	void incremental01();
+	void incremental02();
+	void incremental03();
 
 };
 
@@ -0,0 +1,174 @@
+//============================================================================
+//                                  I B E X
+// File        : TestHessian.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "TestHessian.h"
+#include "ibex_Hessian.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestHessian::check_symbolic(Function& f, const IntervalVector& box, const IntervalVector& lambda) {
+	int n=f.nb_var();
+
+	IntervalMatrix H_sym=Matrix::zeros(n);
+
+	for (int i=0; i<f.image_dim(); i++) {
+		Function& fi=(f.image_dim()==1? f : f[i]);
+		Function dfi(fi, Function::DIFF);
+		H_sym += lambda[i]*dfi.jacobian(box);
+	}
+
+	Hessian hessian(f.basic_evaluator());
+	IntervalMatrix H(n,n);
+	hessian.hessian(box,lambda,H);
+
+	check(H,H_sym);
+	CPPUNIT_ASSERT(H.is_superset(H_sym.mid()));
+}
+
+void TestHessian::scalar01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,sqr(x)*y+sin(x));
+
+	double _box[][2]={{1,1},{2,2}};
+	IntervalVector box(2,_box);
+
+	Hessian hessian(f.basic_evaluator());
+	IntervalMatrix H(2,2);
+	hessian.hessian(box,H);
+
+	check(H[0][0],Interval(4)-sin(Interval(1)));
+	check(H[0][1],Interval(2));
+	check(H[1][0],Interval(2));
+	check(H[1][1],Interval(0));
+}
+
+void TestHessian::scalar02() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,x/y+atan2(x,y)+exp(x*y)+log(y)*sqrt(x)+pow(x,3)*cos(y));
+
+	double _box[][2]={{0.5,0.5},{2,2}};
+	check_symbolic(f,IntervalVector(2,_box),IntervalVector(1,Interval::one()));
+}
+
+void TestHessian::vector01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	const ExprSymbol& z=ExprSymbol::new_("z");
+	Function f(x,y,z,ExprVector::new_col(x*y*z,exp(x)+pow(y,3),tanh(x-z)));
+
+	double _box[][2]={{1,1},{2,2},{-1,-1}};
+	double _lambda[][2]={{2,2},{3,3},{-1,-1}};
+	check_symbolic(f,IntervalVector(3,_box),IntervalVector(3,_lambda));
+}
+
+void TestHessian::mulVM01() {
+	double _M[]={1,2,2,3};
+	Matrix M(2,2,_M);
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(2));
+	Function f(x,transpose(x)*M*x); // the Hessian is 2*M
+
+	IntervalVector box(2,Interval(1.0,2.0));
+
+	Hessian hessian(f.basic_evaluator());
+	IntervalMatrix H(2,2);
+	hessian.hessian(box,H);
+
+	check(H,IntervalMatrix(2.0*M));
+}
+
+void TestHessian::column01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,ExprVector::new_col(sqr(x)*y,x*sqr(y)));
+
+	double _box[][2]={{1,1},{3,3}};
+	IntervalVector box(2,_box);
+	double _lambda[][2]={{1,1},{2,2}};
+	IntervalVector lambda(2,_lambda);
+
+	Hessian hessian(f.basic_evaluator());
+	IntervalMatrix H(2,2);
+	hessian.hessian(box,lambda,H,1);
+
+	// H = [[2y, 2x],[2x, 0]] + 2*[[0, 2y],[2y, 2x]]
+	check(H[0][1],Interval(14));
+	check(H[1][1],Interval(4));
+}
+
+void TestHessian::hessian_vector01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,ExprVector::new_col(sqr(x)*y,x*sqr(y)));
+
+	double _box[][2]={{1,2},{3,4}};
+	IntervalVector box(2,_box);
+	double _lambda[][2]={{1,1},{-1,-1}};
+	IntervalVector lambda(2,_lambda);
+	double _u[][2]={{1,1},{-2,-2}};
+	IntervalVector u(2,_u);
+
+	Hessian hessian(f.basic_evaluator());
+	IntervalMatrix H(2,2);
+	hessian.hessian(box,lambda,H);
+	IntervalVector Hu(2);
+	hessian.hessian_vector(box,lambda,u,Hu);
+
+	CPPUNIT_ASSERT(Hu.is_subset(H*u));
+	CPPUNIT_ASSERT(Hu.is_superset((H*u).mid()));
+}
+
+void TestHessian::jacobian01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,ExprVector::new_col(sqr(x)*y,x-sin(y)));
+
+	double _box[][2]={{1,2},{3,4}};
+	IntervalVector box(2,_box);
+
+	Hessian hessian(f.basic_evaluator());
+	IntervalMatrix H(2,2);
+	IntervalMatrix J(2,2);
+	hessian.hessian(box,IntervalVector(2,Interval::one()),H,J);
+
+	check(J,f.jacobian(box));
+}
+
+void TestHessian::abs01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	Function f(x,abs(x)*x);
+
+	Hessian hessian(f.basic_evaluator());
+	IntervalMatrix H(1,1);
+
+	hessian.hessian(IntervalVector(1,Interval(1,2)),H);
+	check(H[0][0],Interval(2));
+
+	// non-differentiable point
+	hessian.hessian(IntervalVector(1,Interval(-1,1)),H);
+	CPPUNIT_ASSERT(H[0][0]==Interval::all_reals());
+}
+
+void TestHessian::unsupported01() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(2));
+	Function f(x,x*transpose(x));
+
+	bool thrown=false;
+	try {
+		Hessian hessian(f.basic_evaluator());
+	} catch(Hessian::Unsupported&) {
+		thrown=true;
+	}
+	CPPUNIT_ASSERT(thrown);
+}
+
+} // end namespace
@@ -0,0 +1,60 @@
+/* ============================================================================
+ * I B E X - Hessian Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_HESSIAN_H__
+#define __TEST_HESSIAN_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+#include "ibex_Function.h"
+
+namespace ibex {
+
+class TestHessian : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestHessian);
+
+	CPPUNIT_TEST(scalar01);
+	CPPUNIT_TEST(scalar02);
+	CPPUNIT_TEST(vector01);
+	CPPUNIT_TEST(mulVM01);
+	CPPUNIT_TEST(column01);
+	CPPUNIT_TEST(hessian_vector01);
+	CPPUNIT_TEST(jacobian01);
+	CPPUNIT_TEST(abs01);
+	CPPUNIT_TEST(unsupported01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void scalar01();
+	void scalar02();
+	void vector01();
+	void mulVM01();
+	void column01();
+	void hessian_vector01();
+	void jacobian01();
+	void abs01();
+	void unsupported01();
+
+private:
+	/*
+	 * Compare with the Hessian obtained by symbolic
+	 * differentiation of the components of f.
+	 */
+	void check_symbolic(Function& f, const IntervalVector& box, const IntervalVector& lambda);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestHessian);
+
+} // end namespace
+
+#endif // __TEST_HESSIAN_H__
@@ -409,6 +409,62 @@ void TestIntervalMatrix::mul02() {
 	CPPUNIT_ASSERT((m2*=m1).is_empty());
 }
 
+void TestIntervalMatrix::mid_rad_mul01() {
+	RNG::srand(1);
+	int n=70; // more than one block
+	Matrix C=Matrix::rand(n);
+	IntervalMatrix A=Matrix::rand(n);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			A[i][j]+=Interval(-1e-3,1e-3);
+
+	IntervalMatrix P=C*A;
+	IntervalMatrix Q=mid_rad_mul(C,A);
+
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) {
+			CPPUNIT_ASSERT(Q[i][j].is_superset(P[i][j]));
+			// exact up to rounding errors
+			CPPUNIT_ASSERT(Q[i][j].diam()<=P[i][j].diam()*(1+1e-9));
+		}
+}
+
+void TestIntervalMatrix::mid_rad_mul02() {
+	RNG::srand(1);
+	int n=20;
+	IntervalMatrix A=Matrix::rand(n);
+	IntervalMatrix B=Matrix::rand(n);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) {
+			A[i][j]+=Interval(-0.1,0.2);
+			B[i][j]+=Interval(-0.3,0.1);
+		}
+
+	IntervalMatrix P=A*B;
+	IntervalMatrix Q=mid_rad_mul(A,B);
+
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) {
+			CPPUNIT_ASSERT(Q[i][j].is_superset(P[i][j]));
+			// overestimation bound
+			CPPUNIT_ASSERT(Q[i][j].diam()<=1.5*P[i][j].diam()*(1+1e-9));
+		}
+}
+
+void TestIntervalMatrix::mid_rad_mul03() {
+	IntervalMatrix A=Matrix::eye(2);
+	A[0][1]=Interval::pos_reals();
+	IntervalMatrix B=Matrix::eye(2);
+	// naive product with unbounded entries
+	CPPUNIT_ASSERT(mid_rad_mul(A,B)==A*B);
+	CPPUNIT_ASSERT(mid_rad_mul(B,A)==B*A);
+	CPPUNIT_ASSERT(mid_rad_mul(Matrix::eye(2),A)==A);
+
+	B.set_empty();
+	CPPUNIT_ASSERT(mid_rad_mul(A,B).is_empty());
+	CPPUNIT_ASSERT(mid_rad_mul(Matrix::eye(2),B).is_empty());
+}
+
 void TestIntervalMatrix::put01() {
 
 	IntervalMatrix M1=2*Matrix::eye(3);
@@ -73,6 +73,9 @@ public:
 
 	CPPUNIT_TEST(mul01);
 	CPPUNIT_TEST(mul02);
+	CPPUNIT_TEST(mid_rad_mul01);
+	CPPUNIT_TEST(mid_rad_mul02);
+	CPPUNIT_TEST(mid_rad_mul03);
 
 	CPPUNIT_TEST(put01);
 	CPPUNIT_TEST(rad01);
@@ -173,6 +176,13 @@ public:
 	void mul01();
 	void mul02();
 
+	// test:
+	//  mid_rad_mul(const Matrix& m1, const IntervalMatrix& m2)
+	//  mid_rad_mul(const IntervalMatrix& m1, const IntervalMatrix& m2)
+	void mid_rad_mul01();
+	void mid_rad_mul02();
+	void mid_rad_mul03();
+
 	void put01();
 	void rad01();
 	void diam01();
@@ -125,6 +125,28 @@ void TestIntervalVector::resize04() {
 	check(x[1],Interval(3,4));
 }
 
+// growing and shrinking a vector
+void TestIntervalVector::resize05() {
+	int n=4;
+	IntervalVector x(2);
+	x[0]=Interval(1,2);
+	x[1]=Interval(3,4);
+	x.resize(n+2);
+	CPPUNIT_ASSERT(x.size()==n+2);
+	check(x[1],Interval(3,4));
+	CPPUNIT_ASSERT(x[n+1]==Interval::all_reals());
+	x[n]=Interval(5,6);
+	IntervalVector y(x);
+	x.resize(n);
+	check(x[1],Interval(3,4));
+	CPPUNIT_ASSERT(x[n-1]==Interval::all_reals());
+	y.resize(n+1);
+	check(y[n],Interval(5,6));
+	y=x;
+	CPPUNIT_ASSERT(y.size()==n);
+	check(y[1],Interval(3,4));
+}
+
 static double _x[][2]={{0,1},{2,3},{4,5}};
 
 void TestIntervalVector::subvector01() {
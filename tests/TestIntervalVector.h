@@ -41,6 +41,7 @@ public:
 	CPPUNIT_TEST(resize02);
 	CPPUNIT_TEST(resize03);
 	CPPUNIT_TEST(resize04);
+	CPPUNIT_TEST(resize05);
 
 	CPPUNIT_TEST(subvector01);
 	CPPUNIT_TEST(subvector02);
@@ -205,6 +206,7 @@ public:
 	void resize02();
 	void resize03();
 	void resize04();
+	void resize05();
 
 	// test: subvector(int start_index, int end_index)
 	void subvector01();
@@ -0,0 +1,338 @@
+//============================================================================
+//                                  I B E X
+// File        : TestLookahead.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "TestLookahead.h"
+#include "ibex_Lookahead.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_Cell.h"
+#include "ibex_Id.h"
+#include "ibex_Threads.h"
+
+#include <set>
+#include <thread>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Diameter of the first domain of the box.
+ * Shared (unchanged) at bisection.
+ */
+class BxpDiam : public Bxp {
+public:
+	BxpDiam(const IntervalVector& box) : Bxp(id), diam(box[0].diam()) { }
+
+	Bxp* copy(const IntervalVector& box, const BoxProperties& prop) const {
+		return new BxpDiam(box);
+	}
+
+	void update(const BoxEvent& event, const BoxProperties& prop) {
+		diam=event.box[0].diam();
+	}
+
+	bool unchanged(const BoxEvent& event, const BoxProperties& prop) const {
+		return event.box[0].diam()==diam;
+	}
+
+	double diam;
+	static const long id;
+};
+
+const long BxpDiam::id=next_id();
+
+/*
+ * Counts the calls to another contractor and the calls
+ * with an up-to-date BxpDiam property. The property is
+ * modified (unshared) by each call.
+ */
+class CtcCount : public Ctc {
+public:
+	CtcCount(Ctc& ctc) : Ctc(ctc.nb_var), ctc(ctc), nb_calls(0), nb_props(0) { }
+
+	void contract(IntervalVector& box) {
+		ContractContext context(box);
+		contract(box,context);
+	}
+
+	void contract(IntervalVector& box, ContractContext& context) {
+		nb_calls++;
+		BxpDiam* p=(BxpDiam*) context.prop[BxpDiam::id];
+		if (p && p->diam==box[0].diam()) {
+			nb_props++;
+			p->diam=-1;
+		}
+		ctc.contract(box,context);
+	}
+
+	Ctc& ctc;
+	int nb_calls;
+	int nb_props;
+};
+
+/*
+ * Records the threads that call another contractor.
+ */
+class CtcThreadId : public Ctc {
+public:
+	CtcThreadId(Ctc& ctc, Mutex& mutex, set<std::thread::id>& ids) : Ctc(ctc.nb_var), ctc(ctc), mutex(mutex), ids(ids) { }
+
+	void contract(IntervalVector& box) {
+		ContractContext context(box);
+		contract(box,context);
+	}
+
+	void contract(IntervalVector& box, ContractContext& context) {
+		{
+			Lock lock(mutex);
+			ids.insert(std::this_thread::get_id());
+		}
+		ctc.contract(box,context);
+	}
+
+	Ctc& ctc;
+	Mutex& mutex;
+	set<std::thread::id>& ids;
+};
+
+}
+
+void TestLookahead::choose01() {
+	Variable x,y;
+	Function f(x,y,y-sqr(x));
+	CtcFwdBwd ctc(f);
+	RoundRobin rr(0,0.5);
+	Lookahead bsc(rr,ctc,2);
+
+	IntervalVector box(2);
+	box[0]=Interval(-1,1);
+	box[1]=Interval(0,1);
+	Cell c(box);
+
+	// round-robin would bisect x, which gives no contraction
+	CPPUNIT_ASSERT(rr.choose_var(c).var==0);
+	CPPUNIT_ASSERT(bsc.choose_var(c).var==1);
+
+	pair<Cell*,Cell*> p=bsc.bisect(c);
+	CPPUNIT_ASSERT(p.first->bisected_var==1);
+	CPPUNIT_ASSERT(p.first->depth==1);
+	CPPUNIT_ASSERT(almost_eq(p.first->box[1],Interval(0,0.5),0));
+	// the children are contracted
+	CPPUNIT_ASSERT(almost_eq(p.first->box[0],Interval(-::sqrt(0.5),::sqrt(0.5)),1e-10));
+	CPPUNIT_ASSERT(almost_eq(p.second->box[0],Interval(-1,1),0));
+	CPPUNIT_ASSERT(almost_eq(p.second->box[1],Interval(0.5,1),0));
+	delete p.first;
+	delete p.second;
+}
+
+void TestLookahead::depth01() {
+	Variable x,y;
+	Function f(x,y,y-sqr(x));
+	CtcFwdBwd ctc(f);
+	RoundRobin rr(0,0.5);
+	Lookahead bsc(rr,ctc,2,3);
+
+	IntervalVector box(2);
+	box[0]=Interval(-1,1);
+	box[1]=Interval(0,1);
+
+	// no lookahead from depth 3
+	Cell c(box,-1,3);
+	CPPUNIT_ASSERT(bsc.choose_var(c).var==0);
+
+	pair<Cell*,Cell*> p=bsc.bisect(c);
+	CPPUNIT_ASSERT(almost_eq(p.first->box[0],Interval(-1,0),0));
+	CPPUNIT_ASSERT(almost_eq(p.first->box[1],Interval(0,1),0));
+	delete p.first;
+	delete p.second;
+}
+
+void TestLookahead::threads01() {
+	Variable x,y,z;
+	Function f(x,y,z,y-sqr(x)-z);
+	Function f2(f,Function::COPY);
+	CtcFwdBwd ctc(f);
+	CtcFwdBwd ctc2(f2);
+	Array<Ctc> ctcs(ctc,ctc2);
+	RoundRobin rr(0,0.5);
+	Lookahead bsc1(rr,ctc,3);
+	Lookahead bsc2(rr,ctcs,3);
+
+	IntervalVector box(3);
+	box[0]=Interval(-1,1);
+	box[1]=Interval(0,2);
+	box[2]=Interval(0,1);
+	Cell c(box);
+
+	pair<Cell*,Cell*> p1=bsc1.bisect(c);
+	pair<Cell*,Cell*> p2=bsc2.bisect(c);
+	CPPUNIT_ASSERT(p1.first->bisected_var==p2.first->bisected_var);
+	CPPUNIT_ASSERT(almost_eq(p1.first->box,p2.first->box,0));
+	CPPUNIT_ASSERT(almost_eq(p1.second->box,p2.second->box,0));
+	delete p1.first;
+	delete p1.second;
+	delete p2.first;
+	delete p2.second;
+}
+
+void TestLookahead::cache01() {
+	Variable x,y;
+	Function f(x,y,y-sqr(x));
+	CtcFwdBwd fwdbwd(f);
+	CtcCount ctc(fwdbwd);
+	RoundRobin rr(0,0.5);
+	Lookahead bsc(rr,ctc,2);
+
+	IntervalVector box(2);
+	box[0]=Interval(-1,1);
+	box[1]=Interval(0,1);
+	Cell c(box);
+
+	// the children calculated by choose_var are reused by bisect
+	CPPUNIT_ASSERT(bsc.choose_var(c).var==1);
+	CPPUNIT_ASSERT(ctc.nb_calls==4);
+	CPPUNIT_ASSERT(bsc.choose_var(c).var==1);
+	CPPUNIT_ASSERT(ctc.nb_calls==4);
+
+	pair<Cell*,Cell*> p=bsc.bisect(c);
+	CPPUNIT_ASSERT(ctc.nb_calls==4);
+	CPPUNIT_ASSERT(p.first->bisected_var==1);
+	CPPUNIT_ASSERT(almost_eq(p.first->box[0],Interval(-::sqrt(0.5),::sqrt(0.5)),1e-10));
+	delete p.first;
+	delete p.second;
+
+	// but not twice
+	p=bsc.bisect(c);
+	CPPUNIT_ASSERT(ctc.nb_calls==8);
+	delete p.first;
+	delete p.second;
+
+	// nor if the box has changed
+	CPPUNIT_ASSERT(bsc.choose_var(c).var==1);
+	CPPUNIT_ASSERT(ctc.nb_calls==12);
+	c.box[1]=Interval(0,0.5);
+	p=bsc.bisect(c);
+	CPPUNIT_ASSERT(ctc.nb_calls==16);
+	delete p.first;
+	delete p.second;
+}
+
+void TestLookahead::prop01() {
+	Variable x,y;
+	Function f(x,y,y-sqr(x));
+	CtcFwdBwd fwdbwd(f);
+	CtcCount ctc(fwdbwd);
+	RoundRobin rr(0,0.5);
+	Lookahead bsc(rr,ctc,2);
+
+	IntervalVector box(2);
+	box[0]=Interval(-1,1);
+	box[1]=Interval(0,1);
+	Cell c(box);
+	c.prop.add(new BxpDiam(c.box));
+
+	// the children are contracted with the properties of the cell
+	pair<Cell*,Cell*> p=bsc.bisect(c);
+	CPPUNIT_ASSERT(ctc.nb_calls==4);
+	CPPUNIT_ASSERT(ctc.nb_props==4);
+
+	// the cell is unchanged
+	CPPUNIT_ASSERT(((const BxpDiam*) ((const BoxProperties&) c.prop)[BxpDiam::id])->diam==2);
+	delete p.first;
+	delete p.second;
+}
+
+void TestLookahead::threads02() {
+	Variable x,y,z;
+	Function f(x,y,z,y-sqr(x)-z);
+	Function* fs[4];
+	CtcFwdBwd* fwdbwd[4];
+	Array<Ctc> ctcs(4);
+	for (int i=0; i<4; i++) {
+		fs[i]=new Function(f,Function::COPY);
+		fwdbwd[i]=new CtcFwdBwd(*fs[i]);
+		ctcs.set_ref(i, *new CtcCount(*fwdbwd[i]));
+	}
+	RoundRobin rr(0,0.5);
+	Lookahead bsc(rr,ctcs,3);
+
+	IntervalVector box(3);
+	box[0]=Interval(-1,1);
+	box[1]=Interval(0,2);
+	box[2]=Interval(0,1);
+
+	// the value of the property is shared by the children (when
+	// the first variable is not bisected) and unshared by the threads
+	for (int k=0; k<100; k++) {
+		Cell c(box);
+		c.prop.add(new BxpDiam(c.box));
+		pair<Cell*,Cell*> p=bsc.bisect(c);
+		delete p.first;
+		delete p.second;
+	}
+
+	int nb_calls=0, nb_props=0;
+	for (int i=0; i<4; i++) {
+		CtcCount& ctc=(CtcCount&) ctcs[i];
+		nb_calls += ctc.nb_calls;
+		nb_props += ctc.nb_props;
+		delete &ctc;
+		delete fwdbwd[i];
+		delete fs[i];
+	}
+	CPPUNIT_ASSERT(nb_calls==600);
+	CPPUNIT_ASSERT(nb_props==600);
+}
+
+void TestLookahead::threads03() {
+	Variable x,y,z;
+	Function f(x,y,z,y-sqr(x)-z);
+	Function* fs[4];
+	CtcFwdBwd* fwdbwd[4];
+	Mutex mutex;
+	set<std::thread::id> ids;
+	Array<Ctc> ctcs(4);
+	for (int i=0; i<4; i++) {
+		fs[i]=new Function(f,Function::COPY);
+		fwdbwd[i]=new CtcFwdBwd(*fs[i]);
+		ctcs.set_ref(i, *new CtcThreadId(*fwdbwd[i],mutex,ids));
+	}
+
+	IntervalVector box(3);
+	box[0]=Interval(-1,1);
+	box[1]=Interval(0,2);
+	box[2]=Interval(0,1);
+
+	{
+		RoundRobin rr(0,0.5);
+		Lookahead bsc(rr,ctcs,3);
+
+		// the threads are not created again at each bisection
+		for (int k=0; k<20; k++) {
+			Cell c(box);
+			pair<Cell*,Cell*> p=bsc.bisect(c);
+			delete p.first;
+			delete p.second;
+		}
+	}
+
+	CPPUNIT_ASSERT(ids.size()==4);
+	CPPUNIT_ASSERT(ids.count(std::this_thread::get_id())==1);
+
+	for (int i=0; i<4; i++) {
+		delete &ctcs[i];
+		delete fwdbwd[i];
+		delete fs[i];
+	}
+}
+
+} // namespace ibex
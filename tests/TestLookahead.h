@@ -0,0 +1,48 @@
+//============================================================================
+//                                  I B E X
+// File        : TestLookahead.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __TEST_LOOKAHEAD_H__
+#define __TEST_LOOKAHEAD_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestLookahead : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestLookahead);
+	CPPUNIT_TEST(choose01);
+	CPPUNIT_TEST(depth01);
+	CPPUNIT_TEST(threads01);
+	CPPUNIT_TEST(cache01);
+	CPPUNIT_TEST(prop01);
+	CPPUNIT_TEST(threads02);
+	CPPUNIT_TEST(threads03);
+	CPPUNIT_TEST_SUITE_END();
+
+	void choose01();
+	void depth01();
+	void threads01();
+	void cache01();
+	void prop01();
+	void threads02();
+	void threads03();
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLookahead);
+
+
+} // namespace ibex
+
+#endif // __TEST_LOOKAHEAD_H__
@@ -0,0 +1,201 @@
+//============================================================================
+//                                  I B E X
+// File        : TestLoupBudget.cpp
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "TestLoupBudget.h"
+#include "ibex_LoupBudget.h"
+#include "ibex_LoupFinderCertify.h"
+#include "ibex_Optimizer.h"
+#include "ibex_SystemFactory.h"
+#include "ibex_ExtendedSystem.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_OptimLargestFirst.h"
+#include "ibex_CellDoubleHeap.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// run a method "nb" times when allowed and
+// return the number of refused attempts
+int run(LoupBudget& budget, int level, LoupBudget::Region region, bool success, int nb) {
+	int refused=0;
+	for (int i=0; i<nb; i++) {
+		if (budget.allow(0,level,region)) {
+			budget.start();
+			budget.stop(0,level,region,success);
+		} else
+			refused++;
+	}
+	return refused;
+}
+
+// checks the midpoint of the box and records
+// the calls to start()
+class MidpointFinder : public LoupFinder {
+public:
+	MidpointFinder(const System& sys) : sys(sys), nb_starts(0), nb_properties(0), init_box(1) { }
+
+	virtual std::pair<IntervalVector, double> find(const IntervalVector& box, const IntervalVector& loup_point, double loup) {
+		Vector pt=box.mid();
+		if (check(sys,pt,loup,false))
+			return make_pair(pt,loup);
+		else
+			throw NotFound();
+	}
+
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& prop) {
+		nb_properties++;
+	}
+
+	virtual void start(const IntervalVector& init_box) {
+		nb_starts++;
+		this->init_box.resize(init_box.size());
+		this->init_box=init_box;
+	}
+
+	const System& sys;
+	int nb_starts;
+	int nb_properties;
+	IntervalVector init_box;
+};
+
+}
+
+void TestLoupBudget::level01() {
+	LoupBudget budget(1,0);
+	budget.reset(IntervalVector(2,Interval(0,8)));
+
+	CPPUNIT_ASSERT(budget.level(IntervalVector(2,Interval(0,8)))==0);
+	CPPUNIT_ASSERT(budget.level(IntervalVector(2,Interval(0,4)))==1);
+	CPPUNIT_ASSERT(budget.level(IntervalVector(2,Interval(0,1)))==2);
+	CPPUNIT_ASSERT(budget.level(IntervalVector(2,Interval(1,1)))==LoupBudget::nb_levels-1);
+
+	// unbounded initial domains are ignored
+	budget.reset(IntervalVector({{0,8},{0,POS_INFINITY}}));
+	CPPUNIT_ASSERT(budget.level(IntervalVector({{0,4},{0,1}}))==1);
+}
+
+void TestLoupBudget::region01() {
+	CPPUNIT_ASSERT(LoupBudget::region(Interval(0,1),2)==LoupBudget::IMPROVING);
+	CPPUNIT_ASSERT(LoupBudget::region(Interval(0,4),3)==LoupBudget::CLOSE);
+	CPPUNIT_ASSERT(LoupBudget::region(Interval(0,4),1)==LoupBudget::FAR);
+	CPPUNIT_ASSERT(LoupBudget::region(Interval(NEG_INFINITY,4),1)==LoupBudget::CLOSE);
+	CPPUNIT_ASSERT(LoupBudget::region(Interval(0,4),POS_INFINITY)==LoupBudget::IMPROVING);
+	CPPUNIT_ASSERT(LoupBudget::region(Interval::empty_set(),1)==LoupBudget::FAR);
+}
+
+void TestLoupBudget::disabled01() {
+	LoupBudget budget(1);
+	budget.reset(IntervalVector(1,Interval(0,1)));
+
+	CPPUNIT_ASSERT(!budget.enabled());
+	CPPUNIT_ASSERT(run(budget,3,LoupBudget::FAR,false,100)==0);
+	CPPUNIT_ASSERT(budget.nb_trials(0)==0);
+}
+
+void TestLoupBudget::throttle01() {
+	LoupBudget budget(1,0);
+	budget.reset(IntervalVector(1,Interval(0,1)));
+
+	// no throttling before min_trials attempts
+	CPPUNIT_ASSERT(run(budget,3,LoupBudget::FAR,false,LoupBudget::min_trials)==0);
+
+	// a method that always fails is rarely run
+	int refused=run(budget,3,LoupBudget::FAR,false,100);
+	CPPUNIT_ASSERT(refused>80);
+	CPPUNIT_ASSERT(refused<100);
+	CPPUNIT_ASSERT(budget.nb_skipped(0)==refused);
+	CPPUNIT_ASSERT(budget.nb_successes(0)==0);
+
+	// but still run in other slots...
+	CPPUNIT_ASSERT(run(budget,2,LoupBudget::FAR,false,LoupBudget::min_trials)==0);
+	// ... and always when the box is improving
+	CPPUNIT_ASSERT(run(budget,3,LoupBudget::IMPROVING,false,100)==0);
+}
+
+void TestLoupBudget::throttle02() {
+	LoupBudget budget(1,0);
+	budget.reset(IntervalVector(1,Interval(0,1)));
+
+	// a method that always succeeds is (almost) always run
+	CPPUNIT_ASSERT(run(budget,3,LoupBudget::CLOSE,true,LoupBudget::min_trials)==0);
+	CPPUNIT_ASSERT(run(budget,3,LoupBudget::CLOSE,true,100)<10);
+	CPPUNIT_ASSERT(budget.nb_successes(0)==budget.nb_trials(0));
+}
+
+void TestLoupBudget::warm_start01() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(x+y>=1);
+	f.add_goal(sqr(x)+sqr(y));
+	System sys(f);
+	ExtendedSystem ext_sys(sys);
+
+	CtcHC4 hc4(ext_sys);
+	OptimLargestFirst bsc(ext_sys.goal_var(),true,1e-8);
+	CellDoubleHeap buffer(ext_sys);
+	MidpointFinder finder(sys);
+	IntervalVector init_box(2,Interval(-10,10));
+
+	// stop early to leave pending boxes
+	Optimizer o1(2, hc4, bsc, finder, buffer, ext_sys.goal_var(), 1e-8, 1e-1, 1e-1);
+	o1.anticipated_upper_bounding=false;
+	o1.optimize(init_box);
+	CPPUNIT_ASSERT(finder.nb_starts==1);
+	CPPUNIT_ASSERT(finder.init_box==init_box);
+
+	const CovOptimData& data=o1.get_data();
+	CPPUNIT_ASSERT(data.size()>2);
+
+	// resume the search: start() is called once, with the
+	// hull of the pending boxes (without the objective)
+	finder.nb_starts=finder.nb_properties=0;
+	Optimizer o2(2, hc4, bsc, finder, buffer, ext_sys.goal_var(), 1e-8, 1e-3, 1e-3);
+	CPPUNIT_ASSERT(o2.optimize(data)==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(finder.nb_properties>1);
+	CPPUNIT_ASSERT(finder.nb_starts==1);
+	CPPUNIT_ASSERT(finder.init_box.size()==2);
+	CPPUNIT_ASSERT(init_box.is_strict_superset(finder.init_box));
+}
+
+void TestLoupBudget::warm_start02() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(x+y>=1);
+	f.add_goal(sqr(x)+sqr(y));
+	System sys(f);
+
+	MidpointFinder finder(sys);
+	LoupFinderCertify certify(sys,finder);
+	certify.budget.set_fraction(0);
+
+	IntervalVector init_box(2,Interval(0,8));
+	certify.start(init_box);
+	CPPUNIT_ASSERT(finder.nb_starts==1);
+
+	// the properties of extended boxes loaded from a COV
+	// file do not reset the budget
+	for (int i=0; i<3; i++) {
+		IntervalVector ext_box(3,Interval(0,1));
+		BoxProperties prop(ext_box);
+		certify.add_property(ext_box,prop);
+	}
+	CPPUNIT_ASSERT(finder.nb_properties==3);
+	CPPUNIT_ASSERT(certify.budget.level(IntervalVector(2,Interval(0,1)))==2);
+}
+
+} // namespace ibex
@@ -0,0 +1,48 @@
+//============================================================================
+//                                  I B E X
+// File        : TestLoupBudget.h
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __TEST_LOUP_BUDGET_H__
+#define __TEST_LOUP_BUDGET_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestLoupBudget : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestLoupBudget);
+	CPPUNIT_TEST(level01);
+	CPPUNIT_TEST(region01);
+	CPPUNIT_TEST(disabled01);
+	CPPUNIT_TEST(throttle01);
+	CPPUNIT_TEST(throttle02);
+	CPPUNIT_TEST(warm_start01);
+	CPPUNIT_TEST(warm_start02);
+	CPPUNIT_TEST_SUITE_END();
+
+	void level01();
+	void region01();
+	void disabled01();
+	void throttle01();
+	void throttle02();
+	void warm_start01();
+	void warm_start02();
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLoupBudget);
+
+
+} // namespace ibex
+
+#endif // __TEST_LOUP_BUDGET_H__
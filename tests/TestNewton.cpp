@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Jun 10, 2012
-// Last Update : Jun 10, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "TestNewton.h"
@@ -100,6 +100,36 @@ void TestNewton::newton01() {
 	CPPUNIT_ASSERT(almost_eq(box,expected,1e-10));
 }
 
+void TestNewton::newton02() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+	BoxProperties prop(box);
+	long id=next_id();
+	prop.add(new BxpPrecond(id,30));
+	const BxpPrecond* precond0=(const BxpPrecond*) ((const BoxProperties&) prop)[id];
+
+	// the matrix is calculated (the property is unshared)
+	IntervalVector box1(box);
+	BoxProperties prop1(box1,prop);
+	newton(*p30.f,box1,prop1,id);
+	const BxpPrecond* precond=(const BxpPrecond*) ((const BoxProperties&) prop1)[id];
+	CPPUNIT_ASSERT(precond!=precond0);
+	CPPUNIT_ASSERT(!precond0->valid);
+	CPPUNIT_ASSERT(precond->valid);
+
+	IntervalVector expected(30,BOX2);
+	CPPUNIT_ASSERT(almost_eq(box1,expected,1e-10));
+
+	// the matrix is reused for a sub-box,
+	// without being copied
+	IntervalVector box2(30,BOX1);
+	box2 &= expected+IntervalVector(30,Interval(-1e-4,1e-4));
+	BoxProperties prop2(box2,prop1);
+	newton(*p30.f,box2,prop2,id);
+	CPPUNIT_ASSERT(((const BoxProperties&) prop2)[id]==precond);
+	CPPUNIT_ASSERT(almost_eq(box2,expected,1e-10));
+}
+
 void TestNewton::inflating_newton01() {
 	Ponts30 p30;
 	double eps=1e-2;
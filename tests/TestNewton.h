@@ -14,6 +14,7 @@
 #include <cppunit/TestFixture.h>
 #include <cppunit/extensions/HelperMacros.h>
 #include "ibex_Newton.h"
+#include "ibex_BxpPrecond.h"
 #include "utils.h"
 
 namespace ibex {
@@ -25,6 +26,7 @@ public:
 	CPPUNIT_TEST_SUITE(TestNewton);
 
 	CPPUNIT_TEST(newton01);
+	CPPUNIT_TEST(newton02);
 	CPPUNIT_TEST(inflating_newton01);
 	CPPUNIT_TEST(inflating_newton02);
 	CPPUNIT_TEST(ctc_parameter01);
@@ -32,6 +34,7 @@ public:
 	CPPUNIT_TEST_SUITE_END();
 
 	void newton01();
+	void newton02();
 	void inflating_newton01();
 	void inflating_newton02();
 	void ctc_parameter01();
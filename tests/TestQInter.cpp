@@ -0,0 +1,127 @@
+/* ============================================================================
+ * I B E X - Q-intersection Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestQInter.h"
+#include "ibex_QInter.h"
+#include "ibex_Random.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+void random_boxes(Array<IntervalVector>& boxes, int n) {
+	for (int j=0; j<boxes.size(); j++) {
+		IntervalVector& box=boxes[j];
+		for (int i=0; i<n; i++) {
+			double lb=RNG::rand(0,10);
+			box[i]=Interval(lb,lb+RNG::rand(0,5));
+		}
+	}
+}
+
+}
+
+void TestQInter::qinter01() {
+	double _b1[][2]={{0,2},{0,2}};
+	double _b2[][2]={{1,3},{1,3}};
+	double _b3[][2]={{1.5,4},{-1,0.5}};
+	IntervalVector b1(2,_b1), b2(2,_b2), b3(2,_b3);
+	Array<IntervalVector> boxes(b1,b2,b3);
+
+	double _res2[][2]={{1,2},{0,2}};
+	CPPUNIT_ASSERT(qinter(boxes,2)==IntervalVector(2,_res2));
+	CPPUNIT_ASSERT(qinter(boxes,3).is_empty());
+
+	double _res1[][2]={{0,4},{-1,3}};
+	CPPUNIT_ASSERT(qinter(boxes,1)==IntervalVector(2,_res1));
+}
+
+void TestQInter::qinter02() {
+	Array<IntervalVector> boxes(4);
+	for (int j=0; j<4; j++)
+		boxes.set_ref(j,*new IntervalVector(1,Interval(j,j+2)));
+
+	CPPUNIT_ASSERT(qinter(boxes,2)==IntervalVector(1,Interval(1,4)));
+	CPPUNIT_ASSERT(qinter(boxes,3).is_empty());
+
+	for (int j=0; j<4; j++) delete &boxes[j];
+}
+
+void TestQInter::empty01() {
+	double _b1[][2]={{0,2},{0,2}};
+	double _b2[][2]={{1,3},{1,3}};
+	IntervalVector b1(2,_b1), b2(IntervalVector::empty(2)), b3(2,_b2);
+	Array<IntervalVector> boxes(b1,b2,b3);
+
+	double _res[][2]={{1,2},{1,2}};
+	CPPUNIT_ASSERT(qinter(boxes,2)==IntervalVector(2,_res));
+	CPPUNIT_ASSERT(qinter(boxes,3).is_empty());
+}
+
+void TestQInter::degenerated01() {
+	// the boxes only share a facet
+	double _b1[][2]={{0,1},{0,1}};
+	double _b2[][2]={{1,2},{0,1}};
+	IntervalVector b1(2,_b1), b2(2,_b2);
+	Array<IntervalVector> boxes(b1,b2);
+
+	double _res[][2]={{1,1},{0,1}};
+	CPPUNIT_ASSERT(qinter(boxes,2)==IntervalVector(2,_res));
+}
+
+void TestQInter::random01() {
+	RNG::srand(1);
+
+	for (int n=1; n<=3; n++) {
+		int p=20;
+		Array<IntervalVector> boxes(p);
+		for (int j=0; j<p; j++) boxes.set_ref(j,*new IntervalVector(n));
+
+		for (int k=0; k<10; k++) {
+			random_boxes(boxes,n);
+			for (int q=1; q<=6; q++) {
+				CPPUNIT_ASSERT(qinter(boxes,q)==qinter_grid(boxes,q));
+			}
+		}
+
+		for (int j=0; j<p; j++) delete &boxes[j];
+	}
+}
+
+void TestQInter::reuse01() {
+	RNG::srand(2);
+	int n=2;
+	int p=30;
+	int q=5;
+
+	Array<IntervalVector> boxes(p);
+	for (int j=0; j<p; j++) boxes.set_ref(j,*new IntervalVector(n));
+	random_boxes(boxes,n);
+
+	QInter engine;
+
+	// boxes shrinking from one call to the other
+	for (int k=0; k<10; k++) {
+		CPPUNIT_ASSERT(engine.qinter(boxes,q)==qinter_grid(boxes,q));
+		for (int j=0; j<p; j++) {
+			if (j%7==k%7)
+				boxes[j].set_empty();
+			else
+				for (int i=0; i<n; i++)
+					boxes[j][i]=Interval(boxes[j][i].lb()+RNG::rand(0,0.2),boxes[j][i].ub()-RNG::rand(0,0.2));
+		}
+	}
+
+	for (int j=0; j<p; j++) delete &boxes[j];
+}
+
+} // namespace ibex
@@ -0,0 +1,45 @@
+/* ============================================================================
+ * I B E X - Q-intersection Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_QINTER_H__
+#define __TEST_QINTER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestQInter : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestQInter);
+	CPPUNIT_TEST(qinter01);
+	CPPUNIT_TEST(qinter02);
+	CPPUNIT_TEST(empty01);
+	CPPUNIT_TEST(degenerated01);
+	CPPUNIT_TEST(random01);
+	CPPUNIT_TEST(reuse01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void qinter01();
+	void qinter02();
+	void empty01();
+	void degenerated01();
+	void random01();
+	void reuse01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestQInter);
+
+} // namespace ibex
+
+#endif // __TEST_QINTER_H__
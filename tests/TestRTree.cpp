@@ -0,0 +1,100 @@
+/* ============================================================================
+ * I B E X - R-tree Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestRTree.h"
+#include "ibex_RTree.h"
+#include "ibex_Random.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+IntervalVector random_box(int n, double max_diam) {
+	IntervalVector box(n);
+	for (int i=0; i<n; i++) {
+		double lb=RNG::rand(0,10);
+		box[i]=Interval(lb,lb+RNG::rand(0,max_diam));
+	}
+	return box;
+}
+
+// check the result of a query against a linear scan
+bool check(const RTree& tree, const vector<IntervalVector>& boxes, const IntervalVector& query) {
+	int id=tree.find_superset(query);
+	if (id>=0) return boxes[id].is_superset(query);
+	for (vector<IntervalVector>::const_iterator it=boxes.begin(); it!=boxes.end(); ++it)
+		if (it->is_superset(query)) return false;
+	return true;
+}
+
+}
+
+void TestRTree::empty() {
+	RTree tree;
+	CPPUNIT_ASSERT(tree.size()==0);
+	CPPUNIT_ASSERT(tree.find_superset(IntervalVector(2,Interval(0,1)))==-1);
+}
+
+void TestRTree::random() {
+	RNG::srand(1);
+	int n=3;
+	vector<IntervalVector> boxes;
+	RTree tree(4);
+
+	for (int k=0; k<500; k++) {
+		boxes.push_back(random_box(n,3));
+		tree.insert(boxes.back(),k);
+	}
+	CPPUNIT_ASSERT(tree.size()==500);
+
+	// each box is found
+	for (int k=0; k<500; k++) {
+		int id=tree.find_superset(boxes[k]);
+		CPPUNIT_ASSERT(id>=0 && boxes[id].is_superset(boxes[k]));
+	}
+
+	int nb_found=0;
+	for (int k=0; k<2000; k++) {
+		IntervalVector query=random_box(n,0.5);
+		CPPUNIT_ASSERT(check(tree,boxes,query));
+		if (tree.find_superset(query)>=0) nb_found++;
+	}
+	// make sure both cases are tested
+	CPPUNIT_ASSERT(nb_found>0 && nb_found<2000);
+
+	tree.clear();
+	CPPUNIT_ASSERT(tree.size()==0);
+	CPPUNIT_ASSERT(tree.find_superset(boxes[0])==-1);
+}
+
+void TestRTree::copy() {
+	RNG::srand(2);
+	vector<IntervalVector> boxes;
+	RTree tree;
+	for (int k=0; k<100; k++) {
+		boxes.push_back(random_box(2,2));
+		tree.insert(boxes.back(),k);
+	}
+
+	RTree tree2(tree);
+	boxes.push_back(random_box(2,2));
+	tree2.insert(boxes.back(),100);
+	CPPUNIT_ASSERT(tree.size()==100);
+	CPPUNIT_ASSERT(tree2.size()==101);
+
+	for (int k=0; k<500; k++) {
+		IntervalVector query=random_box(2,0.5);
+		CPPUNIT_ASSERT(check(tree2,boxes,query));
+	}
+}
+
+} // end namespace
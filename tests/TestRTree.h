@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - R-tree Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_RTREE_H__
+#define __TEST_RTREE_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestRTree : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestRTree);
+	CPPUNIT_TEST(empty);
+	CPPUNIT_TEST(random);
+	CPPUNIT_TEST(copy);
+	CPPUNIT_TEST_SUITE_END();
+
+	void empty();
+	void random();
+	void copy();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestRTree);
+
+} // namespace ibex
+
+#endif // __TEST_RTREE_H__
@@ -0,0 +1,212 @@
+/* ============================================================================
+ * I B E X - Search telemetry Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSearchTelemetry.h"
+#include "ibex_SearchTelemetry.h"
+#include "ibex_Solver.h"
+#include "ibex_Optimizer.h"
+#include "ibex_SystemFactory.h"
+#include "ibex_ExtendedSystem.h"
+#include "ibex_NormalizedSystem.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CellStack.h"
+#include "ibex_LoupFinderFwdBwd.h"
+#include "ibex_CellDoubleHeap.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+char* tmp_file() { // return char* must be freed
+	char *tmpname = (char*) malloc(L_tmpnam);
+	char* ret=tmpnam(tmpname);
+	assert(ret!=NULL);
+	return tmpname;
+}
+
+void remove_file(char* filename) {
+	remove(filename);
+	free(filename);
+}
+
+// read all the lines of a JSON-lines file with a given event
+vector<string> events(const char* filename, const string& event) {
+	ifstream f(filename);
+	vector<string> lines;
+	string line;
+	while (getline(f,line)) {
+		if (line.find("{\"event\":\""+event+"\"")==0)
+			lines.push_back(line);
+	}
+	return lines;
+}
+
+// value of an integer field in a JSON line (-1 if absent)
+long value(const string& line, const string& key) {
+	size_t pos=line.find("\""+key+"\":");
+	if (pos==string::npos) return -1;
+	return atol(line.c_str()+pos+key.size()+3);
+}
+
+// sum of an integer field over all the "depth" events
+long sum(const vector<string>& lines, const string& key) {
+	long s=0;
+	for (vector<string>::const_iterator it=lines.begin(); it!=lines.end(); ++it)
+		s+=value(*it,key);
+	return s;
+}
+
+System* circle_sys() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(sqr(x-1)+sqr(y)=1);
+	return new System(f);
+}
+
+}
+
+void TestSearchTelemetry::solver() {
+	char* filename=tmp_file();
+
+	System* sys=circle_sys();
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcFwdBwd c0(sys->ctrs[0]);
+	CtcFwdBwd c1(sys->ctrs[1]);
+	CtcCompo compo(c0,c1);
+	Vector prec(2,1e-3);
+	Solver solver(*sys,compo,rr,stack,prec,prec);
+
+	SearchTelemetry* telemetry=new SearchTelemetry(filename);
+	telemetry->set_name(c0,"circle0");
+	telemetry->set_name(c1,"circle1");
+	solver.telemetry=telemetry;
+
+	CPPUNIT_ASSERT(solver.solve(IntervalVector(2,Interval(-10,10)))==Solver::SUCCESS);
+	delete telemetry;
+
+	CPPUNIT_ASSERT(events(filename,"start").size()==1);
+	CPPUNIT_ASSERT(events(filename,"end").size()==1);
+
+	vector<string> depth=events(filename,"depth");
+	CPPUNIT_ASSERT(!depth.empty());
+	CPPUNIT_ASSERT(value(depth[0],"depth")==0);
+	CPPUNIT_ASSERT(value(depth[0],"cells")==1);
+	long cells=sum(depth,"cells");
+	CPPUNIT_ASSERT(cells==(long) solver.get_nb_cells());
+	CPPUNIT_ASSERT(value(events(filename,"end")[0],"cells")==cells);
+	CPPUNIT_ASSERT(sum(depth,"solution")==2);
+	CPPUNIT_ASSERT(sum(depth,"loup")==0);
+
+	// every cell is either bisected or closed
+	long closed=0;
+	for (int i=0; i<SearchTelemetry::NB_CAUSES; i++)
+		closed+=sum(depth,SearchTelemetry::cause_name[i]);
+	CPPUNIT_ASSERT(cells==1+2*(cells-closed));
+
+	// boxes emptied by the contractor are assigned to the sub-contractors
+	vector<string> ctc=events(filename,"contractor");
+	CPPUNIT_ASSERT(!ctc.empty());
+	long emptied=0;
+	for (vector<string>::const_iterator it=ctc.begin(); it!=ctc.end(); ++it) {
+		CPPUNIT_ASSERT(it->find("\"name\":\"circle")!=string::npos);
+		emptied+=value(*it,"emptied");
+	}
+	CPPUNIT_ASSERT(emptied==sum(depth,"contractor"));
+
+	delete sys;
+	remove_file(filename);
+}
+
+void TestSearchTelemetry::optimizer() {
+	char* filename=tmp_file();
+
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(3));
+	SystemFactory f;
+	f.add_var(x);
+	f.add_ctr(x[0]*x[1]*x[2]>=1);
+	f.add_goal(x*x);
+	System sys(f);
+
+	ExtendedSystem ext(sys);
+	NormalizedSystem norm(sys);
+	CtcHC4 ctc(ext);
+	RoundRobin bsc(1e-08);
+	LoupFinderFwdBwd finder(norm);
+	CellDoubleHeap buffer(ext);
+	Optimizer optim(sys.nb_var, ctc, bsc, finder, buffer, ext.goal_var());
+
+	SearchTelemetry telemetry(filename);
+	telemetry.sample_period=0; // record all bounds updates
+	optim.telemetry=&telemetry;
+
+	CPPUNIT_ASSERT(optim.optimize(IntervalVector(3,Interval(0,10)))==Optimizer::SUCCESS);
+
+	telemetry.end();
+
+	vector<string> bounds=events(filename,"bounds");
+	CPPUNIT_ASSERT(!bounds.empty());
+	// the last bounds are the final ones
+	CPPUNIT_ASSERT(bounds.back().find("\"loup\":null")==string::npos);
+	CPPUNIT_ASSERT(bounds.back().find("\"uplo\":null")==string::npos);
+	CPPUNIT_ASSERT(!events(filename,"buffer").empty());
+
+	vector<string> depth=events(filename,"depth");
+	CPPUNIT_ASSERT(sum(depth,"cells")==(long) optim.get_nb_cells()+1); // +1: root
+	CPPUNIT_ASSERT(sum(depth,"solution")==0);
+
+	remove_file(filename);
+}
+
+void TestSearchTelemetry::binary() {
+	char* filename=tmp_file();
+
+	System* sys=circle_sys();
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(*sys);
+	Vector prec(2,1e-3);
+	Solver solver(*sys,hc4,rr,stack,prec,prec);
+
+	SearchTelemetry* telemetry=new SearchTelemetry(filename,SearchTelemetry::BINARY);
+	solver.telemetry=telemetry;
+	solver.solve(IntervalVector(2,Interval(-10,10)));
+	delete telemetry;
+
+	ifstream f(filename, ios::in | ios::binary);
+	char sig[20];
+	f.read(sig,20);
+	CPPUNIT_ASSERT(strcmp(sig,"IBEX TELEMETRY FILE")==0);
+	uint32_t tag;
+	f.read((char*) &tag, sizeof(tag));
+	CPPUNIT_ASSERT(tag==0); // start
+	f.close();
+
+	delete sys;
+	remove_file(filename);
+}
+
+} // end namespace ibex
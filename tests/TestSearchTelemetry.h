@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - Search telemetry Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SEARCH_TELEMETRY_H__
+#define __TEST_SEARCH_TELEMETRY_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestSearchTelemetry : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestSearchTelemetry);
+	CPPUNIT_TEST(solver);
+	CPPUNIT_TEST(optimizer);
+	CPPUNIT_TEST(binary);
+	CPPUNIT_TEST_SUITE_END();
+
+	void solver();
+	void optimizer();
+	void binary();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSearchTelemetry);
+
+} // namespace ibex
+
+#endif // __TEST_SEARCH_TELEMETRY_H__
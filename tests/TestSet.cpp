@@ -5,12 +5,17 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Aug 18, 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "TestSet.h"
 #include "ibex_Set.h"
 #include "ibex_SetLeaf.h"
 #include "ibex_SetBisect.h"
+#include "ibex_SepFwdBwd.h"
+#include "ibex_CompactSet.h"
+
+#include <sstream>
 
 using namespace std;
 
@@ -420,4 +425,100 @@ void TestSet::diff15() {
 	CPPUNIT_ASSERT(leaf->status==MAYBE);
 
 }
+
+void TestSet::sep_threads01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,sqr(x)+sqr(y)-sin(x*y));
+
+	double eps=0.01;
+
+	SepFwdBwd sep(f,Interval(1,2));
+
+	Set set(IntervalVector(2,Interval(-3,3)));
+	sep.contract(set,eps);
+
+	// one clone per additional thread
+	Function f1(f,Function::COPY);
+	Function f2(f,Function::COPY);
+	Function f3(f,Function::COPY);
+	SepFwdBwd sep1(f1,Interval(1,2));
+	SepFwdBwd sep2(f2,Interval(1,2));
+	SepFwdBwd sep3(f3,Interval(1,2));
+	Array<Sep> clones(sep1,sep2,sep3);
+
+	Set set2(IntervalVector(2,Interval(-3,3)));
+	sep.contract(set2,eps,clones);
+
+	// the pavings must be identical
+	stringstream s1,s2;
+	s1 << set;
+	s2 << set2;
+	CPPUNIT_ASSERT(s1.str()==s2.str());
+	CPPUNIT_ASSERT(s1.str().size()>1000);
+}
+
+namespace {
+
+// record the leaves of a set
+class LeafRecorder : public SetVisitor {
+public:
+	void visit_leaf(const IntervalVector& box, BoolInterval status) {
+		stringstream ss;
+		ss << box << status;
+		leaves += ss.str();
+	}
+	string leaves;
+};
+
+}
+
+void TestSet::compact01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,sqr(x)+sqr(y)-sin(x*y));
+
+	SepFwdBwd sep(f,Interval(1,2));
+	Set set(IntervalVector(2,Interval(-3,3)));
+	sep.contract(set,0.05);
+
+	LeafRecorder r1;
+	set.visit(r1);
+
+	CompactSet cset(set);
+	LeafRecorder r2;
+	cset.visit(r2);
+	CPPUNIT_ASSERT(r1.leaves==r2.leaves);
+	CPPUNIT_ASSERT(!cset.is_empty());
+
+	double _box1[][2]={{0,0.1},{0,0.1}};
+	double _box2[][2]={{-0.3,0.3},{-1.5,-1}};
+	double _box3[][2]={{-0.1,0.1},{1.1,1.2}};
+	IntervalVector box1(2,_box1);
+	IntervalVector box2(2,_box2);
+	IntervalVector box3(2,_box3);
+	CPPUNIT_ASSERT(cset.is_superset(box1)==set.is_superset(box1));
+	CPPUNIT_ASSERT(cset.is_superset(box2)==set.is_superset(box2));
+	CPPUNIT_ASSERT(cset.is_superset(box3)==set.is_superset(box3));
+
+	cset.save("compact01.set");
+
+	for (int map=0; map<2; map++) {
+		CompactSet cset2("compact01.set", map==1);
+		CPPUNIT_ASSERT(cset2.nb_nodes()==cset.nb_nodes());
+		LeafRecorder r3;
+		cset2.visit(r3);
+		CPPUNIT_ASSERT(r1.leaves==r3.leaves);
+
+		// back to the tree representation
+		Set set2(cset2);
+		stringstream s1,s2;
+		s1 << set;
+		s2 << set2;
+		CPPUNIT_ASSERT(s1.str()==s2.str());
+	}
+
+	remove("compact01.set");
+}
+
 } // end namespace ibex
@@ -5,6 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Aug 18, 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __TEST_SET_H__
@@ -36,6 +37,8 @@ public:
 //		CPPUNIT_TEST(diff13);
 //		CPPUNIT_TEST(diff14);
 		CPPUNIT_TEST(diff15);
+		CPPUNIT_TEST(sep_threads01);
+		CPPUNIT_TEST(compact01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void diff01();
@@ -53,6 +56,8 @@ public:
 	void diff13();
 	void diff14();
 	void diff15();
+	void sep_threads01();
+	void compact01();
 
 };
 
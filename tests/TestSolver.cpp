@@ -15,6 +15,12 @@
 #include "ibex_RoundRobin.h"
 #include "ibex_CellStack.h"
 #include "ibex_CtcHC4.h"
+#include "ibex_CovSolverStream.h"
+
+#include <cstdio>
+#include <cassert>
+#include <set>
+#include <sstream>
 
 using namespace std;
 
@@ -204,5 +210,272 @@ void TestSolver::circle4() {
 	CPPUNIT_ASSERT(!res);
 }
 
+namespace {
+
+class CountListener : public SolverListener {
+public:
+	CountListener(int max) : max(max), nb(0), nb_end(0) { }
+
+	bool output(const CovSolverData& data) {
+		nb++;
+		return nb<max;
+	}
+
+	void end(const CovSolverData& data) {
+		nb_end++;
+	}
+
+	int max, nb, nb_end;
+};
+
+// counts the solutions notified
+class SolutionListener : public SolverListener {
+public:
+	SolutionListener() : nb_sol(0) { }
+
+	bool output(const CovSolverData& data) {
+		if (data.size()>0 && data.is_solution(data.size()-1))
+			nb_sol++;
+		return true;
+	}
+
+	int nb_sol;
+};
+
+System* circle1_sys() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(sqr(x-1)+sqr(y)=1);
+	return new System(f);
+}
+
+} // end anonymous namespace
+
+void TestSolver::listener() {
+	System* sys=circle1_sys();
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(*sys);
+	Vector prec(2,1e-3);
+	Solver solver(*sys,hc4,rr,stack,prec,prec);
+
+	CountListener l1(10);
+	solver.add_listener(l1);
+	CPPUNIT_ASSERT(solver.solve(IntervalVector(2,Interval(-10,10)))==Solver::SUCCESS);
+	CPPUNIT_ASSERT(l1.nb==2);
+	CPPUNIT_ASSERT(l1.nb_end==1);
+
+	// the second listener interrupts the search after the first solution
+	CountListener l2(1);
+	solver.add_listener(l2);
+	CPPUNIT_ASSERT(solver.solve(IntervalVector(2,Interval(-10,10)))==Solver::USER_BREAK);
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==1);
+	CPPUNIT_ASSERT(solver.get_data().nb_pending()>0);
+	// solution + pending boxes
+	CPPUNIT_ASSERT(l2.nb==1+(int) solver.get_data().nb_pending());
+	CPPUNIT_ASSERT(l2.nb_end==1);
+
+	delete sys;
+}
+
+void TestSolver::stream() {
+	char *tmpname = (char*) malloc(L_tmpnam);
+	char* ret=tmpnam(tmpname);
+	assert(ret!=NULL);
+
+	System* sys=circle1_sys();
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(*sys);
+	Vector prec(2,1e-3);
+	Solver solver(*sys,hc4,rr,stack,prec,prec);
+	solver.keep_output=false;
+
+	CovSolverStream* out=new CovSolverStream(tmpname);
+	solver.add_listener(*out);
+	CPPUNIT_ASSERT(solver.solve(IntervalVector(2,Interval(-10,10)))==Solver::SUCCESS);
+	CPPUNIT_ASSERT(solver.get_data().size()==0);
+	delete out;
+
+	CovSolverData* data=CovSolverStream::read(tmpname);
+	CPPUNIT_ASSERT(data->solver_status()==(unsigned int) Solver::SUCCESS);
+	CPPUNIT_ASSERT(data->nb_solution()==2);
+	CPPUNIT_ASSERT(data->nb_cells()==solver.get_data().nb_cells());
+	CPPUNIT_ASSERT(data->var_names().size()==2);
+	CPPUNIT_ASSERT(data->var_names()[0]=="x");
+
+	double _sol1[]={0.5,-::sqrt(3)/2};
+	double _sol2[]={0.5,::sqrt(3)/2};
+	CPPUNIT_ASSERT(data->solution(0).is_superset(Vector(2,_sol1)));
+	CPPUNIT_ASSERT(data->solution(1).is_superset(Vector(2,_sol2)));
+	delete data;
+
+	// the solver can be restarted from a stream (here, an interrupted one)
+	out=new CovSolverStream(tmpname);
+	Solver solver2(*sys,hc4,rr,stack,prec,prec);
+	solver2.add_listener(*out);
+	solver2.start(IntervalVector(2,Interval(-10,10)));
+	CovSolverData::BoxStatus status;
+	CPPUNIT_ASSERT(solver2.next(status));
+	solver2.flush(); // pending boxes are streamed
+	out->flush();
+
+	data=CovSolverStream::read(tmpname); // no "end" record
+	CPPUNIT_ASSERT(data->solver_status()==(unsigned int) Solver::USER_BREAK);
+	CPPUNIT_ASSERT(data->nb_solution()==0); // first box not notified by next()
+	CPPUNIT_ASSERT(data->nb_pending()>0);
+	CPPUNIT_ASSERT(solver2.solve(*data)==Solver::SUCCESS);
+	CPPUNIT_ASSERT(solver2.get_data().nb_solution()>=1);
+	delete data;
+	delete out;
+
+	remove(tmpname);
+	free(tmpname);
+	delete sys;
+}
+
+void TestSolver::restart_unicity() {
+	System* sys=circle1_sys();
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(*sys);
+	Vector prec(2,1e-3);
+	Solver solver(*sys,hc4,rr,stack,prec,prec);
+	CPPUNIT_ASSERT(solver.solve(IntervalVector(2,Interval(-10,10)))==Solver::SUCCESS);
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==2);
+	CPPUNIT_ASSERT(solver.get_data().find_unicity(solver.get_data().solution(0))==0);
+	CPPUNIT_ASSERT(solver.get_data().find_unicity(solver.get_data().solution(1))==1);
+	CPPUNIT_ASSERT(solver.get_data().find_unicity(IntervalVector(2,Interval(-10,10)))==-1);
+
+	// a pending box inside a unicity box is not processed again
+	CovSolverData data(solver.get_data(), true);
+	data.add_pending(data.solution(0));
+	CPPUNIT_ASSERT(solver.solve(data)==Solver::SUCCESS);
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==2);
+	CPPUNIT_ASSERT(solver.get_data().nb_cells()==data.nb_cells());
+
+	// same with output dropped: the solution of the input paving
+	// is not found again after other boxes have been notified.
+	CovSolverData data2(2, 2);
+	data2.add_solution(data.solution(0), data.unicity(0));
+	data2.add_pending(IntervalVector(2,Interval(-10,10)));
+	IntervalVector upper(2,Interval(-10,10));
+	upper[1]=Interval(0,10);
+	data2.add_pending(upper);  // processed first (stack)
+	solver.keep_output=false;
+	SolutionListener l;
+	solver.add_listener(l);
+	CPPUNIT_ASSERT(solver.solve(data2)==Solver::SUCCESS);
+	CPPUNIT_ASSERT(l.nb_sol==1);
+
+	// the unicity boxes are kept when the boxes are removed
+	data2.clear();
+	CPPUNIT_ASSERT(data2.size()==0);
+	CPPUNIT_ASSERT(data2.nb_solution()==0);
+	CPPUNIT_ASSERT(data2.nb_pending()==0);
+	CPPUNIT_ASSERT(data2.find_unicity(data.solution(0))==-2);
+	data2.add_solution(data.solution(1), data.unicity(1));
+	CPPUNIT_ASSERT(data2.find_unicity(data.solution(1))==0 || data2.find_unicity(data.solution(1))==-2);
+	CPPUNIT_ASSERT(data2.nb_solution()==1);
+
+	delete sys;
+}
+
+namespace {
+
+// the output boxes of a solver (as strings, in any order)
+multiset<string> output_boxes(const CovSolverData& data) {
+	multiset<string> boxes;
+	for (size_t i=0; i<data.size(); i++) {
+		stringstream ss;
+		ss << data.status(i) << ' ' << data[i];
+		boxes.insert(ss.str());
+	}
+	return boxes;
+}
+
+}
+
+void TestSolver::certif_threads01() {
+	// under-constrained system: certification at each intermediate step
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(y<=x);
+	System sys(f);
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(sys);
+	Vector eps_min(2,1e-3);
+	Vector eps_max(2,1e-1);
+
+	Solver solver(sys,hc4,rr,stack,eps_min,eps_max);
+	Solver::Status status=solver.solve(IntervalVector(2,Interval(-10,10)));
+	multiset<string> boxes=output_boxes(solver.get_data());
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()>0);
+
+	for (int nb_threads=1; nb_threads<=3; nb_threads++) {
+		solver.certif_threads=nb_threads;
+		CPPUNIT_ASSERT(solver.solve(IntervalVector(2,Interval(-10,10)))==status);
+		CPPUNIT_ASSERT(output_boxes(solver.get_data())==boxes);
+	}
+}
+
+void TestSolver::certif_threads02() {
+	System* sys=circle1_sys();
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(*sys);
+	Vector prec(2,1e-3);
+	Solver solver(*sys,hc4,rr,stack,prec,prec);
+	solver.certif_threads=2;
+
+	CPPUNIT_ASSERT(solver.solve(IntervalVector(2,Interval(-10,10)))==Solver::SUCCESS);
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==2);
+	CPPUNIT_ASSERT(solver.get_data().nb_unknown()==0);
+
+	// the submitted cells become pending boxes
+	CPPUNIT_ASSERT(solver.solve(IntervalVector(2,Interval(-10,10)),true)==Solver::USER_BREAK);
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==1);
+	CPPUNIT_ASSERT(solver.get_data().nb_pending()>0);
+
+	delete sys;
+}
+
+void TestSolver::compact01() {
+	// Broyden tridiagonal (the pending cells have a
+	// preconditioning matrix, for Newton)
+	int n=6;
+	Variable x(n);
+	SystemFactory f;
+	f.add_var(x);
+	for (int i=0; i<n; i++) {
+		const ExprNode& e=(3-2*x[i])*x[i]+1;
+		if (i==0) f.add_ctr(e-2*x[1]=0);
+		else if (i==n-1) f.add_ctr(e-x[n-2]=0);
+		else f.add_ctr(e-x[i-1]-2*x[i+1]=0);
+	}
+	System sys(f);
+	IntervalVector box(n,Interval(-1,1));
+
+	for (int dfs=0; dfs<2; dfs++) {
+		DefaultSolver plain(sys,1e-6,POS_INFINITY,dfs);
+		DefaultSolver compact(sys,1e-6,POS_INFINITY,dfs,DefaultSolver::default_random_seed,false,true);
+
+		CPPUNIT_ASSERT(plain.solve(box)==Solver::SUCCESS);
+		CPPUNIT_ASSERT(compact.solve(box)==Solver::SUCCESS);
+		CPPUNIT_ASSERT(plain.get_data().nb_solution()>0);
+		CPPUNIT_ASSERT(output_boxes(compact.get_data())==output_boxes(plain.get_data()));
+	}
+}
 
 } // end namespace
@@ -33,6 +33,12 @@ public:
 	CPPUNIT_TEST(circle2);
 	CPPUNIT_TEST(circle3);
 	CPPUNIT_TEST(circle4);
+	CPPUNIT_TEST(listener);
+	CPPUNIT_TEST(stream);
+	CPPUNIT_TEST(restart_unicity);
+	CPPUNIT_TEST(certif_threads01);
+	CPPUNIT_TEST(certif_threads02);
+	CPPUNIT_TEST(compact01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void empty();
@@ -40,6 +46,12 @@ public:
 	void circle2();
 	void circle3();
 	void circle4();
+	void listener();
+	void stream();
+	void restart_unicity();
+	void certif_threads01();
+	void certif_threads02();
+	void compact01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestSolver);
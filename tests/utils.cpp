@@ -79,8 +79,8 @@ void check(const IntervalVector& y_actual, const IntervalVector& y_expected, dou
 
 
 void check(const IntervalMatrix& y_actual, const IntervalMatrix& y_expected, double err) {
-	CPPUNIT_ASSERT(y_actual.nb_rows()!=y_actual.nb_rows());
-	CPPUNIT_ASSERT(y_actual.nb_cols()!=y_actual.nb_cols());
+	CPPUNIT_ASSERT(y_actual.nb_rows()==y_expected.nb_rows());
+	CPPUNIT_ASSERT(y_actual.nb_cols()==y_expected.nb_cols());
 	if (y_actual.is_empty() && y_expected.is_empty()) { CPPUNIT_ASSERT(true); return; }
 	for (int i=0; i<y_actual.nb_rows(); i++) {
 		check(y_actual.row(i), y_expected.row(i),err);